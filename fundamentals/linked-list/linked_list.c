@@ -1,9 +1,25 @@
 #include "linked_list.h"
+#include "slab.h"
+
+// 노드 할당기 (NULL이면 malloc/free)
+static SlabAllocator *node_allocator = NULL;
+
+// 노드 할당기 설정 (살아 있는 노드가 없을 때만 바꿔야 함)
+bool list_set_allocator(SlabAllocator *slab)
+{
+  if (slab != NULL && slab->object_size < sizeof(Node))
+  {
+    return false;
+  }
+  node_allocator = slab;
+  return true;
+}
 
 // 노드 생성
 Node *create_node(element_type new_data)
 {
-  Node *new_node = (Node *)malloc(sizeof(Node));
+  Node *new_node = node_allocator != NULL ? (Node *)slab_alloc(node_allocator)
+                                          : (Node *)malloc(sizeof(Node));
 
   new_node->data = new_data;
   new_node->next_node = NULL;
@@ -15,8 +31,15 @@ Node *create_node(element_type new_data)
 void destroy_node(Node *Node)
 {
   // Node->data는 int 타입이므로 free 불필요
-  // malloc으로 할당된 Node 구조체만 해제
-  free(Node);
+  // 할당받은 Node 구조체만 해제 (슬랩이면 free list로 반납)
+  if (node_allocator != NULL)
+  {
+    slab_free(node_allocator, Node);
+  }
+  else
+  {
+    free(Node);
+  }
 }
 
 // 노드 추가
@@ -3,6 +3,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdbool.h>
 
 typedef int element_type;
 
@@ -24,4 +25,9 @@ void remove_node(Node **head, Node *remove);
 Node *get_node_at(Node *head, int location);
 int get_node_count(Node *head);
 
+// 노드 할당기 설정 (fundamentals/slab-allocator, NULL이면 malloc/free)
+// 아레나 모드: destroy_all_nodes 대신 slab_reset(slab) 후 head를 NULL로
+struct SlabAllocator;
+bool list_set_allocator(struct SlabAllocator *slab);
+
 #endif
\ No newline at end of file
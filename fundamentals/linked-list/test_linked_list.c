@@ -1,4 +1,5 @@
 #include "linked_list.h"
+#include "slab.h"
 
 int main(void)
 {
@@ -134,5 +135,40 @@ int main(void)
     printf("\nFinal cleanup done. list pointer: %p\n", (void *)list);
   }
 
+  // ========================================
+  // 슬랩 할당기 테스트: free list 재사용 + 아레나 모드
+  // ========================================
+  printf("\n=== 슬랩 할당기 테스트 ===\n");
+  SlabAllocator *slab = create_slab_allocator(sizeof(Node), 64);
+  list_set_allocator(slab);
+
+  for (i = 0; i < 100; i++)
+  {
+    insert_new_head(&list, create_node(i));
+  }
+  current = get_node_at(list, 50);
+  remove_node(&list, current);
+  destroy_node(current);
+  new_node = create_node(5000);
+  printf("Reused freed slot: %s\n", new_node == current ? "yes" : "no");
+  insert_new_head(&list, new_node);
+
+  printf("Live nodes: %zu, slabs: %zu\n", slab->live_objects, slab->num_slabs);
+  destroy_all_nodes(&list);
+  printf("After destroy_all_nodes, live nodes: %zu\n", slab->live_objects);
+
+  // 아레나 모드: 노드를 따라가지 않고 한 번에 반납
+  for (i = 0; i < 100; i++)
+  {
+    append_node(&list, create_node(i));
+  }
+  slab_reset(slab);
+  list = NULL;
+  printf("After slab_reset, live nodes: %zu, slabs kept: %zu\n",
+         slab->live_objects, slab->num_slabs);
+
+  list_set_allocator(NULL);
+  destroy_slab_allocator(slab);
+
   return 0;
 }
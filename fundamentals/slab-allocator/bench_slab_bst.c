@@ -0,0 +1,102 @@
+#include "slab.h"
+#include "bst.h"
+#include <string.h>
+#include <time.h>
+
+/*
+ * 벤치마크: 이진 탐색 트리 노드 할당 - malloc vs 슬랩 vs 아레나
+ * 1. 랜덤 키 n개 삽입
+ * 2. 삽입/삭제 반복 (churn)
+ * 3. 트리 전체 해제 (free_tree vs slab_reset)
+ *
+ * 앞선 실행의 힙 배치가 다음 실행에 영향을 주지 않도록
+ * 모드마다 프로세스를 따로 띄운다: ./bench_slab_bst malloc|slab
+ */
+
+#define KEYS 1000000
+#define CHURN 2000000
+
+static double now_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int seed = 31;
+
+static int next_key(void)
+{
+  seed = seed * 1103515245u + 12345u;
+  return (int)(seed >> 1);
+}
+
+/* 트리 구성 후 churn: 기존 키 하나 삭제 + 새 키 하나 삽입 */
+static Node *build_and_churn(int *keys, double *build_time, double *churn_time)
+{
+  double t0 = now_seconds();
+  Node *root = NULL;
+  for (int i = 0; i < KEYS; i++)
+  {
+    keys[i] = next_key();
+    root = insert_node(root, keys[i]);
+  }
+
+  double t1 = now_seconds();
+  for (int i = 0; i < CHURN; i++)
+  {
+    int slot = (int)((unsigned int)next_key() % KEYS);
+    root = delete_node(root, keys[slot]);
+    keys[slot] = next_key();
+    root = insert_node(root, keys[slot]);
+  }
+  double t2 = now_seconds();
+
+  *build_time = t1 - t0;
+  *churn_time = t2 - t1;
+  return root;
+}
+
+int main(int argc, char *argv[])
+{
+  bool use_slab = argc > 1 && strcmp(argv[1], "slab") == 0;
+  int *keys = (int *)malloc(KEYS * sizeof(int));
+  double build_time, churn_time;
+
+  SlabAllocator *slab = NULL;
+  if (use_slab)
+  {
+    slab = create_slab_allocator(sizeof(Node), 0);
+    bst_set_allocator(slab);
+  }
+
+  printf("=== BST 노드 할당: %s (키 %d개, churn %d회) ===\n",
+         use_slab ? "슬랩" : "malloc", KEYS, CHURN);
+
+  Node *root = build_and_churn(keys, &build_time, &churn_time);
+  double t0 = now_seconds();
+  free_tree(root);
+  double teardown = now_seconds() - t0;
+
+  printf("  삽입      %8.3f 초\n", build_time);
+  printf("  churn     %8.3f 초\n", churn_time);
+  printf("  free_tree %8.3f 초\n", teardown);
+
+  if (use_slab)
+  {
+    // 아레나 모드: 같은 작업 후 slab_reset 한 번으로 해제
+    root = build_and_churn(keys, &build_time, &churn_time);
+    t0 = now_seconds();
+    slab_reset(slab);
+    root = NULL;
+    teardown = now_seconds() - t0;
+    printf("  slab_reset %7.6f 초 (아레나 모드, 노드 수와 무관)\n", teardown);
+
+    bst_set_allocator(NULL);
+    destroy_slab_allocator(slab);
+  }
+
+  free(keys);
+  printf("\n");
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include "slab.h"
+#include "linked_list.h"
+#include <string.h>
+#include <time.h>
+
+/*
+ * 벤치마크: 연결 리스트 노드 할당 - malloc vs 슬랩 vs 아레나
+ * 1. 노드 n개를 head에 삽입
+ * 2. head 제거/삽입 반복 (churn)
+ * 3. 리스트 한 바퀴 순회 (노드가 얼마나 모여 있는지)
+ * 4. 리스트 전체 해제 (destroy_all_nodes vs slab_reset)
+ *
+ * 모드마다 프로세스를 따로 띄운다: ./bench_slab_list malloc|slab
+ */
+
+#define NODES 2000000
+#define CHURN 10000000
+
+static double now_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static Node *build_and_churn(double *build_time, double *churn_time)
+{
+  double t0 = now_seconds();
+  Node *list = NULL;
+  for (int i = 0; i < NODES; i++)
+  {
+    insert_new_head(&list, create_node(i));
+  }
+
+  double t1 = now_seconds();
+  for (int i = 0; i < CHURN; i++)
+  {
+    Node *head = list;
+    remove_node(&list, head);
+    destroy_node(head);
+    insert_new_head(&list, create_node(i));
+  }
+  double t2 = now_seconds();
+
+  *build_time = t1 - t0;
+  *churn_time = t2 - t1;
+  return list;
+}
+
+int main(int argc, char *argv[])
+{
+  bool use_slab = argc > 1 && strcmp(argv[1], "slab") == 0;
+  double build_time, churn_time;
+
+  SlabAllocator *slab = NULL;
+  if (use_slab)
+  {
+    slab = create_slab_allocator(sizeof(Node), 0);
+    list_set_allocator(slab);
+  }
+
+  printf("=== 연결 리스트 노드 할당: %s (노드 %d개, churn %d회) ===\n",
+         use_slab ? "슬랩" : "malloc", NODES, CHURN);
+
+  Node *list = build_and_churn(&build_time, &churn_time);
+
+  double t0 = now_seconds();
+  int count = get_node_count(list);
+  double traverse = now_seconds() - t0;
+
+  t0 = now_seconds();
+  destroy_all_nodes(&list);
+  double teardown = now_seconds() - t0;
+
+  printf("  삽입              %8.3f 초\n", build_time);
+  printf("  churn             %8.3f 초\n", churn_time);
+  printf("  순회 (%d개)  %8.3f 초\n", count, traverse);
+  printf("  destroy_all_nodes %8.3f 초\n", teardown);
+
+  if (use_slab)
+  {
+    list = build_and_churn(&build_time, &churn_time);
+    t0 = now_seconds();
+    slab_reset(slab);
+    list = NULL;
+    teardown = now_seconds() - t0;
+    printf("  slab_reset        %8.6f 초 (아레나 모드)\n", teardown);
+
+    list_set_allocator(NULL);
+    destroy_slab_allocator(slab);
+  }
+
+  printf("\n");
+  return 0;
+}
@@ -0,0 +1,204 @@
+#include "slab.h"
+
+/* 슬랩 헤더 뒤의 객체 영역 시작 */
+static unsigned char *slab_objects(Slab *s)
+{
+  return (unsigned char *)(s + 1);
+}
+
+/* bump 영역을 슬랩 s로 옮김 */
+static void use_slab(SlabAllocator *slab, Slab *s)
+{
+  slab->current = s;
+  slab->bump = slab_objects(s);
+  slab->bump_end = slab->bump + s->capacity * slab->object_size;
+}
+
+/**
+ * 슬랩 할당기 생성
+ * @param object_size: 객체 하나의 크기 (바이트)
+ * @param objects_per_slab: 슬랩 하나에 담을 객체 수 (0이면 기본값)
+ * @return: 생성된 할당기 (실패 시 NULL)
+ *
+ * 슬랩은 처음 할당할 때 확보한다.
+ */
+SlabAllocator *create_slab_allocator(size_t object_size, size_t objects_per_slab)
+{
+  if (object_size == 0)
+  {
+    return NULL;
+  }
+
+  SlabAllocator *slab = (SlabAllocator *)malloc(sizeof(SlabAllocator));
+  if (slab == NULL)
+  {
+    return NULL;
+  }
+
+  // free_list 포인터를 객체 안에 저장하므로 최소 포인터 크기
+  if (object_size < sizeof(void *))
+  {
+    object_size = sizeof(void *);
+  }
+  slab->object_size = (object_size + SLAB_ALIGNMENT - 1) / SLAB_ALIGNMENT * SLAB_ALIGNMENT;
+  slab->objects_per_slab = objects_per_slab > 0 ? objects_per_slab : SLAB_DEFAULT_OBJECTS;
+  slab->free_list = NULL;
+  slab->first = NULL;
+  slab->last = NULL;
+  slab->current = NULL;
+  slab->bump = NULL;
+  slab->bump_end = NULL;
+  slab->live_objects = 0;
+  slab->num_slabs = 0;
+  return slab;
+}
+
+/*
+ * bump 영역에 객체가 min_objects개 이상 남은 슬랩으로 이동
+ * reset 이후라면 이미 확보한 슬랩을 순서대로 재사용하고,
+ * 없으면 max(min_objects, objects_per_slab)개짜리 새 슬랩을 확보한다.
+ */
+static bool next_slab(SlabAllocator *slab, size_t min_objects)
+{
+  while (slab->current != NULL && slab->current->next != NULL)
+  {
+    use_slab(slab, slab->current->next);
+    if (slab->current->capacity >= min_objects)
+    {
+      return true;
+    }
+  }
+
+  size_t capacity = min_objects > slab->objects_per_slab ? min_objects : slab->objects_per_slab;
+  Slab *s = (Slab *)malloc(sizeof(Slab) + capacity * slab->object_size);
+  if (s == NULL)
+  {
+    return false;
+  }
+  s->next = NULL;
+  s->capacity = capacity;
+
+  if (slab->last == NULL)
+  {
+    slab->first = s;
+  }
+  else
+  {
+    slab->last->next = s;
+  }
+  slab->last = s;
+  slab->num_slabs++;
+
+  use_slab(slab, s);
+  return true;
+}
+
+/**
+ * 객체 하나 할당
+ * @return: object_size 바이트 메모리 (실패 시 NULL)
+ *
+ * 1. free_list에 반납된 객체가 있으면 꺼내서 사용
+ * 2. 없으면 현재 슬랩에서 bump 포인터를 밀어서 사용
+ * 두 경우 모두 O(1) (새 슬랩이 필요할 때만 malloc 한 번)
+ */
+void *slab_alloc(SlabAllocator *slab)
+{
+  if (slab->free_list != NULL)
+  {
+    void *object = slab->free_list;
+    slab->free_list = *(void **)object;
+    slab->live_objects++;
+    return object;
+  }
+
+  if (slab->bump == slab->bump_end && !next_slab(slab, 1))
+  {
+    return NULL;
+  }
+
+  void *object = slab->bump;
+  slab->bump += slab->object_size;
+  slab->live_objects++;
+  return object;
+}
+
+/**
+ * 연속된 객체 count개 할당
+ * @return: 첫 객체 주소 (i번째 객체는 첫 주소 + i * object_size), 실패 시 NULL
+ *
+ * free_list는 흩어져 있으므로 쓰지 않고 bump 영역에서만 잘라낸다.
+ * 현재 슬랩에 자리가 모자라면 남은 자리는 건너뛰고 (reset 전까지 미사용)
+ * count개가 들어가는 슬랩으로 넘어간다.
+ */
+void *slab_alloc_contiguous(SlabAllocator *slab, size_t count)
+{
+  if (count == 0)
+  {
+    return NULL;
+  }
+
+  size_t remaining = (size_t)(slab->bump_end - slab->bump) / slab->object_size;
+  if (remaining < count && !next_slab(slab, count))
+  {
+    return NULL;
+  }
+
+  void *first = slab->bump;
+  slab->bump += count * slab->object_size;
+  slab->live_objects += count;
+  return first;
+}
+
+/**
+ * 객체 반납 (free_list 앞에 연결, O(1))
+ * @param object: 같은 할당기에서 받은 객체 (NULL이면 무시)
+ */
+void slab_free(SlabAllocator *slab, void *object)
+{
+  if (object == NULL)
+  {
+    return;
+  }
+
+  *(void **)object = slab->free_list;
+  slab->free_list = object;
+  slab->live_objects--;
+}
+
+/**
+ * 아레나 모드 해제: 모든 객체를 한 번에 반납
+ *
+ * 객체를 하나씩 따라가지 않고 free_list를 비우고 bump 포인터를
+ * 첫 슬랩의 처음으로 되돌린다. 객체 수와 무관하게 O(1)이며,
+ * 이후 할당은 기존 슬랩을 순서대로 다시 채운다.
+ */
+void slab_reset(SlabAllocator *slab)
+{
+  slab->free_list = NULL;
+  slab->live_objects = 0;
+
+  if (slab->first != NULL)
+  {
+    use_slab(slab, slab->first);
+  }
+}
+
+/**
+ * 할당기와 모든 슬랩 메모리 해제 (O(슬랩 수))
+ */
+void destroy_slab_allocator(SlabAllocator *slab)
+{
+  if (slab == NULL)
+  {
+    return;
+  }
+
+  Slab *s = slab->first;
+  while (s != NULL)
+  {
+    Slab *next = s->next;
+    free(s);
+    s = next;
+  }
+  free(slab);
+}
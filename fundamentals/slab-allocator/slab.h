@@ -0,0 +1,64 @@
+#ifndef SLAB_H
+#define SLAB_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+/* 객체 정렬 단위 (포인터, int, double 모두 만족) */
+#define SLAB_ALIGNMENT 8
+
+/* 슬랩 하나에 들어가는 기본 객체 개수 */
+#define SLAB_DEFAULT_OBJECTS 4096
+
+/*
+ * 슬랩: 같은 크기 객체 여러 개를 담는 큰 메모리 덩어리
+ * 헤더 바로 뒤에 object_size * capacity 바이트의 객체 영역이 이어진다.
+ */
+typedef struct Slab
+{
+  struct Slab *next; /* 다음 슬랩 (할당 순서) */
+  size_t capacity;   /* 이 슬랩의 객체 개수 */
+} Slab;
+
+/*
+ * 슬랩 할당기 (객체 크기 하나 = 타입 하나)
+ *
+ * 1. 해제된 객체는 free_list에 쌓였다가 다음 할당에서 먼저 재사용된다.
+ *    (객체 자신의 앞부분에 다음 포인터를 저장하는 intrusive 리스트)
+ * 2. free_list가 비면 현재 슬랩에서 bump 포인터만 밀어서 할당한다.
+ * 3. 아레나 모드: slab_reset()으로 모든 객체를 O(1)에 한 번에 반납한다.
+ *    슬랩 메모리는 돌려주지 않고 다음 할당부터 처음부터 다시 쓴다.
+ */
+typedef struct SlabAllocator
+{
+  size_t object_size;      /* 정렬 단위로 올림한 객체 크기 */
+  size_t objects_per_slab; /* 새 슬랩의 객체 개수 */
+  void *free_list;         /* 해제된 객체 리스트 */
+  Slab *first;             /* 슬랩 리스트의 처음 */
+  Slab *last;              /* 슬랩 리스트의 끝 (새 슬랩을 붙이는 곳) */
+  Slab *current;           /* bump 할당 중인 슬랩 */
+  unsigned char *bump;     /* current에서 다음에 나눠줄 위치 */
+  unsigned char *bump_end; /* current 객체 영역의 끝 */
+  size_t live_objects;     /* 사용 중인 객체 수 */
+  size_t num_slabs;        /* 확보한 슬랩 수 */
+} SlabAllocator;
+
+/* 생성/해제 (objects_per_slab이 0이면 SLAB_DEFAULT_OBJECTS) */
+SlabAllocator *create_slab_allocator(size_t object_size, size_t objects_per_slab);
+void destroy_slab_allocator(SlabAllocator *slab);
+
+/* 객체 하나 할당/해제 (O(1)) */
+void *slab_alloc(SlabAllocator *slab);
+void slab_free(SlabAllocator *slab, void *object);
+
+/*
+ * 연속된 객체 count개를 한 번에 할당 (첫 객체 주소 반환, 실패 시 NULL)
+ * 각 객체는 이후 slab_free로 하나씩 반납해도 된다.
+ */
+void *slab_alloc_contiguous(SlabAllocator *slab, size_t count);
+
+/* 아레나 모드: 할당한 모든 객체를 O(1)에 반납 (이전 포인터는 모두 무효) */
+void slab_reset(SlabAllocator *slab);
+
+#endif // SLAB_H
@@ -0,0 +1,229 @@
+#include "slab.h"
+#include <stdint.h>
+#include <string.h>
+
+static int failures = 0;
+
+/* 조건 확인 헬퍼: ✓/✗ 출력 후 실패 횟수 누적 */
+static void check(bool condition, const char *message)
+{
+  printf("%s %s\n", condition ? "✓" : "✗", message);
+  if (!condition)
+  {
+    failures++;
+  }
+}
+
+/**
+ * 테스트 1: 객체 크기 정렬
+ */
+void test_object_size()
+{
+  printf("=== 테스트 1: 객체 크기 정렬 ===\n");
+
+  SlabAllocator *a = create_slab_allocator(1, 0);
+  SlabAllocator *b = create_slab_allocator(12, 0);
+  SlabAllocator *c = create_slab_allocator(24, 0);
+
+  check(a->object_size == sizeof(void *), "1바이트 → 포인터 크기 (free list 링크 저장용)");
+  check(b->object_size == 16 && c->object_size == 24, "12 → 16, 24 → 24 (8바이트 정렬)");
+  check(a->objects_per_slab == SLAB_DEFAULT_OBJECTS, "슬랩당 객체 수 기본값");
+  check(create_slab_allocator(0, 0) == NULL, "크기 0은 NULL");
+
+  destroy_slab_allocator(a);
+  destroy_slab_allocator(b);
+  destroy_slab_allocator(c);
+  printf("\n");
+}
+
+/**
+ * 테스트 2: 할당 - 서로 다른 정렬된 주소, 슬랩 단위 확보
+ */
+void test_alloc()
+{
+  printf("=== 테스트 2: 할당과 슬랩 확보 ===\n");
+
+  SlabAllocator *slab = create_slab_allocator(24, 100);
+  check(slab->num_slabs == 0, "처음에는 슬랩 없음 (지연 확보)");
+
+  void *objects[250];
+  bool aligned = true;
+  for (int i = 0; i < 250; i++)
+  {
+    objects[i] = slab_alloc(slab);
+    memset(objects[i], i, 24);
+    aligned = aligned && ((uintptr_t)objects[i] % SLAB_ALIGNMENT == 0);
+  }
+
+  bool intact = true;
+  for (int i = 0; i < 250; i++)
+  {
+    unsigned char *bytes = (unsigned char *)objects[i];
+    intact = intact && bytes[0] == (unsigned char)i && bytes[23] == (unsigned char)i;
+  }
+
+  check(aligned, "모든 객체가 8바이트 정렬");
+  check(intact, "객체끼리 겹치지 않음 (memset 후 값 유지)");
+  check(slab->num_slabs == 3 && slab->live_objects == 250, "객체 250개 → 슬랩 3개");
+  check((unsigned char *)objects[1] - (unsigned char *)objects[0] == 24,
+        "같은 슬랩 안에서는 연속된 주소");
+
+  destroy_slab_allocator(slab);
+  printf("\n");
+}
+
+/**
+ * 테스트 3: free list 재사용 (LIFO)
+ */
+void test_free_list()
+{
+  printf("=== 테스트 3: free list 재사용 ===\n");
+
+  SlabAllocator *slab = create_slab_allocator(16, 8);
+  void *a = slab_alloc(slab);
+  void *b = slab_alloc(slab);
+  void *c = slab_alloc(slab);
+
+  slab_free(slab, a);
+  slab_free(slab, c);
+  slab_free(slab, NULL);
+  check(slab->live_objects == 1, "두 개 반납 후 사용 중 1개 (NULL 반납은 무시)");
+  check(slab_alloc(slab) == c && slab_alloc(slab) == a, "마지막에 반납한 것부터 재사용");
+  check(slab_alloc(slab) != b && slab->num_slabs == 1, "free list가 비면 bump 할당");
+
+  destroy_slab_allocator(slab);
+  printf("\n");
+}
+
+/**
+ * 테스트 4: 아레나 모드 (slab_reset)
+ */
+void test_reset()
+{
+  printf("=== 테스트 4: 아레나 모드 ===\n");
+
+  SlabAllocator *slab = create_slab_allocator(32, 10);
+  void *first[25];
+  for (int i = 0; i < 25; i++)
+  {
+    first[i] = slab_alloc(slab);
+  }
+  slab_free(slab, first[3]);
+
+  slab_reset(slab);
+  check(slab->live_objects == 0 && slab->free_list == NULL, "reset 후 사용 중 0개, free list 비움");
+
+  bool same = true;
+  for (int i = 0; i < 25; i++)
+  {
+    same = same && slab_alloc(slab) == first[i];
+  }
+  check(same, "reset 후 기존 슬랩을 같은 순서로 재사용");
+  check(slab->num_slabs == 3, "새 슬랩을 확보하지 않음");
+
+  // 기존 슬랩을 다 쓰면 새 슬랩을 뒤에 붙임
+  for (int i = 0; i < 10; i++)
+  {
+    slab_alloc(slab);
+  }
+  check(slab->num_slabs == 4 && slab->live_objects == 35, "기존 슬랩을 넘어서면 새 슬랩 추가");
+
+  SlabAllocator *empty = create_slab_allocator(8, 0);
+  slab_reset(empty);
+  check(slab_alloc(empty) != NULL, "한 번도 할당하지 않은 할당기 reset");
+
+  destroy_slab_allocator(slab);
+  destroy_slab_allocator(empty);
+  printf("\n");
+}
+
+/**
+ * 테스트 5: 대량 할당/반납 반복
+ */
+void test_churn()
+{
+  printf("=== 테스트 5: 대량 할당/반납 반복 ===\n");
+
+  enum
+  {
+    COUNT = 100000
+  };
+  static void *objects[COUNT];
+  SlabAllocator *slab = create_slab_allocator(24, 0);
+
+  for (int round = 0; round < 3; round++)
+  {
+    for (int i = 0; i < COUNT; i++)
+    {
+      objects[i] = slab_alloc(slab);
+    }
+    for (int i = 0; i < COUNT; i += 2)
+    {
+      slab_free(slab, objects[i]);
+    }
+    for (int i = 1; i < COUNT; i += 2)
+    {
+      slab_free(slab, objects[i]);
+    }
+  }
+
+  size_t expected = (COUNT + SLAB_DEFAULT_OBJECTS - 1) / SLAB_DEFAULT_OBJECTS;
+  check(slab->live_objects == 0, "모두 반납 후 사용 중 0개");
+  check(slab->num_slabs == expected, "반납한 객체를 재사용해서 슬랩 수가 늘지 않음");
+
+  destroy_slab_allocator(slab);
+  printf("\n");
+}
+
+/**
+ * 테스트 6: 연속 할당
+ */
+void test_contiguous()
+{
+  printf("=== 테스트 6: 연속 할당 ===\n");
+
+  SlabAllocator *slab = create_slab_allocator(24, 100);
+  void *single = slab_alloc(slab);
+  unsigned char *run = (unsigned char *)slab_alloc_contiguous(slab, 50);
+  check(run == (unsigned char *)single + 24, "현재 슬랩에 자리가 있으면 바로 뒤에서 잘라냄");
+
+  unsigned char *big = (unsigned char *)slab_alloc_contiguous(slab, 250);
+  memset(big, 7, 250 * 24);
+  check(big != NULL && slab->num_slabs == 2 && slab->last->capacity == 250,
+        "자리가 모자라면 250개짜리 전용 슬랩 확보");
+  check(slab->live_objects == 301, "사용 중 객체 수에 모두 반영");
+
+  // 연속 할당한 객체도 하나씩 반납 가능
+  slab_free(slab, big + 10 * 24);
+  check(slab_alloc(slab) == big + 10 * 24, "연속 할당한 객체를 개별 반납 후 재사용");
+  check(slab_alloc_contiguous(slab, 0) == NULL, "0개 요청은 NULL");
+
+  // reset 후에는 충분히 큰 슬랩을 찾아서 재사용
+  slab_reset(slab);
+  check(slab_alloc_contiguous(slab, 200) == big && slab->num_slabs == 2,
+        "reset 후 200개 요청 → 기존 250개짜리 슬랩 재사용");
+
+  destroy_slab_allocator(slab);
+  printf("\n");
+}
+
+int main(void)
+{
+  printf("\n=== 슬랩 할당기 유닛 테스트 ===\n\n");
+
+  test_object_size();
+  test_alloc();
+  test_free_list();
+  test_reset();
+  test_churn();
+  test_contiguous();
+
+  if (failures > 0)
+  {
+    printf("✗ 실패한 검사: %d개\n", failures);
+    return 1;
+  }
+
+  printf("=== 모든 테스트 통과! ===\n\n");
+  return 0;
+}
@@ -0,0 +1,779 @@
+#include "dynamic_mst.h"
+
+/* ========== Link-Cut Tree 관련 함수 ========== */
+
+/**
+ * Link-Cut Tree 생성
+ * @param size: 노드 개수 (정점 + 간선)
+ * @return: 생성된 Link-Cut Tree 포인터
+ */
+static LinkCutTree *create_link_cut_tree(int size)
+{
+  LinkCutTree *lct = (LinkCutTree *)malloc(sizeof(LinkCutTree));
+  if (!lct)
+  {
+    return NULL;
+  }
+
+  lct->child = (int (*)[2])malloc(size * sizeof(*lct->child));
+  lct->parent = (int *)malloc(size * sizeof(int));
+  lct->reversed = (bool *)malloc(size * sizeof(bool));
+  lct->value = (int *)malloc(size * sizeof(int));
+  lct->max_node = (int *)malloc(size * sizeof(int));
+  lct->stack = (int *)malloc(size * sizeof(int));
+
+  if (!lct->child || !lct->parent || !lct->reversed ||
+      !lct->value || !lct->max_node || !lct->stack)
+  {
+    free(lct->child);
+    free(lct->parent);
+    free(lct->reversed);
+    free(lct->value);
+    free(lct->max_node);
+    free(lct->stack);
+    free(lct);
+    return NULL;
+  }
+
+  lct->size = size;
+
+  /* 초기화: 모든 노드가 독립된 트리 */
+  for (int i = 0; i < size; i++)
+  {
+    lct->child[i][0] = -1;
+    lct->child[i][1] = -1;
+    lct->parent[i] = -1;
+    lct->reversed[i] = false;
+    lct->value[i] = INT_MIN;
+    lct->max_node[i] = i;
+  }
+
+  return lct;
+}
+
+static void free_link_cut_tree(LinkCutTree *lct)
+{
+  if (!lct)
+  {
+    return;
+  }
+  free(lct->child);
+  free(lct->parent);
+  free(lct->reversed);
+  free(lct->value);
+  free(lct->max_node);
+  free(lct->stack);
+  free(lct);
+}
+
+/**
+ * x가 자신이 속한 splay 트리의 루트인지 확인
+ * (부모가 없거나, 부모와의 연결이 path-parent 포인터인 경우)
+ */
+static bool lct_is_root(LinkCutTree *lct, int x)
+{
+  int p = lct->parent[x];
+  return p == -1 || (lct->child[p][0] != x && lct->child[p][1] != x);
+}
+
+/**
+ * 자식 정보로 max_node 갱신
+ */
+static void lct_pull(LinkCutTree *lct, int x)
+{
+  int best = x;
+
+  for (int d = 0; d < 2; d++)
+  {
+    int c = lct->child[x][d];
+    if (c != -1 && lct->value[lct->max_node[c]] > lct->value[best])
+    {
+      best = lct->max_node[c];
+    }
+  }
+
+  lct->max_node[x] = best;
+}
+
+/**
+ * 서브트리 뒤집기 (make_root에서 경로 방향을 바꿀 때 사용)
+ */
+static void lct_reverse(LinkCutTree *lct, int x)
+{
+  if (x == -1)
+  {
+    return;
+  }
+
+  int temp = lct->child[x][0];
+  lct->child[x][0] = lct->child[x][1];
+  lct->child[x][1] = temp;
+  lct->reversed[x] = !lct->reversed[x];
+}
+
+/**
+ * lazy 뒤집기 플래그를 자식에게 전파
+ */
+static void lct_push(LinkCutTree *lct, int x)
+{
+  if (lct->reversed[x])
+  {
+    lct_reverse(lct, lct->child[x][0]);
+    lct_reverse(lct, lct->child[x][1]);
+    lct->reversed[x] = false;
+  }
+}
+
+static void lct_rotate(LinkCutTree *lct, int x)
+{
+  int y = lct->parent[x];
+  int z = lct->parent[y];
+  int d = (lct->child[y][1] == x);
+  int moved = lct->child[x][!d];
+
+  if (!lct_is_root(lct, y))
+  {
+    lct->child[z][lct->child[z][1] == y] = x;
+  }
+  lct->parent[x] = z;
+
+  lct->child[y][d] = moved;
+  if (moved != -1)
+  {
+    lct->parent[moved] = y;
+  }
+
+  lct->child[x][!d] = y;
+  lct->parent[y] = x;
+
+  lct_pull(lct, y);
+  lct_pull(lct, x);
+}
+
+/**
+ * x를 자신이 속한 splay 트리의 루트로 올림
+ * 재귀 대신 미리 준비한 스택으로 위쪽 노드부터 lazy 플래그를 전파
+ */
+static void lct_splay(LinkCutTree *lct, int x)
+{
+  int top = 0;
+  lct->stack[top++] = x;
+  for (int y = x; !lct_is_root(lct, y); y = lct->parent[y])
+  {
+    lct->stack[top++] = lct->parent[y];
+  }
+  while (top > 0)
+  {
+    lct_push(lct, lct->stack[--top]);
+  }
+
+  while (!lct_is_root(lct, x))
+  {
+    int y = lct->parent[x];
+    if (!lct_is_root(lct, y))
+    {
+      int z = lct->parent[y];
+      /* zig-zig이면 부모를 먼저, zig-zag이면 자신을 먼저 회전 */
+      bool same_side = (lct->child[z][0] == y) == (lct->child[y][0] == x);
+      lct_rotate(lct, same_side ? y : x);
+    }
+    lct_rotate(lct, x);
+  }
+}
+
+/**
+ * 루트에서 x까지의 경로를 하나의 splay 트리로 만듦 (preferred path)
+ */
+static void lct_access(LinkCutTree *lct, int x)
+{
+  for (int y = x, last = -1; y != -1; last = y, y = lct->parent[y])
+  {
+    lct_splay(lct, y);
+    lct->child[y][1] = last;
+    lct_pull(lct, y);
+  }
+  lct_splay(lct, x);
+}
+
+static void lct_make_root(LinkCutTree *lct, int x)
+{
+  lct_access(lct, x);
+  lct_reverse(lct, x);
+}
+
+static int lct_find_root(LinkCutTree *lct, int x)
+{
+  lct_access(lct, x);
+  for (;;)
+  {
+    lct_push(lct, x);
+    if (lct->child[x][0] == -1)
+    {
+      break;
+    }
+    x = lct->child[x][0];
+  }
+  /* 분할 상환 복잡도를 위해 찾은 루트를 splay */
+  lct_splay(lct, x);
+  return x;
+}
+
+static void lct_link(LinkCutTree *lct, int x, int y)
+{
+  lct_make_root(lct, x);
+  lct->parent[x] = y;
+}
+
+/**
+ * 인접한 두 노드 x, y 사이의 연결을 끊음
+ */
+static void lct_cut(LinkCutTree *lct, int x, int y)
+{
+  lct_make_root(lct, x);
+  lct_access(lct, y);
+
+  /* 이제 y가 splay 루트이고, 경로 x-y에서 x는 y의 왼쪽 자식 */
+  lct->child[y][0] = -1;
+  lct->parent[x] = -1;
+  lct_pull(lct, y);
+}
+
+/**
+ * x-y 경로 위에서 값이 가장 큰 노드 반환
+ */
+static int lct_path_max(LinkCutTree *lct, int x, int y)
+{
+  lct_make_root(lct, x);
+  lct_access(lct, y);
+  return lct->max_node[y];
+}
+
+/* ========== 동적 MST 내부 함수 ========== */
+
+static int edge_node(DynamicMST *dm, int edge_id)
+{
+  return dm->num_vertices + edge_id;
+}
+
+static bool is_valid_edge_id(DynamicMST *dm, int edge_id)
+{
+  return edge_id >= 0 && edge_id < dm->next_id && dm->edges[edge_id].active;
+}
+
+/**
+ * 간선을 MST 포레스트에 연결 (간선 노드를 사이에 두고 src - e - dest)
+ */
+static void attach_tree_edge(DynamicMST *dm, int edge_id)
+{
+  LinkCutTree *lct = dm->lct;
+  DynEdge *edge = &dm->edges[edge_id];
+  int node = edge_node(dm, edge_id);
+
+  /* 트리 밖의 간선 노드는 고립되어 있으므로 값만 새로 설정 */
+  lct->child[node][0] = -1;
+  lct->child[node][1] = -1;
+  lct->parent[node] = -1;
+  lct->reversed[node] = false;
+  lct->value[node] = edge->weight;
+  lct->max_node[node] = node;
+
+  lct_link(lct, edge->src, node);
+  lct_link(lct, node, edge->dest);
+
+  edge->in_tree = true;
+  dm->num_tree_edges++;
+  dm->total_weight += edge->weight;
+}
+
+/**
+ * 간선을 MST 포레스트에서 분리
+ */
+static void detach_tree_edge(DynamicMST *dm, int edge_id)
+{
+  DynEdge *edge = &dm->edges[edge_id];
+  int node = edge_node(dm, edge_id);
+
+  lct_cut(dm->lct, edge->src, node);
+  lct_cut(dm->lct, node, edge->dest);
+
+  edge->in_tree = false;
+  dm->num_tree_edges--;
+  dm->total_weight -= edge->weight;
+}
+
+/**
+ * 트리 밖의 간선을 MST 후보로 검사 (Cycle property)
+ * - 두 정점이 다른 트리에 있으면 그대로 연결
+ * - 같은 트리라면 경로 위 최대 가중치 간선보다 가벼울 때만 교체
+ * 시간 복잡도: 분할 상환 O(log V)
+ */
+static void offer_edge(DynamicMST *dm, int edge_id)
+{
+  DynEdge *edge = &dm->edges[edge_id];
+
+  /* 자기 자신으로 가는 간선은 MST에 포함될 수 없음 */
+  if (edge->src == edge->dest)
+  {
+    return;
+  }
+
+  if (!dynamic_mst_connected(dm, edge->src, edge->dest))
+  {
+    attach_tree_edge(dm, edge_id);
+    return;
+  }
+
+  int heaviest = lct_path_max(dm->lct, edge->src, edge->dest);
+  if (dm->lct->value[heaviest] > edge->weight)
+  {
+    detach_tree_edge(dm, heaviest - dm->num_vertices);
+    attach_tree_edge(dm, edge_id);
+  }
+}
+
+/**
+ * 트리 간선을 끊은 뒤 두 컴포넌트를 다시 잇는 최소 가중치 간선 탐색
+ * 트리 밖의 간선은 항상 같은 트리 안의 두 정점을 잇기 때문에,
+ * 끊은 뒤 양 끝이 다른 트리에 있는 간선은 모두 잘린 경계를 지나는 간선임
+ * 시간 복잡도: O(E log V) - 삭제/가중치 증가 시에만 필요
+ */
+static int find_replacement(DynamicMST *dm)
+{
+  int best = -1;
+
+  for (int id = 0; id < dm->next_id; id++)
+  {
+    DynEdge *edge = &dm->edges[id];
+    if (!edge->active || edge->in_tree || edge->src == edge->dest)
+    {
+      continue;
+    }
+    if (best != -1 && edge->weight >= dm->edges[best].weight)
+    {
+      continue;
+    }
+    if (!dynamic_mst_connected(dm, edge->src, edge->dest))
+    {
+      best = id;
+    }
+  }
+
+  return best;
+}
+
+/* ========== 동적 MST 관련 함수 ========== */
+
+/**
+ * 동적 MST 생성
+ * @param vertices: 정점의 개수
+ * @param max_edges: 동시에 존재할 수 있는 최대 간선 개수
+ * @return: 생성된 동적 MST 포인터 (간선이 없는 포레스트 상태)
+ */
+DynamicMST *create_dynamic_mst(int vertices, int max_edges)
+{
+  if (vertices <= 0 || max_edges <= 0)
+  {
+    return NULL;
+  }
+
+  DynamicMST *dm = (DynamicMST *)malloc(sizeof(DynamicMST));
+  if (!dm)
+  {
+    return NULL;
+  }
+
+  dm->edges = (DynEdge *)malloc(max_edges * sizeof(DynEdge));
+  dm->free_ids = (int *)malloc(max_edges * sizeof(int));
+  dm->lct = create_link_cut_tree(vertices + max_edges);
+
+  if (!dm->edges || !dm->free_ids || !dm->lct)
+  {
+    free(dm->edges);
+    free(dm->free_ids);
+    free_link_cut_tree(dm->lct);
+    free(dm);
+    return NULL;
+  }
+
+  dm->num_vertices = vertices;
+  dm->capacity = max_edges;
+  dm->num_free = 0;
+  dm->next_id = 0;
+  dm->num_tree_edges = 0;
+  dm->total_weight = 0;
+
+  return dm;
+}
+
+/**
+ * 간선 삽입
+ * @param dm: 동적 MST 포인터
+ * @param src: 시작 정점
+ * @param dest: 도착 정점
+ * @param weight: 가중치
+ * @return: 간선 id (삭제/가중치 변경에 사용), 실패 시 -1
+ *
+ * 시간 복잡도: 분할 상환 O(log V)
+ */
+int dynamic_mst_insert_edge(DynamicMST *dm, int src, int dest, int weight)
+{
+  if (!dm || src < 0 || src >= dm->num_vertices ||
+      dest < 0 || dest >= dm->num_vertices)
+  {
+    return -1;
+  }
+
+  int edge_id;
+  if (dm->num_free > 0)
+  {
+    edge_id = dm->free_ids[--dm->num_free];
+  }
+  else if (dm->next_id < dm->capacity)
+  {
+    edge_id = dm->next_id++;
+  }
+  else
+  {
+    return -1;
+  }
+
+  DynEdge *edge = &dm->edges[edge_id];
+  edge->src = src;
+  edge->dest = dest;
+  edge->weight = weight;
+  edge->active = true;
+  edge->in_tree = false;
+
+  offer_edge(dm, edge_id);
+
+  return edge_id;
+}
+
+/**
+ * 간선 삭제
+ * @param dm: 동적 MST 포인터
+ * @param edge_id: 삭제할 간선 id
+ * @return: 삭제 성공 여부
+ *
+ * 시간 복잡도:
+ * - MST에 포함되지 않은 간선: O(1)
+ * - MST 간선: 대체 간선 탐색 때문에 O(E log V)
+ */
+bool dynamic_mst_delete_edge(DynamicMST *dm, int edge_id)
+{
+  if (!dm || !is_valid_edge_id(dm, edge_id))
+  {
+    return false;
+  }
+
+  DynEdge *edge = &dm->edges[edge_id];
+  bool was_tree_edge = edge->in_tree;
+
+  if (was_tree_edge)
+  {
+    detach_tree_edge(dm, edge_id);
+  }
+  edge->active = false;
+  dm->free_ids[dm->num_free++] = edge_id;
+
+  /* 끊어진 두 컴포넌트를 다시 이을 간선이 있으면 연결 */
+  if (was_tree_edge)
+  {
+    int replacement = find_replacement(dm);
+    if (replacement != -1)
+    {
+      attach_tree_edge(dm, replacement);
+    }
+  }
+
+  return true;
+}
+
+/**
+ * 간선 가중치 변경
+ * @param dm: 동적 MST 포인터
+ * @param edge_id: 변경할 간선 id
+ * @param weight: 새로운 가중치
+ * @return: 변경 성공 여부
+ *
+ * 시간 복잡도:
+ * - MST 간선의 가중치 감소 / 트리 밖 간선의 변경: 분할 상환 O(log V)
+ * - MST 간선의 가중치 증가: 대체 간선 탐색 때문에 O(E log V)
+ */
+bool dynamic_mst_update_weight(DynamicMST *dm, int edge_id, int weight)
+{
+  if (!dm || !is_valid_edge_id(dm, edge_id))
+  {
+    return false;
+  }
+
+  DynEdge *edge = &dm->edges[edge_id];
+
+  if (!edge->in_tree)
+  {
+    /* 트리 밖의 간선은 새로 삽입된 간선처럼 다시 검사 */
+    edge->weight = weight;
+    offer_edge(dm, edge_id);
+  }
+  else if (weight <= edge->weight)
+  {
+    /* 트리 간선이 가벼워지면 MST는 그대로, 노드 값만 갱신 */
+    int node = edge_node(dm, edge_id);
+    lct_access(dm->lct, node);
+    dm->lct->value[node] = weight;
+    lct_pull(dm->lct, node);
+
+    dm->total_weight += weight - edge->weight;
+    edge->weight = weight;
+  }
+  else
+  {
+    /* 트리 간선이 무거워지면 경계를 지나는 더 가벼운 간선으로 교체될 수 있음 */
+    detach_tree_edge(dm, edge_id);
+    edge->weight = weight;
+
+    /* 자기 자신도 후보이므로 replacement는 항상 존재 */
+    attach_tree_edge(dm, find_replacement(dm));
+  }
+
+  return true;
+}
+
+/**
+ * 두 정점이 현재 MST 포레스트에서 연결되어 있는지 확인
+ */
+bool dynamic_mst_connected(DynamicMST *dm, int u, int v)
+{
+  if (!dm || u < 0 || u >= dm->num_vertices ||
+      v < 0 || v >= dm->num_vertices)
+  {
+    return false;
+  }
+  return lct_find_root(dm->lct, u) == lct_find_root(dm->lct, v);
+}
+
+/**
+ * 현재 MST를 MST 구조체로 복사
+ * @param dm: 동적 MST 포인터
+ * @return: MST 결과 (호출자가 free_mst로 해제해야 함)
+ */
+MST *dynamic_mst_snapshot(DynamicMST *dm)
+{
+  if (!dm)
+  {
+    return NULL;
+  }
+
+  MST *mst = (MST *)malloc(sizeof(MST));
+  if (!mst)
+  {
+    return NULL;
+  }
+
+  /* MST는 최대 V-1개의 간선을 가짐 (V == 1일 때도 유효한 포인터 확보) */
+  mst->edges = (Edge *)malloc(dm->num_vertices * sizeof(Edge));
+  if (!mst->edges)
+  {
+    free(mst);
+    return NULL;
+  }
+
+  mst->num_edges = 0;
+  mst->total_weight = dm->total_weight;
+
+  for (int id = 0; id < dm->next_id; id++)
+  {
+    DynEdge *edge = &dm->edges[id];
+    if (edge->active && edge->in_tree)
+    {
+      mst->edges[mst->num_edges].src = edge->src;
+      mst->edges[mst->num_edges].dest = edge->dest;
+      mst->edges[mst->num_edges].weight = edge->weight;
+      mst->num_edges++;
+    }
+  }
+
+  return mst;
+}
+
+/**
+ * 동적 MST 메모리 해제
+ * @param dm: 해제할 동적 MST 포인터
+ */
+void free_dynamic_mst(DynamicMST *dm)
+{
+  if (!dm)
+  {
+    return;
+  }
+  free(dm->edges);
+  free(dm->free_ids);
+  free_link_cut_tree(dm->lct);
+  free(dm);
+}
+
+/* ========== 비교용 전체 재계산 (Kruskal) ========== */
+
+/**
+ * 간선 비교 함수 (qsort용)
+ * 가중치 기준 오름차순 정렬 (뺄셈 대신 비교로 오버플로 방지)
+ */
+static int compare_edges(const void *a, const void *b)
+{
+  const Edge *edge_a = (const Edge *)a;
+  const Edge *edge_b = (const Edge *)b;
+  return (edge_a->weight > edge_b->weight) - (edge_a->weight < edge_b->weight);
+}
+
+/**
+ * Find 연산 (경로 압축 - 반복문 버전)
+ */
+static int find_set(int *parent, int vertex)
+{
+  int root = vertex;
+  while (parent[root] != root)
+  {
+    root = parent[root];
+  }
+
+  while (parent[vertex] != root)
+  {
+    int next = parent[vertex];
+    parent[vertex] = root;
+    vertex = next;
+  }
+
+  return root;
+}
+
+/**
+ * 현재 활성 간선 전체로 MST를 처음부터 다시 계산
+ * 동적 MST와 결과/성능을 비교하기 위한 기준 구현
+ * 시간 복잡도: O(E log E)
+ */
+MST *recompute_mst(DynamicMST *dm)
+{
+  if (!dm)
+  {
+    return NULL;
+  }
+
+  int V = dm->num_vertices;
+  Edge *sorted = (Edge *)malloc((dm->next_id > 0 ? dm->next_id : 1) * sizeof(Edge));
+  int *parent = (int *)malloc(V * sizeof(int));
+  int *rank = (int *)malloc(V * sizeof(int));
+  MST *mst = (MST *)malloc(sizeof(MST));
+  Edge *mst_edges = (Edge *)malloc(V * sizeof(Edge));
+
+  if (!sorted || !parent || !rank || !mst || !mst_edges)
+  {
+    free(sorted);
+    free(parent);
+    free(rank);
+    free(mst);
+    free(mst_edges);
+    return NULL;
+  }
+
+  int num_edges = 0;
+  for (int id = 0; id < dm->next_id; id++)
+  {
+    DynEdge *edge = &dm->edges[id];
+    if (edge->active)
+    {
+      sorted[num_edges].src = edge->src;
+      sorted[num_edges].dest = edge->dest;
+      sorted[num_edges].weight = edge->weight;
+      num_edges++;
+    }
+  }
+
+  qsort(sorted, num_edges, sizeof(Edge), compare_edges);
+
+  for (int i = 0; i < V; i++)
+  {
+    parent[i] = i;
+    rank[i] = 0;
+  }
+
+  mst->edges = mst_edges;
+  mst->num_edges = 0;
+  mst->total_weight = 0;
+
+  for (int i = 0; i < num_edges && mst->num_edges < V - 1; i++)
+  {
+    int root_x = find_set(parent, sorted[i].src);
+    int root_y = find_set(parent, sorted[i].dest);
+
+    if (root_x == root_y)
+    {
+      continue;
+    }
+
+    /* Union by rank */
+    if (rank[root_x] < rank[root_y])
+    {
+      parent[root_x] = root_y;
+    }
+    else if (rank[root_x] > rank[root_y])
+    {
+      parent[root_y] = root_x;
+    }
+    else
+    {
+      parent[root_y] = root_x;
+      rank[root_x]++;
+    }
+
+    mst->edges[mst->num_edges++] = sorted[i];
+    mst->total_weight += sorted[i].weight;
+  }
+
+  free(sorted);
+  free(parent);
+  free(rank);
+
+  return mst;
+}
+
+/* ========== MST 관련 함수 ========== */
+
+/**
+ * MST 결과 출력
+ * @param mst: MST 포인터
+ */
+void print_mst(MST *mst)
+{
+  if (!mst)
+  {
+    printf("MST가 존재하지 않습니다.\n");
+    return;
+  }
+
+  printf("최소 신장 트리 (MST):\n");
+  printf("간선\t\t가중치\n");
+
+  for (int i = 0; i < mst->num_edges; i++)
+  {
+    printf("%d - %d\t\t%d\n",
+           mst->edges[i].src,
+           mst->edges[i].dest,
+           mst->edges[i].weight);
+  }
+
+  printf("\n총 가중치: %d\n", mst->total_weight);
+}
+
+/**
+ * MST 메모리 해제
+ * @param mst: 해제할 MST 포인터
+ */
+void free_mst(MST *mst)
+{
+  if (!mst)
+  {
+    return;
+  }
+  free(mst->edges);
+  free(mst);
+}
@@ -0,0 +1,82 @@
+#ifndef DYNAMIC_MST_H
+#define DYNAMIC_MST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+
+/* 간선 구조체 */
+typedef struct Edge
+{
+  int src;    /* 시작 정점 */
+  int dest;   /* 도착 정점 */
+  int weight; /* 가중치 */
+} Edge;
+
+/* MST 결과 구조체 */
+typedef struct MST
+{
+  Edge *edges;      /* MST를 구성하는 간선들 */
+  int num_edges;    /* MST 간선의 개수 */
+  int total_weight; /* MST의 총 가중치 */
+} MST;
+
+/* 동적 MST가 관리하는 간선 정보 */
+typedef struct DynEdge
+{
+  int src;
+  int dest;
+  int weight;
+  bool active;  /* 현재 그래프에 존재하는 간선인지 */
+  bool in_tree; /* 현재 MST(포레스트)에 포함된 간선인지 */
+} DynEdge;
+
+/*
+ * Link-Cut Tree (배열 기반)
+ * - 노드 0 ~ V-1: 정점
+ * - 노드 V ~ V+capacity-1: 간선 (간선 id e는 노드 V+e)
+ * 간선을 별도의 노드로 두면 "경로 위의 최대 가중치 간선"을 노드 값의 최댓값으로 구할 수 있음
+ */
+typedef struct LinkCutTree
+{
+  int size;        /* 전체 노드 개수 */
+  int (*child)[2]; /* child[x][0]: 왼쪽, child[x][1]: 오른쪽 자식 */
+  int *parent;     /* splay 트리 부모 또는 path-parent */
+  bool *reversed;  /* 구간 뒤집기 lazy 플래그 */
+  int *value;      /* 노드 값 (간선: 가중치, 정점: INT_MIN) */
+  int *max_node;   /* 서브트리에서 값이 가장 큰 노드 */
+  int *stack;      /* splay 전 lazy 전파용 스택 */
+} LinkCutTree;
+
+/* 동적 MST 구조체 */
+typedef struct DynamicMST
+{
+  int num_vertices;   /* 정점의 개수 */
+  int capacity;       /* 동시에 존재할 수 있는 최대 간선 개수 */
+  DynEdge *edges;     /* 간선 배열 (인덱스 = 간선 id) */
+  int *free_ids;      /* 재사용 가능한 간선 id 스택 */
+  int num_free;       /* free_ids에 쌓인 id 개수 */
+  int next_id;        /* 아직 한 번도 쓰지 않은 다음 id */
+  int num_tree_edges; /* MST 간선의 개수 */
+  int total_weight;   /* MST의 총 가중치 */
+  LinkCutTree *lct;   /* MST 포레스트를 표현하는 link-cut tree */
+} DynamicMST;
+
+/* 동적 MST 관련 함수 */
+DynamicMST *create_dynamic_mst(int vertices, int max_edges);
+int dynamic_mst_insert_edge(DynamicMST *dm, int src, int dest, int weight);
+bool dynamic_mst_delete_edge(DynamicMST *dm, int edge_id);
+bool dynamic_mst_update_weight(DynamicMST *dm, int edge_id, int weight);
+bool dynamic_mst_connected(DynamicMST *dm, int u, int v);
+MST *dynamic_mst_snapshot(DynamicMST *dm);
+void free_dynamic_mst(DynamicMST *dm);
+
+/* 비교용: 현재 간선 집합으로 MST 전체 재계산 (Kruskal) */
+MST *recompute_mst(DynamicMST *dm);
+
+/* MST 관련 함수 */
+void print_mst(MST *mst);
+void free_mst(MST *mst);
+
+#endif
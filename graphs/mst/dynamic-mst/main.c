@@ -0,0 +1,163 @@
+#include "dynamic_mst.h"
+#include <time.h>
+
+/* 벤치마크용 간단한 LCG */
+static unsigned int seed = 2024;
+
+static int next_random(int bound)
+{
+  seed = seed * 1103515245u + 12345u;
+  return (int)((seed >> 8) % (unsigned int)bound);
+}
+
+int main(void)
+{
+  printf("=== 동적 MST (Link-Cut Tree) 데모 ===\n\n");
+
+  /* Kruskal 데모와 같은 그래프로 시작
+   *
+   *        (1)
+   *     0 ---- 1
+   *     |   /  |
+   *  (4)|  /(2)|  (3)
+   *     | /    |
+   *     2 ---- 3
+   *     |  (5)
+   *  (6)|
+   *     |
+   *     4
+   */
+  DynamicMST *dm = create_dynamic_mst(5, 10);
+  if (!dm)
+  {
+    fprintf(stderr, "동적 MST 생성 실패\n");
+    return 1;
+  }
+
+  dynamic_mst_insert_edge(dm, 0, 1, 1);
+  dynamic_mst_insert_edge(dm, 0, 2, 4);
+  int e12 = dynamic_mst_insert_edge(dm, 1, 2, 2);
+  dynamic_mst_insert_edge(dm, 1, 3, 3);
+  dynamic_mst_insert_edge(dm, 2, 3, 5);
+  int e24 = dynamic_mst_insert_edge(dm, 2, 4, 6);
+
+  MST *mst = dynamic_mst_snapshot(dm);
+  print_mst(mst);
+  free_mst(mst);
+
+  printf("\n>>> 간선 3-4 (가중치 1) 삽입\n\n");
+  dynamic_mst_insert_edge(dm, 3, 4, 1);
+  mst = dynamic_mst_snapshot(dm);
+  print_mst(mst);
+  free_mst(mst);
+
+  printf("\n>>> 간선 1-2 삭제, 간선 2-4 가중치 6 -> 0\n\n");
+  dynamic_mst_delete_edge(dm, e12);
+  dynamic_mst_update_weight(dm, e24, 0);
+  mst = dynamic_mst_snapshot(dm);
+  print_mst(mst);
+  free_mst(mst);
+
+  free_dynamic_mst(dm);
+
+  /* 벤치마크: 갱신마다 전체 재계산 vs 동적 유지 */
+  printf("\n=== 성능 비교: 갱신마다 전체 재계산 vs 동적 MST ===\n\n");
+
+  int V = 5000;
+  int initial_edges = 20000;
+  int num_updates = 1000;
+  int max_edges = initial_edges + num_updates;
+
+  dm = create_dynamic_mst(V, max_edges);
+  int *live = (int *)malloc(max_edges * sizeof(int));
+  if (!dm || !live)
+  {
+    fprintf(stderr, "벤치마크 준비 실패\n");
+    free_dynamic_mst(dm);
+    free(live);
+    return 1;
+  }
+
+  int num_live = 0;
+  for (int i = 0; i < initial_edges; i++)
+  {
+    live[num_live++] = dynamic_mst_insert_edge(dm, next_random(V), next_random(V),
+                                               next_random(1000) + 1);
+  }
+
+  printf("그래프: 정점 %d개, 초기 간선 %d개, 갱신 %d회\n", V, initial_edges, num_updates);
+  printf("갱신 비율: 삽입 60%%, 가중치 변경 20%%, 삭제 20%%\n\n");
+
+  double dynamic_time = 0;
+  double recompute_time = 0;
+  int insert_count = 0, update_count = 0, delete_count = 0;
+
+  for (int step = 0; step < num_updates; step++)
+  {
+    int op = next_random(10);
+    clock_t start = clock();
+
+    if (op < 6)
+    {
+      live[num_live++] = dynamic_mst_insert_edge(dm, next_random(V), next_random(V),
+                                                 next_random(1000) + 1);
+      insert_count++;
+    }
+    else if (op < 8)
+    {
+      dynamic_mst_update_weight(dm, live[next_random(num_live)], next_random(1000) + 1);
+      update_count++;
+    }
+    else
+    {
+      int k = next_random(num_live);
+      dynamic_mst_delete_edge(dm, live[k]);
+      live[k] = live[--num_live];
+      delete_count++;
+    }
+
+    dynamic_time += (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    /* 기존 방식: 매 갱신 후 MST 전체를 다시 계산 */
+    start = clock();
+    MST *rebuilt = recompute_mst(dm);
+    recompute_time += (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    if (!rebuilt || rebuilt->total_weight != dm->total_weight)
+    {
+      fprintf(stderr, "결과 불일치 (갱신 %d)\n", step);
+      free_mst(rebuilt);
+      free(live);
+      free_dynamic_mst(dm);
+      return 1;
+    }
+    free_mst(rebuilt);
+  }
+
+  printf("삽입 %d회, 가중치 변경 %d회, 삭제 %d회\n\n", insert_count, update_count, delete_count);
+
+  printf("전체 재계산 (Kruskal - O(E log E) / 갱신):\n");
+  printf("  총 실행 시간: %.6f 초\n", recompute_time);
+  printf("  갱신당 평균: %.3f ms\n\n", recompute_time * 1000 / num_updates);
+
+  printf("동적 MST (Link-Cut Tree):\n");
+  printf("  총 실행 시간: %.6f 초\n", dynamic_time);
+  printf("  갱신당 평균: %.3f ms\n\n", dynamic_time * 1000 / num_updates);
+
+  if (dynamic_time > 0)
+  {
+    printf("속도 향상: %.2fx\n", recompute_time / dynamic_time);
+  }
+  printf("최종 MST 총 가중치: %d (두 방식 동일)\n\n", dm->total_weight);
+
+  printf("분석:\n");
+  printf("- 삽입과 트리 밖 간선의 변경은 분할 상환 O(log V)로 처리됨.\n");
+  printf("- MST 간선 삭제/가중치 증가는 대체 간선을 찾기 위해 O(E log V)가 필요함.\n");
+  printf("- 그래도 정렬이 필요한 전체 재계산보다 훨씬 적은 일을 함.\n\n");
+
+  free(live);
+  free_dynamic_mst(dm);
+
+  printf("프로그램 종료\n");
+  return 0;
+}
@@ -0,0 +1,267 @@
+#include "dynamic_mst.h"
+#include <assert.h>
+
+/* 결정적인 랜덤 테스트를 위한 간단한 LCG */
+static unsigned int seed = 12345;
+
+static int next_random(int bound)
+{
+  seed = seed * 1103515245u + 12345u;
+  return (int)((seed >> 8) % (unsigned int)bound);
+}
+
+/* 동적 MST와 전체 재계산 결과의 총 가중치/간선 수가 같은지 확인 */
+static void assert_matches_recompute(DynamicMST *dm)
+{
+  MST *expected = recompute_mst(dm);
+  MST *actual = dynamic_mst_snapshot(dm);
+
+  assert(expected != NULL);
+  assert(actual != NULL);
+  assert(actual->num_edges == expected->num_edges);
+  assert(actual->total_weight == expected->total_weight);
+  assert(dm->num_tree_edges == expected->num_edges);
+  assert(dm->total_weight == expected->total_weight);
+
+  free_mst(expected);
+  free_mst(actual);
+}
+
+/* 테스트 1: 생성 및 해제 */
+void test_creation()
+{
+  printf("테스트 1: 동적 MST 생성 및 해제...\n");
+
+  DynamicMST *dm = create_dynamic_mst(5, 10);
+  assert(dm != NULL);
+  assert(dm->num_vertices == 5);
+  assert(dm->capacity == 10);
+  assert(dm->num_tree_edges == 0);
+  assert(dm->total_weight == 0);
+
+  assert(create_dynamic_mst(0, 10) == NULL);
+  assert(create_dynamic_mst(5, 0) == NULL);
+
+  free_dynamic_mst(dm);
+  printf("  ✓ 통과\n");
+}
+
+/* 테스트 2: 삽입만으로 MST 구성 */
+void test_insert_builds_mst()
+{
+  printf("테스트 2: 간선 삽입으로 MST 구성...\n");
+
+  DynamicMST *dm = create_dynamic_mst(5, 10);
+
+  dynamic_mst_insert_edge(dm, 0, 1, 1);
+  dynamic_mst_insert_edge(dm, 0, 2, 4);
+  dynamic_mst_insert_edge(dm, 1, 2, 2);
+  dynamic_mst_insert_edge(dm, 1, 3, 3);
+  dynamic_mst_insert_edge(dm, 2, 3, 5);
+  dynamic_mst_insert_edge(dm, 2, 4, 6);
+
+  /* 예상 MST: (0-1,1), (1-2,2), (1-3,3), (2-4,6) = 총 12 */
+  assert(dm->num_tree_edges == 4);
+  assert(dm->total_weight == 12);
+  assert_matches_recompute(dm);
+
+  free_dynamic_mst(dm);
+  printf("  ✓ 통과\n");
+}
+
+/* 테스트 3: 사이클을 만드는 더 가벼운 간선은 가장 무거운 간선을 교체 */
+void test_insert_replaces_heaviest()
+{
+  printf("테스트 3: 사이클 위 최대 간선 교체...\n");
+
+  /* 0 - 1 - 2 - 3 경로 (가중치 5, 9, 2) */
+  DynamicMST *dm = create_dynamic_mst(4, 5);
+  dynamic_mst_insert_edge(dm, 0, 1, 5);
+  int heavy = dynamic_mst_insert_edge(dm, 1, 2, 9);
+  dynamic_mst_insert_edge(dm, 2, 3, 2);
+  assert(dm->total_weight == 16);
+
+  /* 0-3 (3) 추가: 경로 위 최대 간선 1-2(9)가 빠져야 함 */
+  int light = dynamic_mst_insert_edge(dm, 0, 3, 3);
+  assert(dm->total_weight == 10);
+  assert(dm->edges[heavy].in_tree == false);
+  assert(dm->edges[light].in_tree == true);
+
+  /* 더 무거운 간선은 MST를 바꾸지 않음 */
+  int ignored = dynamic_mst_insert_edge(dm, 1, 3, 100);
+  assert(dm->total_weight == 10);
+  assert(dm->edges[ignored].in_tree == false);
+
+  free_dynamic_mst(dm);
+  printf("  ✓ 통과\n");
+}
+
+/* 테스트 4: 트리 간선 삭제 시 대체 간선 연결 */
+void test_delete_tree_edge()
+{
+  printf("테스트 4: MST 간선 삭제와 대체 간선...\n");
+
+  /* 정사각형 0-1-2-3-0 */
+  DynamicMST *dm = create_dynamic_mst(4, 4);
+  int e01 = dynamic_mst_insert_edge(dm, 0, 1, 1);
+  dynamic_mst_insert_edge(dm, 1, 2, 2);
+  dynamic_mst_insert_edge(dm, 2, 3, 3);
+  int e30 = dynamic_mst_insert_edge(dm, 3, 0, 4);
+  assert(dm->total_weight == 6);
+  assert(dm->edges[e30].in_tree == false);
+
+  /* 0-1 삭제 -> 3-0(4)이 대신 들어와야 함 */
+  assert(dynamic_mst_delete_edge(dm, e01) == true);
+  assert(dm->total_weight == 9);
+  assert(dm->edges[e30].in_tree == true);
+  assert_matches_recompute(dm);
+
+  /* 이미 삭제된 간선은 다시 삭제할 수 없음 */
+  assert(dynamic_mst_delete_edge(dm, e01) == false);
+
+  free_dynamic_mst(dm);
+  printf("  ✓ 통과\n");
+}
+
+/* 테스트 5: 대체 간선이 없으면 포레스트로 분리 */
+void test_delete_disconnects()
+{
+  printf("테스트 5: 대체 간선이 없는 삭제...\n");
+
+  DynamicMST *dm = create_dynamic_mst(3, 3);
+  dynamic_mst_insert_edge(dm, 0, 1, 5);
+  int bridge = dynamic_mst_insert_edge(dm, 1, 2, 3);
+
+  assert(dynamic_mst_connected(dm, 0, 2) == true);
+  assert(dynamic_mst_delete_edge(dm, bridge) == true);
+  assert(dynamic_mst_connected(dm, 0, 2) == false);
+  assert(dm->num_tree_edges == 1);
+  assert(dm->total_weight == 5);
+
+  free_dynamic_mst(dm);
+  printf("  ✓ 통과\n");
+}
+
+/* 테스트 6: 가중치 변경 (감소/증가, 트리 간선/비트리 간선) */
+void test_update_weight()
+{
+  printf("테스트 6: 가중치 변경...\n");
+
+  /* 삼각형 0-1(1), 1-2(2), 0-2(5) */
+  DynamicMST *dm = create_dynamic_mst(3, 3);
+  int e01 = dynamic_mst_insert_edge(dm, 0, 1, 1);
+  int e12 = dynamic_mst_insert_edge(dm, 1, 2, 2);
+  int e02 = dynamic_mst_insert_edge(dm, 0, 2, 5);
+  assert(dm->total_weight == 3);
+
+  /* 비트리 간선 감소: 0-2가 1-2를 밀어냄 */
+  assert(dynamic_mst_update_weight(dm, e02, 0) == true);
+  assert(dm->total_weight == 1);
+  assert(dm->edges[e12].in_tree == false);
+
+  /* 트리 간선 감소: MST 구조는 그대로 */
+  assert(dynamic_mst_update_weight(dm, e01, -4) == true);
+  assert(dm->total_weight == -4);
+  assert(dm->edges[e01].in_tree == true);
+
+  /* 트리 간선 증가: 1-2(2)가 더 가벼우므로 교체 */
+  assert(dynamic_mst_update_weight(dm, e01, 10) == true);
+  assert(dm->total_weight == 2);
+  assert(dm->edges[e01].in_tree == false);
+  assert(dm->edges[e12].in_tree == true);
+
+  /* 트리 간선 소폭 증가: 대체 간선보다 가벼우면 유지 */
+  assert(dynamic_mst_update_weight(dm, e12, 7) == true);
+  assert(dm->total_weight == 7);
+  assert(dm->edges[e12].in_tree == true);
+  assert_matches_recompute(dm);
+
+  free_dynamic_mst(dm);
+  printf("  ✓ 통과\n");
+}
+
+/* 테스트 7: 간선 id 재사용과 용량 제한 */
+void test_capacity_and_id_reuse()
+{
+  printf("테스트 7: 용량 제한과 id 재사용...\n");
+
+  DynamicMST *dm = create_dynamic_mst(3, 2);
+  int a = dynamic_mst_insert_edge(dm, 0, 1, 1);
+  dynamic_mst_insert_edge(dm, 1, 2, 1);
+
+  /* 용량 초과 */
+  assert(dynamic_mst_insert_edge(dm, 0, 2, 1) == -1);
+
+  /* 잘못된 정점 */
+  assert(dynamic_mst_insert_edge(dm, 0, 3, 1) == -1);
+
+  /* 삭제한 id는 재사용됨 */
+  dynamic_mst_delete_edge(dm, a);
+  assert(dynamic_mst_insert_edge(dm, 0, 2, 4) == a);
+  assert(dm->total_weight == 5);
+
+  free_dynamic_mst(dm);
+  printf("  ✓ 통과\n");
+}
+
+/* 테스트 8: 랜덤 연산 시퀀스를 전체 재계산과 비교 */
+void test_random_operations()
+{
+  printf("테스트 8: 랜덤 삽입/삭제/변경 vs 전체 재계산...\n");
+
+  int V = 30;
+  int max_edges = 120;
+  DynamicMST *dm = create_dynamic_mst(V, max_edges);
+  int *live = (int *)malloc(max_edges * sizeof(int));
+  int num_live = 0;
+
+  for (int step = 0; step < 3000; step++)
+  {
+    int op = next_random(10);
+
+    if (op < 5 || num_live == 0)
+    {
+      int id = dynamic_mst_insert_edge(dm, next_random(V), next_random(V),
+                                       next_random(50) - 10);
+      if (id != -1)
+      {
+        live[num_live++] = id;
+      }
+    }
+    else if (op < 8)
+    {
+      int k = next_random(num_live);
+      assert(dynamic_mst_delete_edge(dm, live[k]) == true);
+      live[k] = live[--num_live];
+    }
+    else
+    {
+      int k = next_random(num_live);
+      assert(dynamic_mst_update_weight(dm, live[k], next_random(50) - 10) == true);
+    }
+
+    assert_matches_recompute(dm);
+  }
+
+  free(live);
+  free_dynamic_mst(dm);
+  printf("  ✓ 통과\n");
+}
+
+int main(void)
+{
+  printf("\n=== 동적 MST 유닛 테스트 시작 ===\n\n");
+
+  test_creation();
+  test_insert_builds_mst();
+  test_insert_replaces_heaviest();
+  test_delete_tree_edge();
+  test_delete_disconnects();
+  test_update_weight();
+  test_capacity_and_id_reuse();
+  test_random_operations();
+
+  printf("\n=== 모든 테스트 통과! ===\n\n");
+
+  return 0;
+}
@@ -0,0 +1,828 @@
+#include "euclidean_mst.h"
+
+/* ========== Union-Find 관련 함수 ========== */
+
+/**
+ * Union-Find 자료구조 생성
+ * @param size: 원소의 개수
+ * @return: 생성된 Union-Find 포인터
+ */
+UnionFind *create_union_find(int size)
+{
+  if (size <= 0)
+  {
+    return NULL;
+  }
+
+  UnionFind *uf = (UnionFind *)malloc(sizeof(UnionFind));
+  if (!uf)
+  {
+    return NULL;
+  }
+
+  uf->parent = (int *)malloc(size * sizeof(int));
+  uf->rank = (int *)malloc(size * sizeof(int));
+
+  if (!uf->parent || !uf->rank)
+  {
+    free(uf->parent);
+    free(uf->rank);
+    free(uf);
+    return NULL;
+  }
+
+  uf->size = size;
+
+  for (int i = 0; i < size; i++)
+  {
+    uf->parent[i] = i;
+    uf->rank[i] = 0;
+  }
+
+  return uf;
+}
+
+/**
+ * Find 연산 (경로 압축, 점이 수백만 개라 재귀 대신 반복문 사용)
+ * @return: 루트 원소
+ */
+int find(UnionFind *uf, int element)
+{
+  if (!uf || element < 0 || element >= uf->size)
+  {
+    return -1;
+  }
+
+  int root = element;
+  while (uf->parent[root] != root)
+  {
+    root = uf->parent[root];
+  }
+
+  /* 경로 압축: 지나온 모든 원소를 루트에 직접 연결 */
+  while (uf->parent[element] != root)
+  {
+    int next = uf->parent[element];
+    uf->parent[element] = root;
+    element = next;
+  }
+
+  return root;
+}
+
+/**
+ * Union 연산 (rank 기반)
+ * @return: 합치기 성공 여부 (이미 같은 집합이면 false)
+ */
+bool union_sets(UnionFind *uf, int x, int y)
+{
+  int root_x = find(uf, x);
+  int root_y = find(uf, y);
+
+  if (root_x == -1 || root_y == -1 || root_x == root_y)
+  {
+    return false;
+  }
+
+  if (uf->rank[root_x] < uf->rank[root_y])
+  {
+    uf->parent[root_x] = root_y;
+  }
+  else if (uf->rank[root_x] > uf->rank[root_y])
+  {
+    uf->parent[root_y] = root_x;
+  }
+  else
+  {
+    uf->parent[root_y] = root_x;
+    uf->rank[root_x]++;
+  }
+
+  return true;
+}
+
+void free_union_find(UnionFind *uf)
+{
+  if (!uf)
+  {
+    return;
+  }
+  free(uf->parent);
+  free(uf->rank);
+  free(uf);
+}
+
+/* ========== k-d 트리 관련 함수 ========== */
+
+static double coord(const KDTree *tree, int point, int d)
+{
+  return tree->points[(size_t)point * tree->dim + d];
+}
+
+static double squared_distance(const KDTree *tree, int a, const double *q)
+{
+  const double *p = &tree->points[(size_t)a * tree->dim];
+  double sum = 0;
+  for (int d = 0; d < tree->dim; d++)
+  {
+    double diff = p[d] - q[d];
+    sum += diff * diff;
+  }
+  return sum;
+}
+
+/**
+ * 점 q에서 노드 바운딩 박스까지의 최소 거리의 제곱
+ * 이 값이 지금까지 찾은 최단 거리보다 크면 노드 전체를 건너뛸 수 있음
+ */
+static double box_distance(const KDTree *tree, const KDNode *node, const double *q)
+{
+  double sum = 0;
+  for (int d = 0; d < tree->dim; d++)
+  {
+    double diff = 0;
+    if (q[d] < node->lo[d])
+    {
+      diff = node->lo[d] - q[d];
+    }
+    else if (q[d] > node->hi[d])
+    {
+      diff = q[d] - node->hi[d];
+    }
+    sum += diff * diff;
+  }
+  return sum;
+}
+
+/**
+ * index[start, end) 구간에서 k번째 원소가 제자리에 오도록 부분 정렬 (quickselect)
+ * 결과: k 왼쪽은 모두 k 이하, 오른쪽은 모두 k 이상 (d축 좌표 기준)
+ */
+static void select_kth(KDTree *tree, int start, int end, int k, int d)
+{
+  int *idx = tree->index;
+  int lo = start;
+  int hi = end - 1;
+
+  while (lo < hi)
+  {
+    /* median-of-3 피벗 */
+    double a = coord(tree, idx[lo], d);
+    double b = coord(tree, idx[lo + (hi - lo) / 2], d);
+    double c = coord(tree, idx[hi], d);
+    double pivot = (a < b) ? ((b < c) ? b : (a < c ? c : a))
+                           : ((a < c) ? a : (b < c ? c : b));
+
+    int i = lo;
+    int j = hi;
+    while (i <= j)
+    {
+      while (coord(tree, idx[i], d) < pivot)
+      {
+        i++;
+      }
+      while (coord(tree, idx[j], d) > pivot)
+      {
+        j--;
+      }
+      if (i <= j)
+      {
+        int temp = idx[i];
+        idx[i] = idx[j];
+        idx[j] = temp;
+        i++;
+        j--;
+      }
+    }
+
+    if (k <= j)
+    {
+      hi = j;
+    }
+    else if (k >= i)
+    {
+      lo = i;
+    }
+    else
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * index[start, end) 구간의 노드를 만들고 필요하면 가장 넓은 축의 중앙값으로 분할
+ * 재귀 깊이는 O(log n)이므로 점이 많아도 안전함
+ * @return: 만든 노드의 인덱스
+ */
+static int build_node(KDTree *tree, int start, int end)
+{
+  int node_id = tree->num_nodes++;
+  KDNode *node = &tree->nodes[node_id];
+
+  node->start = start;
+  node->end = end;
+  node->left = -1;
+  node->right = -1;
+
+  /* 바운딩 박스 계산 */
+  for (int d = 0; d < tree->dim; d++)
+  {
+    node->lo[d] = node->hi[d] = coord(tree, tree->index[start], d);
+  }
+  for (int i = start + 1; i < end; i++)
+  {
+    for (int d = 0; d < tree->dim; d++)
+    {
+      double x = coord(tree, tree->index[i], d);
+      if (x < node->lo[d])
+      {
+        node->lo[d] = x;
+      }
+      if (x > node->hi[d])
+      {
+        node->hi[d] = x;
+      }
+    }
+  }
+
+  if (end - start <= KD_LEAF_SIZE)
+  {
+    return node_id;
+  }
+
+  /* 가장 넓게 퍼진 축을 기준으로 절반씩 나눔 */
+  int split = 0;
+  for (int d = 1; d < tree->dim; d++)
+  {
+    if (node->hi[d] - node->lo[d] > node->hi[split] - node->lo[split])
+    {
+      split = d;
+    }
+  }
+
+  int mid = start + (end - start) / 2;
+  select_kth(tree, start, end, mid, split);
+
+  int left = build_node(tree, start, mid);
+  int right = build_node(tree, mid, end);
+
+  /* 재귀 중에는 포인터가 아닌 인덱스로 다시 접근 */
+  tree->nodes[node_id].left = left;
+  tree->nodes[node_id].right = right;
+
+  return node_id;
+}
+
+/**
+ * k-d 트리 생성
+ * @param points: 점 좌표 배열 (points[i * dim + d]), 트리가 사용하는 동안 유지되어야 함
+ * @param num_points: 점의 개수
+ * @param dim: 차원 (1 ~ EMST_MAX_DIM)
+ * @return: 생성된 k-d 트리 포인터
+ *
+ * 시간 복잡도: O(n log n)
+ */
+KDTree *build_kd_tree(const double *points, int num_points, int dim)
+{
+  if (!points || num_points <= 0 || dim < 1 || dim > EMST_MAX_DIM)
+  {
+    return NULL;
+  }
+
+  KDTree *tree = (KDTree *)malloc(sizeof(KDTree));
+  if (!tree)
+  {
+    return NULL;
+  }
+
+  /* 분할된 리프는 최소 (KD_LEAF_SIZE + 1) / 2개의 점을 가지므로 노드 수 상한을 미리 계산 */
+  int max_leaves = num_points / ((KD_LEAF_SIZE + 1) / 2) + 1;
+
+  tree->index = (int *)malloc(num_points * sizeof(int));
+  tree->nodes = (KDNode *)malloc(2 * max_leaves * sizeof(KDNode));
+
+  if (!tree->index || !tree->nodes)
+  {
+    free(tree->index);
+    free(tree->nodes);
+    free(tree);
+    return NULL;
+  }
+
+  tree->dim = dim;
+  tree->num_points = num_points;
+  tree->points = points;
+  tree->num_nodes = 0;
+
+  for (int i = 0; i < num_points; i++)
+  {
+    tree->index[i] = i;
+  }
+
+  build_node(tree, 0, num_points);
+
+  return tree;
+}
+
+/**
+ * 가장 가까운 점 찾기
+ * @param tree: k-d 트리 포인터
+ * @param query: 질의 좌표 (dim개)
+ * @param distance: 찾은 점까지의 거리 (NULL 가능)
+ * @return: 가장 가까운 점 번호
+ */
+int kd_nearest(KDTree *tree, const double *query, double *distance)
+{
+  if (!tree || !query)
+  {
+    return -1;
+  }
+
+  int best = -1;
+  double best_dist = INFINITY;
+
+  /* 트리 깊이는 O(log n)이라 고정 크기 스택으로 충분 */
+  int stack[128];
+  int top = 0;
+  stack[top++] = 0;
+
+  while (top > 0)
+  {
+    KDNode *node = &tree->nodes[stack[--top]];
+
+    if (box_distance(tree, node, query) >= best_dist)
+    {
+      continue;
+    }
+
+    if (node->left == -1)
+    {
+      for (int i = node->start; i < node->end; i++)
+      {
+        double dist = squared_distance(tree, tree->index[i], query);
+        if (dist < best_dist)
+        {
+          best_dist = dist;
+          best = tree->index[i];
+        }
+      }
+      continue;
+    }
+
+    /* 가까운 자식을 먼저 꺼내도록 먼 자식을 먼저 넣음 */
+    int near_child = node->left;
+    int far_child = node->right;
+    if (box_distance(tree, &tree->nodes[far_child], query) <
+        box_distance(tree, &tree->nodes[near_child], query))
+    {
+      near_child = node->right;
+      far_child = node->left;
+    }
+    stack[top++] = far_child;
+    stack[top++] = near_child;
+  }
+
+  if (distance)
+  {
+    *distance = sqrt(best_dist);
+  }
+
+  return best;
+}
+
+void free_kd_tree(KDTree *tree)
+{
+  if (!tree)
+  {
+    return;
+  }
+  free(tree->index);
+  free(tree->nodes);
+  free(tree);
+}
+
+/* ========== 유클리드 MST (Borůvka + k-d 트리) ========== */
+
+/* 한 라운드에서 컴포넌트가 고른 후보 간선 */
+typedef struct Candidate
+{
+  double dist; /* 거리의 제곱 */
+  int a;       /* 작은 점 번호 */
+  int b;       /* 큰 점 번호 */
+} Candidate;
+
+/* Borůvka 라운드 동안 공유하는 상태 */
+typedef struct BoruvkaState
+{
+  KDTree *tree;
+  int *comp;           /* comp[p] = 점 p가 속한 컴포넌트 (Union-Find 루트) */
+  int *node_comp;      /* 노드의 모든 점이 같은 컴포넌트면 그 번호, 아니면 -1 */
+  Candidate *best;     /* best[c] = 컴포넌트 c에서 밖으로 나가는 최단 간선 */
+  long long distance_computations;
+} BoruvkaState;
+
+/**
+ * 간선 순서 비교 (거리, 작은 점 번호, 큰 점 번호 순)
+ * 거리가 같은 간선이 있어도 항상 같은 순서를 정해야 Borůvka가 사이클 없이 정확함
+ */
+static bool candidate_less(double dist, int a, int b, const Candidate *other)
+{
+  if (dist != other->dist)
+  {
+    return dist < other->dist;
+  }
+  if (a != other->a)
+  {
+    return a < other->a;
+  }
+  return b < other->b;
+}
+
+static int compare_candidates(const void *x, const void *y)
+{
+  const Candidate *cx = (const Candidate *)x;
+  const Candidate *cy = (const Candidate *)y;
+
+  if (candidate_less(cx->dist, cx->a, cx->b, cy))
+  {
+    return -1;
+  }
+  if (candidate_less(cy->dist, cy->a, cy->b, cx))
+  {
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * 점 q에서 다른 컴포넌트에 속한 가장 가까운 점 찾기
+ * - 노드 전체가 q와 같은 컴포넌트면 건너뜀
+ * - q의 컴포넌트가 이미 찾은 최단 간선을 상한으로 사용해 더 많이 가지치기
+ */
+static void nearest_other_component(BoruvkaState *state, int q)
+{
+  KDTree *tree = state->tree;
+  int cq = state->comp[q];
+  const double *qp = &tree->points[(size_t)q * tree->dim];
+  Candidate *best = &state->best[cq];
+
+  int stack[128];
+  double stack_dist[128];
+  int top = 0;
+
+  stack[top] = 0;
+  stack_dist[top] = box_distance(tree, &tree->nodes[0], qp);
+  top++;
+
+  while (top > 0)
+  {
+    top--;
+    int node_id = stack[top];
+    KDNode *node = &tree->nodes[node_id];
+
+    if (state->node_comp[node_id] == cq || stack_dist[top] > best->dist)
+    {
+      continue;
+    }
+
+    if (node->left == -1)
+    {
+      for (int i = node->start; i < node->end; i++)
+      {
+        int p = tree->index[i];
+        if (state->comp[p] == cq)
+        {
+          continue;
+        }
+
+        double dist = squared_distance(tree, p, qp);
+        state->distance_computations++;
+
+        int a = (q < p) ? q : p;
+        int b = (q < p) ? p : q;
+        if (candidate_less(dist, a, b, best))
+        {
+          best->dist = dist;
+          best->a = a;
+          best->b = b;
+        }
+      }
+      continue;
+    }
+
+    double left_dist = box_distance(tree, &tree->nodes[node->left], qp);
+    double right_dist = box_distance(tree, &tree->nodes[node->right], qp);
+
+    /* 가까운 자식을 먼저 꺼내도록 먼 자식을 먼저 넣음 */
+    if (left_dist <= right_dist)
+    {
+      stack[top] = node->right;
+      stack_dist[top++] = right_dist;
+      stack[top] = node->left;
+      stack_dist[top++] = left_dist;
+    }
+    else
+    {
+      stack[top] = node->left;
+      stack_dist[top++] = left_dist;
+      stack[top] = node->right;
+      stack_dist[top++] = right_dist;
+    }
+  }
+}
+
+/**
+ * 노드별 컴포넌트 정보 갱신 (부모가 자식보다 앞에 있으므로 뒤에서부터 계산)
+ */
+static void update_node_components(BoruvkaState *state)
+{
+  KDTree *tree = state->tree;
+
+  for (int node_id = tree->num_nodes - 1; node_id >= 0; node_id--)
+  {
+    KDNode *node = &tree->nodes[node_id];
+    int c;
+
+    if (node->left == -1)
+    {
+      c = state->comp[tree->index[node->start]];
+      for (int i = node->start + 1; i < node->end && c != -1; i++)
+      {
+        if (state->comp[tree->index[i]] != c)
+        {
+          c = -1;
+        }
+      }
+    }
+    else
+    {
+      int left = state->node_comp[node->left];
+      c = (left == state->node_comp[node->right]) ? left : -1;
+    }
+
+    state->node_comp[node_id] = c;
+  }
+}
+
+/**
+ * 유클리드 최소 신장 트리
+ * @param points: 점 좌표 배열 (points[i * dim + d])
+ * @param num_points: 점의 개수
+ * @param dim: 차원 (1 ~ EMST_MAX_DIM)
+ * @param perf: 성능 측정 결과 (NULL 가능)
+ * @return: MST 결과 (호출자가 free_mst로 해제해야 함)
+ *
+ * 완전 그래프(n² 간선)를 만들지 않고 Borůvka 방식으로 진행:
+ * 1. 각 컴포넌트가 k-d 트리로 "밖으로 나가는 가장 짧은 간선"을 찾음
+ * 2. 이 후보 간선들만 정렬해 Kruskal처럼 Union-Find로 합침
+ * 3. 컴포넌트가 하나가 될 때까지 반복 (라운드마다 컴포넌트 수가 절반 이하)
+ *
+ * 메모리: O(n), 라운드 수: O(log n)
+ */
+MST *euclidean_mst(const double *points, int num_points, int dim, Performance *perf)
+{
+  if (!points || num_points <= 0 || dim < 1 || dim > EMST_MAX_DIM)
+  {
+    return NULL;
+  }
+
+  clock_t start = clock();
+
+  BoruvkaState state;
+  state.tree = build_kd_tree(points, num_points, dim);
+  state.comp = (int *)malloc(num_points * sizeof(int));
+  state.node_comp = state.tree ? (int *)malloc(state.tree->num_nodes * sizeof(int)) : NULL;
+  state.best = (Candidate *)malloc(num_points * sizeof(Candidate));
+  state.distance_computations = 0;
+
+  Candidate *candidates = (Candidate *)malloc(num_points * sizeof(Candidate));
+  UnionFind *uf = create_union_find(num_points);
+  MST *mst = (MST *)malloc(sizeof(MST));
+  Edge *edges = (Edge *)malloc(num_points * sizeof(Edge));
+
+  if (!state.tree || !state.comp || !state.node_comp || !state.best ||
+      !candidates || !uf || !mst || !edges)
+  {
+    free_kd_tree(state.tree);
+    free(state.comp);
+    free(state.node_comp);
+    free(state.best);
+    free(candidates);
+    free_union_find(uf);
+    free(mst);
+    free(edges);
+    return NULL;
+  }
+
+  mst->edges = edges;
+  mst->num_edges = 0;
+  mst->total_weight = 0;
+
+  int rounds = 0;
+
+  while (mst->num_edges < num_points - 1)
+  {
+    rounds++;
+
+    for (int p = 0; p < num_points; p++)
+    {
+      state.comp[p] = find(uf, p);
+      state.best[p].dist = INFINITY;
+      state.best[p].a = -1;
+      state.best[p].b = -1;
+    }
+    update_node_components(&state);
+
+    /* 트리 순서로 질의하면 이웃한 점들이 연달아 처리되어 캐시와 상한이 모두 유리함 */
+    for (int i = 0; i < num_points; i++)
+    {
+      nearest_other_component(&state, state.tree->index[i]);
+    }
+
+    /* 각 컴포넌트의 최단 간선을 모아 Kruskal 방식으로 합침 */
+    int num_candidates = 0;
+    for (int c = 0; c < num_points; c++)
+    {
+      if (state.comp[c] == c && state.best[c].a != -1)
+      {
+        candidates[num_candidates++] = state.best[c];
+      }
+    }
+
+    qsort(candidates, num_candidates, sizeof(Candidate), compare_candidates);
+
+    int merged = 0;
+    for (int i = 0; i < num_candidates; i++)
+    {
+      /* 두 컴포넌트가 같은 간선을 고른 경우 두 번째는 사이클이므로 거부됨 */
+      if (union_sets(uf, candidates[i].a, candidates[i].b))
+      {
+        double weight = sqrt(candidates[i].dist);
+        mst->edges[mst->num_edges].src = candidates[i].a;
+        mst->edges[mst->num_edges].dest = candidates[i].b;
+        mst->edges[mst->num_edges].weight = weight;
+        mst->total_weight += weight;
+        mst->num_edges++;
+        merged++;
+      }
+    }
+
+    if (merged == 0)
+    {
+      break;
+    }
+  }
+
+  clock_t end = clock();
+
+  if (perf)
+  {
+    perf->execution_time = ((double)(end - start)) / CLOCKS_PER_SEC;
+    perf->rounds = rounds;
+    perf->distance_computations = state.distance_computations;
+  }
+
+  free_kd_tree(state.tree);
+  free(state.comp);
+  free(state.node_comp);
+  free(state.best);
+  free(candidates);
+  free_union_find(uf);
+
+  return mst;
+}
+
+/**
+ * 비교용 O(n²) Prim
+ * 완전 그래프의 간선을 저장하지 않고 필요할 때마다 거리를 계산 (메모리 O(n))
+ */
+MST *naive_euclidean_mst(const double *points, int num_points, int dim)
+{
+  if (!points || num_points <= 0 || dim < 1 || dim > EMST_MAX_DIM)
+  {
+    return NULL;
+  }
+
+  double *key = (double *)malloc(num_points * sizeof(double));
+  int *parent = (int *)malloc(num_points * sizeof(int));
+  bool *in_mst = (bool *)malloc(num_points * sizeof(bool));
+  MST *mst = (MST *)malloc(sizeof(MST));
+  Edge *edges = (Edge *)malloc(num_points * sizeof(Edge));
+
+  if (!key || !parent || !in_mst || !mst || !edges)
+  {
+    free(key);
+    free(parent);
+    free(in_mst);
+    free(mst);
+    free(edges);
+    return NULL;
+  }
+
+  for (int i = 0; i < num_points; i++)
+  {
+    key[i] = INFINITY;
+    parent[i] = -1;
+    in_mst[i] = false;
+  }
+  key[0] = 0;
+
+  mst->edges = edges;
+  mst->num_edges = 0;
+  mst->total_weight = 0;
+
+  for (int count = 0; count < num_points; count++)
+  {
+    int u = -1;
+    for (int v = 0; v < num_points; v++)
+    {
+      if (!in_mst[v] && (u == -1 || key[v] < key[u]))
+      {
+        u = v;
+      }
+    }
+
+    in_mst[u] = true;
+
+    if (parent[u] != -1)
+    {
+      double weight = sqrt(key[u]);
+      mst->edges[mst->num_edges].src = parent[u];
+      mst->edges[mst->num_edges].dest = u;
+      mst->edges[mst->num_edges].weight = weight;
+      mst->total_weight += weight;
+      mst->num_edges++;
+    }
+
+    const double *pu = &points[(size_t)u * dim];
+    for (int v = 0; v < num_points; v++)
+    {
+      if (in_mst[v])
+      {
+        continue;
+      }
+
+      const double *pv = &points[(size_t)v * dim];
+      double dist = 0;
+      for (int d = 0; d < dim; d++)
+      {
+        dist += (pu[d] - pv[d]) * (pu[d] - pv[d]);
+      }
+
+      if (dist < key[v])
+      {
+        key[v] = dist;
+        parent[v] = u;
+      }
+    }
+  }
+
+  free(key);
+  free(parent);
+  free(in_mst);
+
+  return mst;
+}
+
+/* ========== MST 관련 함수 ========== */
+
+/**
+ * MST 결과 출력
+ * @param mst: MST 포인터
+ */
+void print_mst(MST *mst)
+{
+  if (!mst)
+  {
+    printf("MST가 존재하지 않습니다.\n");
+    return;
+  }
+
+  printf("최소 신장 트리 (MST):\n");
+  printf("간선\t\t거리\n");
+
+  for (int i = 0; i < mst->num_edges; i++)
+  {
+    printf("%d - %d\t\t%.4f\n",
+           mst->edges[i].src,
+           mst->edges[i].dest,
+           mst->edges[i].weight);
+  }
+
+  printf("\n총 가중치: %.4f\n", mst->total_weight);
+}
+
+/**
+ * MST 메모리 해제
+ * @param mst: 해제할 MST 포인터
+ */
+void free_mst(MST *mst)
+{
+  if (!mst)
+  {
+    return;
+  }
+  free(mst->edges);
+  free(mst);
+}
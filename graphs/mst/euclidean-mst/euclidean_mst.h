@@ -0,0 +1,91 @@
+#ifndef EUCLIDEAN_MST_H
+#define EUCLIDEAN_MST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+
+/* 지원하는 최대 차원 (2D, 3D) */
+#define EMST_MAX_DIM 3
+
+/* k-d 트리 리프 노드가 가질 수 있는 최대 점 개수 */
+#define KD_LEAF_SIZE 8
+
+/* 간선 구조체 (가중치 = 두 점 사이의 유클리드 거리) */
+typedef struct Edge
+{
+  int src;       /* 시작 점 */
+  int dest;      /* 도착 점 */
+  double weight; /* 거리 */
+} Edge;
+
+/* MST 결과 구조체 */
+typedef struct MST
+{
+  Edge *edges;         /* MST를 구성하는 간선들 */
+  int num_edges;       /* MST 간선의 개수 */
+  double total_weight; /* MST의 총 가중치 */
+} MST;
+
+/* Union-Find (Disjoint Set) 구조체 */
+typedef struct UnionFind
+{
+  int *parent; /* 부모 노드 배열 */
+  int *rank;   /* 트리의 높이 (union by rank 최적화용) */
+  int size;    /* 원소의 개수 */
+} UnionFind;
+
+/* k-d 트리 노드 (자식은 nodes 배열의 인덱스, 리프면 -1) */
+typedef struct KDNode
+{
+  double lo[EMST_MAX_DIM]; /* 바운딩 박스 최솟값 */
+  double hi[EMST_MAX_DIM]; /* 바운딩 박스 최댓값 */
+  int start;               /* index 배열에서 담당 구간 시작 */
+  int end;                 /* 담당 구간 끝 (포함하지 않음) */
+  int left;
+  int right;
+} KDNode;
+
+/* k-d 트리 구조체 */
+typedef struct KDTree
+{
+  int dim;              /* 차원 (2 또는 3) */
+  int num_points;       /* 점의 개수 */
+  const double *points; /* 점 좌표 (points[i * dim + d], 호출자 소유) */
+  int *index;           /* 트리 순서로 정렬된 점 번호 */
+  KDNode *nodes;        /* 노드 배열 (부모가 항상 자식보다 앞에 있음) */
+  int num_nodes;
+} KDTree;
+
+/* 성능 측정 구조체 */
+typedef struct Performance
+{
+  double execution_time;           /* 실행 시간 (초) */
+  int rounds;                      /* Borůvka 라운드 수 */
+  long long distance_computations; /* 점 사이 거리 계산 횟수 */
+} Performance;
+
+/* Union-Find 관련 함수 */
+UnionFind *create_union_find(int size);
+int find(UnionFind *uf, int element);
+bool union_sets(UnionFind *uf, int x, int y);
+void free_union_find(UnionFind *uf);
+
+/* k-d 트리 관련 함수 */
+KDTree *build_kd_tree(const double *points, int num_points, int dim);
+int kd_nearest(KDTree *tree, const double *query, double *distance);
+void free_kd_tree(KDTree *tree);
+
+/* 유클리드 MST (k-d 트리 + Borůvka - O(n log² n) 정도) */
+MST *euclidean_mst(const double *points, int num_points, int dim, Performance *perf);
+
+/* 비교용: 완전 그래프를 만들지 않는 O(n²) Prim */
+MST *naive_euclidean_mst(const double *points, int num_points, int dim);
+
+/* MST 관련 함수 */
+void print_mst(MST *mst);
+void free_mst(MST *mst);
+
+#endif
@@ -0,0 +1,124 @@
+#include "euclidean_mst.h"
+
+/* 벤치마크용 간단한 LCG */
+static unsigned int seed = 2025;
+
+static double *random_points(int n, int dim)
+{
+  double *points = (double *)malloc((size_t)n * dim * sizeof(double));
+  if (!points)
+  {
+    return NULL;
+  }
+
+  for (size_t i = 0; i < (size_t)n * dim; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    points[i] = (double)(seed >> 8) / (double)(1u << 24);
+  }
+  return points;
+}
+
+static void run_large(int n, int dim)
+{
+  double *points = random_points(n, dim);
+  if (!points)
+  {
+    fprintf(stderr, "점 생성 실패\n");
+    return;
+  }
+
+  Performance perf;
+  MST *mst = euclidean_mst(points, n, dim, &perf);
+
+  if (mst)
+  {
+    /* 완전 그래프라면 간선 n(n-1)/2개 × 16바이트 */
+    double complete_gb = (double)n * (n - 1) / 2 * sizeof(Edge) / 1e9;
+
+    printf("%dD 점 %d개:\n", dim, n);
+    printf("  실행 시간: %.3f 초\n", perf.execution_time);
+    printf("  Borůvka 라운드: %d 회\n", perf.rounds);
+    printf("  점당 거리 계산: %.1f 회\n", (double)perf.distance_computations / n);
+    printf("  MST 간선: %d개, 총 길이: %.4f\n", mst->num_edges, mst->total_weight);
+    printf("  (완전 그래프로 만들었다면 간선 저장에만 약 %.0f GB 필요)\n\n", complete_gb);
+    free_mst(mst);
+  }
+
+  free(points);
+}
+
+int main(void)
+{
+  printf("=== 유클리드 MST (k-d 트리 + Borůvka) 데모 ===\n\n");
+
+  /*
+   * (0,2) ---- (2,2)
+   *   |  \    /  |
+   *   |  (1,1)   |
+   *   |  /    \  |
+   * (0,0) ---- (2,0)        + 멀리 떨어진 (5,1)
+   */
+  double points[] = {
+      0, 0,
+      2, 0,
+      2, 2,
+      0, 2,
+      1, 1,
+      5, 1};
+
+  printf("입력 점 (2D):\n");
+  for (int i = 0; i < 6; i++)
+  {
+    printf("  %d: (%.0f, %.0f)\n", i, points[i * 2], points[i * 2 + 1]);
+  }
+  printf("\n");
+
+  MST *mst = euclidean_mst(points, 6, 2, NULL);
+  if (!mst)
+  {
+    fprintf(stderr, "MST 계산 실패\n");
+    return 1;
+  }
+  print_mst(mst);
+  free_mst(mst);
+
+  /* O(n²) Prim과 비교 */
+  printf("\n=== 성능 비교: O(n²) Prim vs k-d 트리 Borůvka ===\n\n");
+
+  int n = 20000;
+  double *cloud = random_points(n, 2);
+  if (cloud)
+  {
+    clock_t start = clock();
+    MST *naive = naive_euclidean_mst(cloud, n, 2);
+    double naive_time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    Performance perf;
+    MST *fast = euclidean_mst(cloud, n, 2, &perf);
+
+    if (naive && fast)
+    {
+      printf("2D 점 %d개\n", n);
+      printf("  O(n²) Prim:        %.3f 초 (총 길이 %.6f)\n", naive_time, naive->total_weight);
+      printf("  k-d 트리 Borůvka:  %.3f 초 (총 길이 %.6f)\n", perf.execution_time, fast->total_weight);
+      if (perf.execution_time > 0)
+      {
+        printf("  속도 향상: %.1fx\n", naive_time / perf.execution_time);
+      }
+      printf("\n");
+    }
+
+    free_mst(naive);
+    free_mst(fast);
+    free(cloud);
+  }
+
+  /* 대규모 점 집합: 메모리 O(n)으로 처리 */
+  printf("=== 대규모 점 집합 ===\n\n");
+  run_large(1000000, 2);
+  run_large(1000000, 3);
+
+  printf("프로그램 종료\n");
+  return 0;
+}
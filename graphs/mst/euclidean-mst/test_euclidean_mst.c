@@ -0,0 +1,209 @@
+#include "euclidean_mst.h"
+#include <assert.h>
+
+/* 결정적인 랜덤 점 생성을 위한 간단한 LCG */
+static unsigned int seed = 4242;
+
+static double next_random(void)
+{
+  seed = seed * 1103515245u + 12345u;
+  return (double)((seed >> 8) % 100000) / 100.0;
+}
+
+static double *random_points(int n, int dim)
+{
+  double *points = (double *)malloc((size_t)n * dim * sizeof(double));
+  for (int i = 0; i < n * dim; i++)
+  {
+    points[i] = next_random();
+  }
+  return points;
+}
+
+/* 두 MST의 총 가중치가 (부동소수점 오차 범위 안에서) 같은지 확인 */
+static void assert_same_weight(MST *a, MST *b)
+{
+  assert(a->num_edges == b->num_edges);
+  assert(fabs(a->total_weight - b->total_weight) <= 1e-9 * (1.0 + b->total_weight));
+}
+
+/* 테스트 1: Union-Find */
+void test_union_find()
+{
+  printf("테스트 1: Union-Find...\n");
+
+  UnionFind *uf = create_union_find(5);
+  assert(uf != NULL);
+
+  assert(union_sets(uf, 0, 1) == true);
+  assert(union_sets(uf, 2, 3) == true);
+  assert(union_sets(uf, 1, 3) == true);
+  assert(union_sets(uf, 0, 2) == false);
+  assert(find(uf, 0) == find(uf, 3));
+  assert(find(uf, 4) == 4);
+  assert(find(uf, 5) == -1);
+
+  free_union_find(uf);
+  printf("  ✓ 통과\n");
+}
+
+/* 테스트 2: k-d 트리 최근접 점 vs 전수 조사 */
+void test_kd_nearest()
+{
+  printf("테스트 2: k-d 트리 최근접 점...\n");
+
+  int n = 1000;
+  double *points = random_points(n, 2);
+  KDTree *tree = build_kd_tree(points, n, 2);
+  assert(tree != NULL);
+  assert(tree->num_nodes > 1);
+
+  for (int t = 0; t < 200; t++)
+  {
+    double query[2] = {next_random(), next_random()};
+
+    double best = INFINITY;
+    for (int i = 0; i < n; i++)
+    {
+      double dx = points[i * 2] - query[0];
+      double dy = points[i * 2 + 1] - query[1];
+      double dist = sqrt(dx * dx + dy * dy);
+      if (dist < best)
+      {
+        best = dist;
+      }
+    }
+
+    double found;
+    int index = kd_nearest(tree, query, &found);
+    assert(index >= 0 && index < n);
+    assert(found == best);
+  }
+
+  free_kd_tree(tree);
+  free(points);
+  printf("  ✓ 통과\n");
+}
+
+/* 테스트 3: 작은 예제 (정사각형 + 중심) */
+void test_small_example()
+{
+  printf("테스트 3: 정사각형 네 꼭짓점과 중심...\n");
+
+  double points[] = {
+      0, 0,
+      2, 0,
+      2, 2,
+      0, 2,
+      1, 1};
+
+  MST *mst = euclidean_mst(points, 5, 2, NULL);
+  assert(mst != NULL);
+  assert(mst->num_edges == 4);
+
+  /* 중심에서 네 꼭짓점으로 가는 간선 (각 √2) */
+  assert(fabs(mst->total_weight - 4 * sqrt(2.0)) < 1e-12);
+
+  free_mst(mst);
+  printf("  ✓ 통과\n");
+}
+
+/* 테스트 4: 랜덤 2D/3D 점 vs O(n²) Prim */
+void test_random_vs_naive()
+{
+  printf("테스트 4: 랜덤 2D/3D 점 vs O(n²) Prim...\n");
+
+  for (int dim = 1; dim <= 3; dim++)
+  {
+    int n = 700;
+    double *points = random_points(n, dim);
+
+    Performance perf;
+    MST *fast = euclidean_mst(points, n, dim, &perf);
+    MST *naive = naive_euclidean_mst(points, n, dim);
+
+    assert(fast != NULL && naive != NULL);
+    assert(fast->num_edges == n - 1);
+    assert_same_weight(fast, naive);
+    assert(perf.rounds >= 1);
+    assert(perf.distance_computations > 0);
+
+    free_mst(fast);
+    free_mst(naive);
+    free(points);
+  }
+
+  printf("  ✓ 통과\n");
+}
+
+/* 테스트 5: 거리가 같은 간선이 많은 격자와 중복 점 */
+void test_ties_and_duplicates()
+{
+  printf("테스트 5: 격자(동일 거리)와 중복 점...\n");
+
+  /* 20 x 20 격자: 모든 인접 간선 길이가 1 */
+  int side = 20;
+  double *grid = (double *)malloc(side * side * 2 * sizeof(double));
+  for (int i = 0; i < side * side; i++)
+  {
+    grid[i * 2] = i % side;
+    grid[i * 2 + 1] = i / side;
+  }
+
+  MST *mst = euclidean_mst(grid, side * side, 2, NULL);
+  assert(mst->num_edges == side * side - 1);
+  assert(mst->total_weight == side * side - 1);
+  free_mst(mst);
+  free(grid);
+
+  /* 같은 위치의 점 세 개 + 떨어진 점 하나 */
+  double dup[] = {5, 5, 5, 5, 5, 5, 8, 9};
+  mst = euclidean_mst(dup, 4, 2, NULL);
+  assert(mst->num_edges == 3);
+  assert(fabs(mst->total_weight - 5.0) < 1e-12);
+  free_mst(mst);
+
+  printf("  ✓ 통과\n");
+}
+
+/* 테스트 6: 경계 조건 */
+void test_edge_cases()
+{
+  printf("테스트 6: 경계 조건...\n");
+
+  double one[] = {1, 2, 3};
+  MST *mst = euclidean_mst(one, 1, 3, NULL);
+  assert(mst != NULL);
+  assert(mst->num_edges == 0);
+  assert(mst->total_weight == 0);
+  free_mst(mst);
+
+  double two[] = {0, 0, 0, 3, 4, 0};
+  mst = euclidean_mst(two, 2, 3, NULL);
+  assert(mst->num_edges == 1);
+  assert(mst->total_weight == 5.0);
+  free_mst(mst);
+
+  assert(euclidean_mst(NULL, 5, 2, NULL) == NULL);
+  assert(euclidean_mst(two, 0, 2, NULL) == NULL);
+  assert(euclidean_mst(two, 2, 4, NULL) == NULL);
+  assert(build_kd_tree(two, 2, 0) == NULL);
+
+  printf("  ✓ 통과\n");
+}
+
+int main(void)
+{
+  printf("\n=== 유클리드 MST 유닛 테스트 시작 ===\n\n");
+
+  test_union_find();
+  test_kd_nearest();
+  test_small_example();
+  test_random_vs_naive();
+  test_ties_and_duplicates();
+  test_edge_cases();
+
+  printf("\n=== 모든 테스트 통과! ===\n\n");
+
+  return 0;
+}
@@ -0,0 +1,485 @@
+#include "improved_prim.h"
+#include <stdatomic.h>
+
+/*
+ * Dense Prim: 인접 행렬 + SIMD
+ *
+ * 완전 그래프처럼 E ≈ V²인 경우 힙을 쓰는 O((V+E) log V)보다
+ * 기본 Prim의 O(V²)가 오히려 유리함. 남은 비용은 매 단계의
+ * 1) 최소 key 찾기  2) 한 행(row)으로 key 갱신  두 번의 선형 스캔뿐이므로
+ * 이 두 스캔을 SIMD로 한 번에 여러 정점씩 처리함.
+ *
+ * x86 + GCC/Clang에서는 target 속성으로 SSE2/AVX2 커널을 함께 컴파일하고,
+ * 실행 시 CPU가 지원하는 커널을 고름 (그 외 환경은 일반 반복문만 사용).
+ */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DENSE_PRIM_X86 1
+#include <immintrin.h>
+#endif
+
+/* 커널 함수 타입 */
+typedef int (*FindMinFn)(const int *key, int n);
+typedef void (*RelaxFn)(const int *row, int *key, int *parent, const int *done, int n, int u);
+
+/* ========== 일반 반복문 커널 ========== */
+
+/**
+ * 최소 key를 가진 정점 찾기
+ * MST에 포함된 정점은 key가 INT_MAX로 바뀌어 있어 in_mst 검사가 필요 없음
+ * @return: 최소 key의 인덱스, 남은 정점이 모두 도달 불가면 -1
+ */
+static int find_min_scalar(const int *key, int n)
+{
+  int min = INT_MAX;
+  int min_index = -1;
+
+  for (int v = 0; v < n; v++)
+  {
+    if (key[v] < min)
+    {
+      min = key[v];
+      min_index = v;
+    }
+  }
+
+  return min_index;
+}
+
+/**
+ * u의 행으로 key 갱신
+ * done[v]는 MST에 포함되면 -1 (모든 비트 1), 아니면 0
+ */
+static void relax_scalar(const int *row, int *key, int *parent, const int *done, int n, int u)
+{
+  for (int v = 0; v < n; v++)
+  {
+    if (!done[v] && row[v] < key[v])
+    {
+      key[v] = row[v];
+      parent[v] = u;
+    }
+  }
+}
+
+#ifdef DENSE_PRIM_X86
+
+/* ========== SSE2 커널 (정수 4개씩) ========== */
+
+__attribute__((target("sse2"))) static int find_min_sse2(const int *key, int n)
+{
+  /* 1단계: 최솟값 구하기 (SSE2에는 32비트 min이 없어서 비교 + 마스크로 선택) */
+  __m128i vmin = _mm_set1_epi32(INT_MAX);
+  for (int i = 0; i < n; i += 4)
+  {
+    __m128i k = _mm_loadu_si128((const __m128i *)(key + i));
+    __m128i less = _mm_cmplt_epi32(k, vmin);
+    vmin = _mm_or_si128(_mm_and_si128(less, k), _mm_andnot_si128(less, vmin));
+  }
+
+  int lanes[4];
+  _mm_storeu_si128((__m128i *)lanes, vmin);
+  int min = lanes[0];
+  for (int i = 1; i < 4; i++)
+  {
+    if (lanes[i] < min)
+    {
+      min = lanes[i];
+    }
+  }
+
+  if (min == INT_MAX)
+  {
+    return -1;
+  }
+
+  /* 2단계: 최솟값이 처음 나오는 위치 찾기 */
+  __m128i target = _mm_set1_epi32(min);
+  for (int i = 0; i < n; i += 4)
+  {
+    __m128i k = _mm_loadu_si128((const __m128i *)(key + i));
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(k, target)));
+    if (mask)
+    {
+      return i + __builtin_ctz(mask);
+    }
+  }
+
+  return -1;
+}
+
+__attribute__((target("sse2"))) static void relax_sse2(const int *row, int *key, int *parent,
+                                                     const int *done, int n, int u)
+{
+  __m128i vu = _mm_set1_epi32(u);
+
+  for (int i = 0; i < n; i += 4)
+  {
+    __m128i w = _mm_loadu_si128((const __m128i *)(row + i));
+    __m128i k = _mm_loadu_si128((const __m128i *)(key + i));
+    __m128i p = _mm_loadu_si128((const __m128i *)(parent + i));
+    __m128i d = _mm_loadu_si128((const __m128i *)(done + i));
+
+    /* 갱신 조건: MST 밖이고 w < key */
+    __m128i better = _mm_andnot_si128(d, _mm_cmplt_epi32(w, k));
+
+    k = _mm_or_si128(_mm_and_si128(better, w), _mm_andnot_si128(better, k));
+    p = _mm_or_si128(_mm_and_si128(better, vu), _mm_andnot_si128(better, p));
+
+    _mm_storeu_si128((__m128i *)(key + i), k);
+    _mm_storeu_si128((__m128i *)(parent + i), p);
+  }
+}
+
+/* ========== AVX2 커널 (정수 8개씩) ========== */
+
+__attribute__((target("avx2"))) static int find_min_avx2(const int *key, int n)
+{
+  __m256i vmin = _mm256_set1_epi32(INT_MAX);
+  for (int i = 0; i < n; i += 8)
+  {
+    vmin = _mm256_min_epi32(vmin, _mm256_loadu_si256((const __m256i *)(key + i)));
+  }
+
+  /* 8개 레인을 하나로 축소 */
+  __m128i m = _mm_min_epi32(_mm256_castsi256_si128(vmin), _mm256_extracti128_si256(vmin, 1));
+  m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+  m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+  int min = _mm_cvtsi128_si32(m);
+
+  if (min == INT_MAX)
+  {
+    return -1;
+  }
+
+  __m256i target = _mm256_set1_epi32(min);
+  for (int i = 0; i < n; i += 8)
+  {
+    __m256i k = _mm256_loadu_si256((const __m256i *)(key + i));
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(k, target)));
+    if (mask)
+    {
+      return i + __builtin_ctz(mask);
+    }
+  }
+
+  return -1;
+}
+
+__attribute__((target("avx2"))) static void relax_avx2(const int *row, int *key, int *parent,
+                                                     const int *done, int n, int u)
+{
+  __m256i vu = _mm256_set1_epi32(u);
+
+  for (int i = 0; i < n; i += 8)
+  {
+    __m256i w = _mm256_loadu_si256((const __m256i *)(row + i));
+    __m256i k = _mm256_loadu_si256((const __m256i *)(key + i));
+    __m256i p = _mm256_loadu_si256((const __m256i *)(parent + i));
+    __m256i d = _mm256_loadu_si256((const __m256i *)(done + i));
+
+    __m256i better = _mm256_andnot_si256(d, _mm256_cmpgt_epi32(k, w));
+
+    _mm256_storeu_si256((__m256i *)(key + i), _mm256_blendv_epi8(k, w, better));
+    _mm256_storeu_si256((__m256i *)(parent + i), _mm256_blendv_epi8(p, vu, better));
+  }
+}
+
+#endif /* DENSE_PRIM_X86 */
+
+/* ========== 커널 선택 ========== */
+
+/*
+ * 현재 커널 (DENSE_KERNEL_AUTO면 아직 고르지 않음)
+ * 커널 id 하나만 원자적으로 저장하고 두 함수 포인터와 이름은 id에서 정하므로
+ * 다른 스레드가 find_min과 relax를 서로 다른 커널로(또는 NULL로) 볼 수 없다.
+ * 다른 데이터를 넘겨주는 값이 아니라서 relaxed로 충분하다.
+ */
+static _Atomic int active_kernel = DENSE_KERNEL_AUTO;
+
+/* 현재 CPU에서 쓸 수 있는 커널인지 */
+static bool kernel_supported(DensePrimKernel kernel)
+{
+  switch (kernel)
+  {
+  case DENSE_KERNEL_SCALAR:
+    return true;
+#ifdef DENSE_PRIM_X86
+  case DENSE_KERNEL_SSE2:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+  case DENSE_KERNEL_AVX2:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+  default:
+    return false;
+  }
+}
+
+/* CPU가 지원하는 가장 빠른 커널 */
+static DensePrimKernel best_kernel(void)
+{
+  if (kernel_supported(DENSE_KERNEL_AVX2))
+  {
+    return DENSE_KERNEL_AVX2;
+  }
+  return kernel_supported(DENSE_KERNEL_SSE2) ? DENSE_KERNEL_SSE2 : DENSE_KERNEL_SCALAR;
+}
+
+/*
+ * 현재 커널 (아직 고르지 않았으면 지금 고름)
+ * 처음 호출이 겹치면 compare-exchange에서 이긴 값만 남고,
+ * 그 사이에 set_dense_prim_kernel로 정한 값도 덮어쓰지 않는다.
+ */
+static DensePrimKernel current_kernel(void)
+{
+  int kernel = atomic_load_explicit(&active_kernel, memory_order_relaxed);
+  if (kernel == DENSE_KERNEL_AUTO)
+  {
+    int expected = DENSE_KERNEL_AUTO;
+    kernel = (int)best_kernel();
+    if (!atomic_compare_exchange_strong_explicit(&active_kernel, &expected, kernel, memory_order_relaxed,
+                                                 memory_order_relaxed))
+    {
+      kernel = expected;
+    }
+  }
+  return (DensePrimKernel)kernel;
+}
+
+static FindMinFn find_min_of(DensePrimKernel kernel)
+{
+  switch (kernel)
+  {
+#ifdef DENSE_PRIM_X86
+  case DENSE_KERNEL_AVX2:
+    return find_min_avx2;
+  case DENSE_KERNEL_SSE2:
+    return find_min_sse2;
+#endif
+  default:
+    return find_min_scalar;
+  }
+}
+
+static RelaxFn relax_of(DensePrimKernel kernel)
+{
+  switch (kernel)
+  {
+#ifdef DENSE_PRIM_X86
+  case DENSE_KERNEL_AVX2:
+    return relax_avx2;
+  case DENSE_KERNEL_SSE2:
+    return relax_sse2;
+#endif
+  default:
+    return relax_scalar;
+  }
+}
+
+/**
+ * 사용할 Dense Prim 커널 지정
+ * @param kernel: 원하는 커널 (DENSE_KERNEL_AUTO면 CPU가 지원하는 가장 빠른 커널)
+ * @return: 현재 CPU에서 사용할 수 없는 커널이면 false (기존 선택 유지)
+ */
+bool set_dense_prim_kernel(DensePrimKernel kernel)
+{
+  if (kernel == DENSE_KERNEL_AUTO)
+  {
+    kernel = best_kernel();
+  }
+  if (!kernel_supported(kernel))
+  {
+    return false;
+  }
+  atomic_store_explicit(&active_kernel, (int)kernel, memory_order_relaxed);
+  return true;
+}
+
+/**
+ * 현재 선택된 커널 이름 (아직 선택 전이면 자동 선택)
+ */
+const char *dense_prim_kernel_name(void)
+{
+  switch (current_kernel())
+  {
+  case DENSE_KERNEL_AVX2:
+    return "AVX2";
+  case DENSE_KERNEL_SSE2:
+    return "SSE2";
+  default:
+    return "scalar";
+  }
+}
+
+/* ========== 밀집 그래프 관련 함수 ========== */
+
+/**
+ * 밀집 그래프 생성 (V × stride 행렬, 모든 칸을 INT_MAX로 초기화)
+ * @param vertices: 정점의 개수
+ * @return: 생성된 밀집 그래프 포인터
+ */
+DenseGraph *create_dense_graph(int vertices)
+{
+  if (vertices <= 0)
+  {
+    return NULL;
+  }
+
+  DenseGraph *graph = (DenseGraph *)malloc(sizeof(DenseGraph));
+  if (!graph)
+  {
+    return NULL;
+  }
+
+  /* 한 번에 8개씩 처리하므로 행 길이를 8의 배수로 맞춤 (남는 칸은 INT_MAX) */
+  graph->num_vertices = vertices;
+  graph->stride = (vertices + 7) & ~7;
+  graph->weights = (int *)malloc((size_t)vertices * graph->stride * sizeof(int));
+  if (!graph->weights)
+  {
+    free(graph);
+    return NULL;
+  }
+
+  for (size_t i = 0; i < (size_t)vertices * graph->stride; i++)
+  {
+    graph->weights[i] = INT_MAX;
+  }
+
+  return graph;
+}
+
+/**
+ * 간선 추가 (무방향 그래프, 중복 간선은 더 가벼운 쪽만 유지)
+ * INT_MAX는 "간선 없음"을 뜻하므로 가중치로 사용할 수 없음
+ */
+void add_dense_edge(DenseGraph *graph, int src, int dest, int weight)
+{
+  if (!graph || src < 0 || src >= graph->num_vertices ||
+      dest < 0 || dest >= graph->num_vertices || src == dest)
+  {
+    return;
+  }
+
+  int *forward = &graph->weights[(size_t)src * graph->stride + dest];
+  int *backward = &graph->weights[(size_t)dest * graph->stride + src];
+
+  if (weight < *forward)
+  {
+    *forward = weight;
+    *backward = weight;
+  }
+}
+
+void free_dense_graph(DenseGraph *graph)
+{
+  if (!graph)
+  {
+    return;
+  }
+  free(graph->weights);
+  free(graph);
+}
+
+/* ========== Dense Prim 알고리즘 ========== */
+
+/**
+ * Dense Prim 알고리즘 (인접 행렬 + SIMD)
+ * 시간 복잡도: O(V²) - 기본 Prim과 같지만 두 선형 스캔을 SIMD로 처리
+ * - find_min: key[] 최솟값 (MST에 들어간 정점은 key = INT_MAX)
+ * - relax: 행렬의 u번째 행과 key[]를 비교해 한 번에 갱신
+ *
+ * 완전 그래프처럼 E ≈ V²인 경우 힙 기반 Prim보다 빠름
+ */
+MST *dense_prim_mst(DenseGraph *graph, int start_vertex, Performance *perf)
+{
+  if (!graph || start_vertex < 0 || start_vertex >= graph->num_vertices)
+  {
+    return NULL;
+  }
+
+  /* 커널은 한 번만 읽어서 이번 실행 동안 두 스캔에 같은 커널을 씀 */
+  DensePrimKernel kernel = current_kernel();
+  FindMinFn find_min_kernel = find_min_of(kernel);
+  RelaxFn relax_kernel = relax_of(kernel);
+
+  clock_t start = clock();
+  int comparisons = 0;
+
+  int V = graph->num_vertices;
+  int n = graph->stride;
+  int *key = (int *)malloc(n * sizeof(int));
+  int *parent = (int *)malloc(n * sizeof(int));
+  int *done = (int *)malloc(n * sizeof(int));
+  MST *mst = (MST *)malloc(sizeof(MST));
+  MSTEdge *edges = (MSTEdge *)malloc(V * sizeof(MSTEdge));
+
+  if (!key || !parent || !done || !mst || !edges)
+  {
+    free(key);
+    free(parent);
+    free(done);
+    free(mst);
+    free(edges);
+    return NULL;
+  }
+
+  /* 초기화: 패딩 칸은 처음부터 MST에 포함된 것으로 처리 */
+  for (int v = 0; v < n; v++)
+  {
+    key[v] = INT_MAX;
+    parent[v] = -1;
+    done[v] = (v < V) ? 0 : -1;
+  }
+
+  key[start_vertex] = 0;
+
+  mst->edges = edges;
+  mst->num_edges = 0;
+  mst->total_weight = 0;
+
+  for (int count = 0; count < V; count++)
+  {
+    /* 최소 key 찾기 - O(V / SIMD 폭) */
+    int u = find_min_kernel(key, n);
+    comparisons += V;
+
+    if (u == -1)
+    {
+      break;
+    }
+
+    if (parent[u] != -1)
+    {
+      mst->edges[mst->num_edges].src = parent[u];
+      mst->edges[mst->num_edges].dest = u;
+      mst->edges[mst->num_edges].weight = key[u];
+      mst->total_weight += key[u];
+      mst->num_edges++;
+    }
+
+    /* MST에 포함: 다음 find_min에서 제외되도록 key를 INT_MAX로 */
+    done[u] = -1;
+    key[u] = INT_MAX;
+
+    /* u의 행으로 key 갱신 - O(V / SIMD 폭) */
+    relax_kernel(&graph->weights[(size_t)u * n], key, parent, done, n, u);
+    comparisons += V;
+  }
+
+  clock_t end = clock();
+
+  if (perf)
+  {
+    perf->execution_time = ((double)(end - start)) / CLOCKS_PER_SEC;
+    perf->comparisons = comparisons;
+  }
+
+  free(key);
+  free(parent);
+  free(done);
+
+  return mst;
+}
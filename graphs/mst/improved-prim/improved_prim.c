@@ -232,19 +232,12 @@ MST *basic_prim_mst(Graph *graph, int start_vertex, Performance *perf)
 
 /* Min-Heap 헬퍼 함수들 */
 
-static HeapNode *create_heap_node(int vertex, int key)
-{
-  HeapNode *node = (HeapNode *)malloc(sizeof(HeapNode));
-  if (!node)
-  {
-    return NULL;
-  }
-  node->vertex = vertex;
-  node->key = key;
-  return node;
-}
-
-static MinHeap *create_min_heap(int capacity)
+/**
+ * d-ary Min-Heap 생성
+ * 노드마다 malloc하지 않고 HeapNode 배열 하나에 저장
+ * 개선 포인트: 비교할 때 포인터를 따라가지 않고, 형제 노드들이 같은 캐시 라인에 모임
+ */
+static MinHeap *create_min_heap(int capacity, int arity)
 {
   MinHeap *heap = (MinHeap *)malloc(sizeof(MinHeap));
   if (!heap)
@@ -253,7 +246,7 @@ static MinHeap *create_min_heap(int capacity)
   }
 
   heap->pos = (int *)malloc(capacity * sizeof(int));
-  heap->array = (HeapNode **)malloc(capacity * sizeof(HeapNode *));
+  heap->array = (HeapNode *)malloc(capacity * sizeof(HeapNode));
 
   if (!heap->pos || !heap->array)
   {
@@ -265,50 +258,57 @@ static MinHeap *create_min_heap(int capacity)
 
   heap->size = 0;
   heap->capacity = capacity;
+  heap->arity = arity;
 
   return heap;
 }
 
-static void swap_heap_node(HeapNode **a, HeapNode **b)
-{
-  HeapNode *temp = *a;
-  *a = *b;
-  *b = temp;
-}
-
 /**
  * Min-Heapify 연산
- * 시간 복잡도: O(log V)
+ * 시간 복잡도: O(d log_d V)
  * 개선 포인트: 배열 기반에서는 불가능한 효율적인 최소값 추출
+ * 교환 대신 빈 자리(hole)에 작은 자식을 끌어올리고 마지막에 한 번만 기록
  */
 static void min_heapify(MinHeap *heap, int idx)
 {
-  int smallest = idx;
-  int left = 2 * idx + 1;
-  int right = 2 * idx + 2;
+  HeapNode moving = heap->array[idx];
+  int d = heap->arity;
 
-  if (left < heap->size && heap->array[left]->key < heap->array[smallest]->key)
+  for (;;)
   {
-    smallest = left;
-  }
-
-  if (right < heap->size && heap->array[right]->key < heap->array[smallest]->key)
-  {
-    smallest = right;
-  }
+    int first = d * idx + 1;
+    if (first >= heap->size)
+    {
+      break;
+    }
 
-  if (smallest != idx)
-  {
-    HeapNode *smallest_node = heap->array[smallest];
-    HeapNode *idx_node = heap->array[idx];
+    int last = first + d;
+    if (last > heap->size)
+    {
+      last = heap->size;
+    }
 
-    heap->pos[smallest_node->vertex] = idx;
-    heap->pos[idx_node->vertex] = smallest;
+    int smallest = first;
+    for (int c = first + 1; c < last; c++)
+    {
+      if (heap->array[c].key < heap->array[smallest].key)
+      {
+        smallest = c;
+      }
+    }
 
-    swap_heap_node(&heap->array[smallest], &heap->array[idx]);
+    if (heap->array[smallest].key >= moving.key)
+    {
+      break;
+    }
 
-    min_heapify(heap, smallest);
+    heap->array[idx] = heap->array[smallest];
+    heap->pos[heap->array[idx].vertex] = idx;
+    idx = smallest;
   }
+
+  heap->array[idx] = moving;
+  heap->pos[moving.vertex] = idx;
 }
 
 static bool is_empty(MinHeap *heap)
@@ -318,48 +318,48 @@ static bool is_empty(MinHeap *heap)
 
 /**
  * 최소값 추출
- * 시간 복잡도: O(log V)
+ * 시간 복잡도: O(d log_d V)
  * 개선 포인트: 기본 Prim의 O(V)보다 빠름
  */
-static HeapNode *extract_min(MinHeap *heap)
+static int extract_min(MinHeap *heap)
 {
-  if (is_empty(heap))
-  {
-    return NULL;
-  }
-
-  HeapNode *root = heap->array[0];
-  HeapNode *last_node = heap->array[heap->size - 1];
-  heap->array[0] = last_node;
-
-  heap->pos[root->vertex] = heap->size - 1;
-  heap->pos[last_node->vertex] = 0;
+  int root = heap->array[0].vertex;
 
+  /* 추출된 정점은 pos == size가 되어 힙 밖으로 표시됨 */
   heap->size--;
-  min_heapify(heap, 0);
+  heap->pos[root] = heap->size;
+
+  if (heap->size > 0)
+  {
+    heap->array[0] = heap->array[heap->size];
+    heap->pos[heap->array[0].vertex] = 0;
+    min_heapify(heap, 0);
+  }
 
   return root;
 }
 
 /**
  * Key 값 감소 연산
- * 시간 복잡도: O(log V)
- * 개선 포인트: 힙 구조를 이용한 효율적인 우선순위 업데이트
+ * 시간 복잡도: O(log_d V)
+ * 개선 포인트: 자식 수가 많을수록 트리가 낮아져 위로 올라가는 비용이 줄어듦
  */
 static void decrease_key(MinHeap *heap, int vertex, int key)
 {
   int i = heap->pos[vertex];
-  heap->array[i]->key = key;
+  int d = heap->arity;
 
-  while (i > 0 && heap->array[i]->key < heap->array[(i - 1) / 2]->key)
+  while (i > 0 && key < heap->array[(i - 1) / d].key)
   {
-    heap->pos[heap->array[i]->vertex] = (i - 1) / 2;
-    heap->pos[heap->array[(i - 1) / 2]->vertex] = i;
-
-    swap_heap_node(&heap->array[i], &heap->array[(i - 1) / 2]);
-
-    i = (i - 1) / 2;
+    int parent = (i - 1) / d;
+    heap->array[i] = heap->array[parent];
+    heap->pos[heap->array[i].vertex] = i;
+    i = parent;
   }
+
+  heap->array[i].vertex = vertex;
+  heap->array[i].key = key;
+  heap->pos[vertex] = i;
 }
 
 static bool is_in_min_heap(MinHeap *heap, int vertex)
@@ -374,11 +374,6 @@ static void free_min_heap(MinHeap *heap)
     return;
   }
 
-  for (int i = 0; i < heap->size; i++)
-  {
-    free(heap->array[i]);
-  }
-
   free(heap->pos);
   free(heap->array);
   free(heap);
@@ -397,7 +392,19 @@ static void free_min_heap(MinHeap *heap)
  */
 MST *improved_prim_mst(Graph *graph, int start_vertex, Performance *perf)
 {
-  if (!graph || start_vertex < 0 || start_vertex >= graph->num_vertices)
+  return improved_prim_mst_with_arity(graph, start_vertex, HEAP_ARITY, perf);
+}
+
+/**
+ * 힙의 자식 개수를 지정하는 개선된 Prim 알고리즘
+ * @param arity: 힙 한 노드의 자식 개수 (2, 4, 8 등)
+ *
+ * 자식이 많으면 decrease_key는 빨라지고 extract_min은 자식 비교가 늘어남
+ * 간선이 많아 decrease_key가 자주 일어나는 그래프일수록 큰 arity가 유리
+ */
+MST *improved_prim_mst_with_arity(Graph *graph, int start_vertex, int arity, Performance *perf)
+{
+  if (!graph || start_vertex < 0 || start_vertex >= graph->num_vertices || arity < 2)
   {
     return NULL;
   }
@@ -416,7 +423,7 @@ MST *improved_prim_mst(Graph *graph, int start_vertex, Performance *perf)
     return NULL;
   }
 
-  MinHeap *heap = create_min_heap(V);
+  MinHeap *heap = create_min_heap(V, arity);
   if (!heap)
   {
     free(parent);
@@ -429,23 +436,21 @@ MST *improved_prim_mst(Graph *graph, int start_vertex, Performance *perf)
   {
     parent[v] = -1;
     key[v] = INT_MAX;
-    heap->array[v] = create_heap_node(v, key[v]);
+    heap->array[v].vertex = v;
+    heap->array[v].key = key[v];
     heap->pos[v] = v;
   }
 
+  heap->size = V;
+
   key[start_vertex] = 0;
-  heap->array[start_vertex]->key = 0;
   decrease_key(heap, start_vertex, key[start_vertex]);
 
-  heap->size = V;
-
   /* 힙이 빌 때까지 반복 */
   while (!is_empty(heap))
   {
-    /* Min-Heap에서 최소 key 추출 - O(log V) */
-    HeapNode *min_node = extract_min(heap);
-    int u = min_node->vertex;
-    free(min_node);
+    /* Min-Heap에서 최소 key 추출 - O(d log_d V) */
+    int u = extract_min(heap);
 
     /* u의 인접 정점 확인 */
     AdjNode *adj = graph->adj_lists[u];
@@ -454,7 +459,7 @@ MST *improved_prim_mst(Graph *graph, int start_vertex, Performance *perf)
       int v = adj->vertex;
       comparisons++;
 
-      /* decrease_key 연산 - O(log V) */
+      /* decrease_key 연산 - O(log_d V) */
       if (is_in_min_heap(heap, v) && adj->weight < key[v])
       {
         key[v] = adj->weight;
@@ -516,6 +521,206 @@ MST *improved_prim_mst(Graph *graph, int start_vertex, Performance *perf)
   return mst;
 }
 
+/* ========== Lazy Prim 알고리즘 (decrease_key 없는 힙) ========== */
+
+static LazyHeap *create_lazy_heap(int capacity)
+{
+  LazyHeap *heap = (LazyHeap *)malloc(sizeof(LazyHeap));
+  if (!heap)
+  {
+    return NULL;
+  }
+
+  heap->array = (LazyHeapEntry *)malloc(capacity * sizeof(LazyHeapEntry));
+  if (!heap->array)
+  {
+    free(heap);
+    return NULL;
+  }
+
+  heap->size = 0;
+  heap->capacity = capacity;
+
+  return heap;
+}
+
+static void free_lazy_heap(LazyHeap *heap)
+{
+  if (!heap)
+  {
+    return;
+  }
+  free(heap->array);
+  free(heap);
+}
+
+/**
+ * 힙에 간선 추가 (가득 차면 두 배로 확장)
+ * 시간 복잡도: O(log E)
+ */
+static bool lazy_heap_push(LazyHeap *heap, int weight, int vertex, int parent)
+{
+  if (heap->size == heap->capacity)
+  {
+    int new_capacity = heap->capacity * 2;
+    LazyHeapEntry *grown = (LazyHeapEntry *)realloc(heap->array,
+                                                     new_capacity * sizeof(LazyHeapEntry));
+    if (!grown)
+    {
+      return false;
+    }
+    heap->array = grown;
+    heap->capacity = new_capacity;
+  }
+
+  /* 빈 자리에서 부모보다 작으면 위로 올라감 */
+  int i = heap->size++;
+  while (i > 0 && weight < heap->array[(i - 1) / 2].weight)
+  {
+    heap->array[i] = heap->array[(i - 1) / 2];
+    i = (i - 1) / 2;
+  }
+
+  heap->array[i].weight = weight;
+  heap->array[i].vertex = vertex;
+  heap->array[i].parent = parent;
+
+  return true;
+}
+
+/**
+ * 가장 가벼운 간선 추출
+ * 시간 복잡도: O(log E)
+ */
+static LazyHeapEntry lazy_heap_pop(LazyHeap *heap)
+{
+  LazyHeapEntry top = heap->array[0];
+  LazyHeapEntry last = heap->array[--heap->size];
+
+  int i = 0;
+  for (;;)
+  {
+    int child = 2 * i + 1;
+    if (child >= heap->size)
+    {
+      break;
+    }
+    if (child + 1 < heap->size && heap->array[child + 1].weight < heap->array[child].weight)
+    {
+      child++;
+    }
+    if (heap->array[child].weight >= last.weight)
+    {
+      break;
+    }
+    heap->array[i] = heap->array[child];
+    i = child;
+  }
+
+  if (heap->size > 0)
+  {
+    heap->array[i] = last;
+  }
+
+  return top;
+}
+
+/**
+ * Lazy Prim 알고리즘
+ * 시간 복잡도: O(E log E) = O(E log V)
+ * - 정점의 key를 줄이는 대신 (weight, vertex, parent) 간선을 그대로 힙에 넣음
+ * - 꺼낸 정점이 이미 MST에 있으면 오래된(stale) 항목이므로 건너뜀
+ *
+ * 개선된 Prim과 비교:
+ * - pos[] 배열과 decrease_key가 없어 내부 루프가 단순함
+ * - 대신 힙에 최대 E개의 항목이 쌓일 수 있어 메모리를 더 씀
+ */
+MST *lazy_prim_mst(Graph *graph, int start_vertex, Performance *perf)
+{
+  if (!graph || start_vertex < 0 || start_vertex >= graph->num_vertices)
+  {
+    return NULL;
+  }
+
+  clock_t start = clock();
+  int comparisons = 0;
+
+  int V = graph->num_vertices;
+  bool *in_mst = (bool *)calloc(V, sizeof(bool));
+  LazyHeap *heap = create_lazy_heap(V);
+  MST *mst = (MST *)malloc(sizeof(MST));
+  MSTEdge *edges = (MSTEdge *)malloc(V * sizeof(MSTEdge));
+
+  if (!in_mst || !heap || !mst || !edges)
+  {
+    free(in_mst);
+    free_lazy_heap(heap);
+    free(mst);
+    free(edges);
+    return NULL;
+  }
+
+  mst->edges = edges;
+  mst->num_edges = 0;
+  mst->total_weight = 0;
+
+  /* 시작 정점은 부모 없이 가중치 0으로 들어감 */
+  lazy_heap_push(heap, 0, start_vertex, -1);
+
+  while (heap->size > 0 && mst->num_edges < V - 1)
+  {
+    LazyHeapEntry entry = lazy_heap_pop(heap);
+    int u = entry.vertex;
+
+    /* 이미 더 가벼운 간선으로 MST에 들어간 정점 - 건너뜀 */
+    if (in_mst[u])
+    {
+      continue;
+    }
+
+    in_mst[u] = true;
+
+    if (entry.parent != -1)
+    {
+      mst->edges[mst->num_edges].src = entry.parent;
+      mst->edges[mst->num_edges].dest = u;
+      mst->edges[mst->num_edges].weight = entry.weight;
+      mst->total_weight += entry.weight;
+      mst->num_edges++;
+    }
+
+    /* MST 밖으로 나가는 간선을 모두 힙에 넣음 */
+    AdjNode *adj = graph->adj_lists[u];
+    while (adj)
+    {
+      comparisons++;
+
+      if (!in_mst[adj->vertex] && !lazy_heap_push(heap, adj->weight, adj->vertex, u))
+      {
+        free(in_mst);
+        free_lazy_heap(heap);
+        free_mst(mst);
+        return NULL;
+      }
+
+      adj = adj->next;
+    }
+  }
+
+  clock_t end = clock();
+
+  if (perf)
+  {
+    perf->execution_time = ((double)(end - start)) / CLOCKS_PER_SEC;
+    perf->comparisons = comparisons;
+  }
+
+  free(in_mst);
+  free_lazy_heap(heap);
+
+  return mst;
+}
+
 /* ========== MST 및 성능 관련 함수 ========== */
 
 void print_mst(MST *mst, const char *algorithm_name)
@@ -570,4 +775,11 @@ void compare_performance(Performance *basic, Performance *improved)
   printf("  속도 향상: %.2fx\n", speedup);
   printf("  비교 연산 감소: %d 회 (%.1f%%)\n", comparison_reduction, comparison_percent);
   printf("\n================================\n\n");
+}
+
+void print_performance(const char *algorithm_name, Performance *perf)
+{
+  printf("%s:\n", algorithm_name);
+  printf("  실행 시간: %.6f 초\n", perf->execution_time);
+  printf("  비교 연산: %d 회\n\n", perf->comparisons);
 }
\ No newline at end of file
@@ -7,6 +7,11 @@
 #include <limits.h>
 #include <time.h>
 
+/* 힙의 기본 자식 개수 (-DHEAP_ARITY=8 처럼 컴파일 시 변경 가능) */
+#ifndef HEAP_ARITY
+#define HEAP_ARITY 4
+#endif
+
 /* 인접 리스트의 노드 구조체 */
 typedef struct AdjNode
 {
@@ -22,6 +27,23 @@ typedef struct Graph
   AdjNode **adj_lists;
 } Graph;
 
+/* 밀집 그래프 구조체 (행 우선 인접 행렬) */
+typedef struct DenseGraph
+{
+  int num_vertices;
+  int stride;   /* 한 행의 길이 (SIMD 처리를 위해 8의 배수로 올림) */
+  int *weights; /* weights[u * stride + v], 간선이 없으면 INT_MAX */
+} DenseGraph;
+
+/* Dense Prim 커널 종류 (런타임에 CPU 기능을 확인해서 선택) */
+typedef enum DensePrimKernel
+{
+  DENSE_KERNEL_AUTO,   /* 지원되는 가장 빠른 커널 */
+  DENSE_KERNEL_SCALAR, /* 일반 반복문 */
+  DENSE_KERNEL_SSE2,   /* 128비트 (정수 4개씩) */
+  DENSE_KERNEL_AVX2    /* 256비트 (정수 8개씩) */
+} DensePrimKernel;
+
 /* MST 간선 구조체 */
 typedef struct MSTEdge
 {
@@ -45,15 +67,32 @@ typedef struct HeapNode
   int key;
 } HeapNode;
 
-/* Min-Heap 구조체 (Improved Prim용) */
+/* Min-Heap 구조체 (Improved Prim용, d-ary 연속 배열) */
 typedef struct MinHeap
 {
   int size;
   int capacity;
-  int *pos; /* 정점이 힙에서 위치한 인덱스 */
-  HeapNode **array;
+  int arity;       /* 한 노드의 자식 개수 */
+  int *pos;        /* 정점이 힙에서 위치한 인덱스 */
+  HeapNode *array; /* 노드별 할당 없이 연속으로 저장된 힙 배열 */
 } MinHeap;
 
+/* Lazy Prim 힙 항목: 간선 (parent - vertex, weight) 하나 */
+typedef struct LazyHeapEntry
+{
+  int weight; /* 간선 가중치 (우선순위) */
+  int vertex; /* 간선이 도달하는 정점 */
+  int parent; /* 간선이 출발한 MST 쪽 정점 */
+} LazyHeapEntry;
+
+/* Lazy Prim용 이진 힙 (pos 배열 없음, 오래된 항목도 그대로 둠) */
+typedef struct LazyHeap
+{
+  int size;
+  int capacity;
+  LazyHeapEntry *array;
+} LazyHeap;
+
 /* 성능 측정 구조체 */
 typedef struct Performance
 {
@@ -71,6 +110,20 @@ MST *basic_prim_mst(Graph *graph, int start_vertex, Performance *perf);
 
 /* 개선된 Prim 알고리즘 (Min-Heap 기반 - O((V+E) log V)) */
 MST *improved_prim_mst(Graph *graph, int start_vertex, Performance *perf);
+MST *improved_prim_mst_with_arity(Graph *graph, int start_vertex, int arity, Performance *perf);
+
+/* 밀집 그래프 관련 함수 */
+DenseGraph *create_dense_graph(int vertices);
+void add_dense_edge(DenseGraph *graph, int src, int dest, int weight);
+void free_dense_graph(DenseGraph *graph);
+
+/* Dense Prim 알고리즘 (인접 행렬 + SIMD - O(V²)) */
+MST *dense_prim_mst(DenseGraph *graph, int start_vertex, Performance *perf);
+bool set_dense_prim_kernel(DensePrimKernel kernel);
+const char *dense_prim_kernel_name(void);
+
+/* Lazy Prim 알고리즘 (decrease_key 없이 간선을 힙에 넣기 - O(E log E)) */
+MST *lazy_prim_mst(Graph *graph, int start_vertex, Performance *perf);
 
 /* MST 관련 함수 */
 void print_mst(MST *mst, const char *algorithm_name);
@@ -78,5 +131,6 @@ void free_mst(MST *mst);
 
 /* 성능 비교 함수 */
 void compare_performance(Performance *basic, Performance *improved);
+void print_performance(const char *algorithm_name, Performance *perf);
 
 #endif
\ No newline at end of file
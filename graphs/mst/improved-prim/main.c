@@ -1,4 +1,5 @@
 #include "improved_prim.h"
+#include <string.h>
 
 int main(void)
 {
@@ -106,12 +107,139 @@ int main(void)
     printf("MST 총 가중치: %d\n\n", mst_large_basic->total_weight);
     compare_performance(&large_basic_perf, &large_improved_perf);
 
+    Performance large_lazy_perf;
+    MST *mst_large_lazy = lazy_prim_mst(large_graph, 0, &large_lazy_perf);
+    if (mst_large_lazy)
+    {
+      print_performance("Lazy Prim (decrease_key 없는 힙 - O(E log E))", &large_lazy_perf);
+      free_mst(mst_large_lazy);
+    }
+
     printf("분석:\n");
     printf("- 희소 그래프에서 개선된 Prim이 더 효율적임.\n");
     printf("- 정점 수가 증가할수록 성능 차이가 더 명확해짐.\n");
     printf("- O(V²) vs O((V+E)logV)의 차이를 확인할 수 있음.\n\n");
   }
 
+  /* 힙 자식 개수(arity)별 성능 비교 */
+  printf("=== 힙 자식 개수별 성능 (큰 희소 그래프) ===\n\n");
+
+  int big_v = 200000;
+  Graph *sparse_graph = create_graph(big_v);
+  if (sparse_graph)
+  {
+    unsigned int seed = 7;
+
+    /* 연결성을 보장하는 경로 + 정점당 평균 4개의 랜덤 간선 */
+    for (int i = 0; i < big_v - 1; i++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      add_edge(sparse_graph, i, i + 1, (int)((seed >> 8) % 1000) + 1);
+    }
+    for (int i = 0; i < big_v * 4; i++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      int src = (int)((seed >> 8) % big_v);
+      seed = seed * 1103515245u + 12345u;
+      int dest = (int)((seed >> 8) % big_v);
+      seed = seed * 1103515245u + 12345u;
+      add_edge(sparse_graph, src, dest, (int)((seed >> 8) % 1000) + 1);
+    }
+
+    printf("정점 %d개, 간선 약 %d개\n\n", big_v, big_v * 5);
+
+    int arities[] = {2, 4, 8};
+    for (int a = 0; a < 3; a++)
+    {
+      Performance arity_perf;
+      MST *arity_mst = improved_prim_mst_with_arity(sparse_graph, 0, arities[a], &arity_perf);
+      if (arity_mst)
+      {
+        printf("  %d-ary 힙: %.6f 초 (MST 총 가중치: %d)\n",
+               arities[a], arity_perf.execution_time, arity_mst->total_weight);
+        free_mst(arity_mst);
+      }
+    }
+    printf("\n");
+
+    /* decrease_key가 없는 Lazy Prim과 비교 */
+    Performance lazy_perf;
+    MST *lazy_mst = lazy_prim_mst(sparse_graph, 0, &lazy_perf);
+    if (lazy_mst)
+    {
+      printf("  Lazy Prim: %.6f 초 (MST 총 가중치: %d)\n\n",
+             lazy_perf.execution_time, lazy_mst->total_weight);
+      free_mst(lazy_mst);
+    }
+
+    free_graph(sparse_graph);
+  }
+
+  /* 밀집 그래프: 점 집합으로 만든 완전 그래프 */
+  printf("=== 밀집 그래프 (완전 그래프) 성능 비교 ===\n\n");
+
+  int dense_v = 1500;
+  int *xs = (int *)malloc(dense_v * sizeof(int));
+  int *ys = (int *)malloc(dense_v * sizeof(int));
+  Graph *complete_graph = create_graph(dense_v);
+  DenseGraph *dense_graph = create_dense_graph(dense_v);
+
+  if (xs && ys && complete_graph && dense_graph)
+  {
+    unsigned int seed = 11;
+    for (int i = 0; i < dense_v; i++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      xs[i] = (int)((seed >> 8) % 10000);
+      seed = seed * 1103515245u + 12345u;
+      ys[i] = (int)((seed >> 8) % 10000);
+    }
+
+    /* 가중치: 맨해튼 거리 */
+    for (int i = 0; i < dense_v; i++)
+    {
+      for (int j = i + 1; j < dense_v; j++)
+      {
+        int w = abs(xs[i] - xs[j]) + abs(ys[i] - ys[j]);
+        add_edge(complete_graph, i, j, w);
+        add_dense_edge(dense_graph, i, j, w);
+      }
+    }
+
+    printf("정점 %d개, 간선 %d개\n\n", dense_v, dense_v * (dense_v - 1) / 2);
+
+    Performance dense_basic_perf, dense_improved_perf, dense_scalar_perf, dense_simd_perf;
+    MST *m1 = basic_prim_mst(complete_graph, 0, &dense_basic_perf);
+    MST *m2 = improved_prim_mst(complete_graph, 0, &dense_improved_perf);
+
+    set_dense_prim_kernel(DENSE_KERNEL_SCALAR);
+    MST *m3 = dense_prim_mst(dense_graph, 0, &dense_scalar_perf);
+
+    set_dense_prim_kernel(DENSE_KERNEL_AUTO);
+    MST *m4 = dense_prim_mst(dense_graph, 0, &dense_simd_perf);
+
+    if (m1 && m2 && m3 && m4)
+    {
+      printf("MST 총 가중치: %d / %d / %d / %d\n\n",
+             m1->total_weight, m2->total_weight, m3->total_weight, m4->total_weight);
+      printf("  기본 Prim (인접 리스트):      %.6f 초\n", dense_basic_perf.execution_time);
+      printf("  개선된 Prim (Min-Heap):       %.6f 초\n", dense_improved_perf.execution_time);
+      printf("  Dense Prim (행렬, scalar):    %.6f 초\n", dense_scalar_perf.execution_time);
+      printf("  Dense Prim (행렬, %s):%*s%.6f 초\n\n", dense_prim_kernel_name(),
+             (int)(10 - strlen(dense_prim_kernel_name())), "", dense_simd_perf.execution_time);
+    }
+
+    free_mst(m1);
+    free_mst(m2);
+    free_mst(m3);
+    free_mst(m4);
+  }
+
+  free(xs);
+  free(ys);
+  free_graph(complete_graph);
+  free_dense_graph(dense_graph);
+
   /* 메모리 해제 */
   free_mst(mst_basic);
   free_mst(mst_improved);
@@ -284,6 +284,198 @@ void test_large_graph()
   printf("테스트 통과\n");
 }
 
+/* 테스트 12: 힙 자식 개수(2, 4, 8)와 무관하게 같은 MST */
+void test_heap_arity()
+{
+  printf("테스트 12: 힙 자식 개수별 결과 동일성...\n");
+
+  Graph *graph = create_graph(200);
+  for (int i = 0; i < 199; i++)
+  {
+    add_edge(graph, i, i + 1, (i * 37) % 50 + 1);
+  }
+  for (int i = 0; i < 400; i++)
+  {
+    add_edge(graph, (i * 13) % 200, (i * 29 + 11) % 200, (i * 17) % 40 + 1);
+  }
+
+  MST *expected = basic_prim_mst(graph, 0, NULL);
+  assert(expected != NULL);
+
+  int arities[] = {2, 4, 8};
+  for (int a = 0; a < 3; a++)
+  {
+    MST *mst = improved_prim_mst_with_arity(graph, 0, arities[a], NULL);
+    assert(mst != NULL);
+    assert(mst->num_edges == expected->num_edges);
+    assert(mst->total_weight == expected->total_weight);
+    free_mst(mst);
+  }
+
+  /* 자식이 1개인 힙은 허용하지 않음 */
+  assert(improved_prim_mst_with_arity(graph, 0, 1, NULL) == NULL);
+
+  free_mst(expected);
+  free_graph(graph);
+  printf("테스트 통과\n");
+}
+
+/* 테스트 13: Lazy Prim - 다른 알고리즘과 결과 동일성 */
+void test_lazy_prim_equal_result()
+{
+  printf("테스트 13: Lazy Prim - 결과 동일성...\n");
+
+  Graph *graph = create_graph(5);
+  add_edge(graph, 0, 1, 1);
+  add_edge(graph, 0, 2, 4);
+  add_edge(graph, 1, 2, 2);
+  add_edge(graph, 1, 3, 3);
+  add_edge(graph, 2, 3, 5);
+  add_edge(graph, 2, 4, 6);
+
+  MST *mst_lazy = lazy_prim_mst(graph, 0, NULL);
+  assert(mst_lazy != NULL);
+  assert(mst_lazy->num_edges == 4);
+  assert(mst_lazy->total_weight == 12);
+
+  /* 시작 정점이 달라도 총 가중치는 같음 */
+  MST *mst_lazy_from_4 = lazy_prim_mst(graph, 4, NULL);
+  assert(mst_lazy_from_4->total_weight == 12);
+
+  free_mst(mst_lazy);
+  free_mst(mst_lazy_from_4);
+  free_graph(graph);
+
+  /* 오래된 항목이 많이 쌓이는 큰 그래프 (힙 확장 포함) */
+  graph = create_graph(100);
+  for (int i = 0; i < 99; i++)
+  {
+    add_edge(graph, i, i + 1, (i * 31) % 97 + 1);
+  }
+  for (int i = 0; i < 1000; i++)
+  {
+    add_edge(graph, (i * 7) % 100, (i * 11 + 3) % 100, (i * 13) % 89 + 1);
+  }
+
+  Performance improved_perf, lazy_perf;
+  MST *mst_improved = improved_prim_mst(graph, 0, &improved_perf);
+  mst_lazy = lazy_prim_mst(graph, 0, &lazy_perf);
+
+  assert(mst_lazy->num_edges == 99);
+  assert(mst_lazy->total_weight == mst_improved->total_weight);
+  assert(lazy_perf.comparisons > 0);
+  assert(lazy_perf.execution_time >= 0);
+
+  free_mst(mst_improved);
+  free_mst(mst_lazy);
+  free_graph(graph);
+  printf("테스트 통과\n");
+}
+
+/* 테스트 14: Lazy Prim - 연결되지 않은 그래프와 잘못된 입력 */
+void test_lazy_prim_edge_cases()
+{
+  printf("테스트 14: Lazy Prim - 예외 상황...\n");
+
+  /* 0-1, 2-3 두 컴포넌트: 시작 정점의 컴포넌트만 포함 */
+  Graph *graph = create_graph(4);
+  add_edge(graph, 0, 1, 5);
+  add_edge(graph, 2, 3, 3);
+
+  MST *mst = lazy_prim_mst(graph, 0, NULL);
+  assert(mst != NULL);
+  assert(mst->num_edges == 1);
+  assert(mst->total_weight == 5);
+
+  assert(lazy_prim_mst(graph, 4, NULL) == NULL);
+  assert(lazy_prim_mst(NULL, 0, NULL) == NULL);
+
+  free_mst(mst);
+  free_graph(graph);
+  printf("테스트 통과\n");
+}
+
+/* 테스트 15: Dense Prim - 모든 커널이 기본 Prim과 같은 결과 */
+void test_dense_prim_kernels()
+{
+  printf("테스트 15: Dense Prim - 커널별 결과 동일성...\n");
+
+  /* 패딩(8의 배수가 아닌 정점 수)도 확인하기 위해 37개 정점의 완전 그래프 */
+  int V = 37;
+  Graph *graph = create_graph(V);
+  DenseGraph *dense = create_dense_graph(V);
+  assert(dense != NULL);
+  assert(dense->stride == 40);
+
+  for (int i = 0; i < V; i++)
+  {
+    for (int j = i + 1; j < V; j++)
+    {
+      int w = (i * 131 + j * 71) % 97 + 1;
+      add_edge(graph, i, j, w);
+      add_dense_edge(dense, i, j, w);
+    }
+  }
+
+  MST *expected = basic_prim_mst(graph, 0, NULL);
+
+  DensePrimKernel kernels[] = {DENSE_KERNEL_SCALAR, DENSE_KERNEL_SSE2, DENSE_KERNEL_AVX2};
+  for (int k = 0; k < 3; k++)
+  {
+    /* CPU가 지원하지 않는 커널은 건너뜀 */
+    if (!set_dense_prim_kernel(kernels[k]))
+    {
+      continue;
+    }
+
+    Performance perf;
+    MST *mst = dense_prim_mst(dense, 5, &perf);
+    assert(mst != NULL);
+    assert(mst->num_edges == V - 1);
+    assert(mst->total_weight == expected->total_weight);
+    assert(perf.comparisons > 0);
+    free_mst(mst);
+  }
+
+  assert(set_dense_prim_kernel(DENSE_KERNEL_AUTO) == true);
+  printf("    자동 선택된 커널: %s\n", dense_prim_kernel_name());
+
+  free_mst(expected);
+  free_dense_graph(dense);
+  free_graph(graph);
+  printf("테스트 통과\n");
+}
+
+/* 테스트 16: Dense Prim - 연결되지 않은 그래프, 중복 간선, 잘못된 입력 */
+void test_dense_prim_edge_cases()
+{
+  printf("테스트 16: Dense Prim - 예외 상황...\n");
+
+  DenseGraph *dense = create_dense_graph(4);
+  add_dense_edge(dense, 0, 1, 5);
+  add_dense_edge(dense, 0, 1, 2); /* 더 가벼운 중복 간선만 유지 */
+  add_dense_edge(dense, 1, 0, 9);
+  add_dense_edge(dense, 2, 3, 3);
+  add_dense_edge(dense, 2, 2, 1); /* 자기 자신으로 가는 간선은 무시 */
+
+  assert(dense->weights[0 * dense->stride + 1] == 2);
+  assert(dense->weights[1 * dense->stride + 0] == 2);
+  assert(dense->weights[2 * dense->stride + 2] == INT_MAX);
+
+  /* 시작 정점의 컴포넌트만 포함 */
+  MST *mst = dense_prim_mst(dense, 0, NULL);
+  assert(mst != NULL);
+  assert(mst->num_edges == 1);
+  assert(mst->total_weight == 2);
+
+  assert(dense_prim_mst(dense, 4, NULL) == NULL);
+  assert(create_dense_graph(0) == NULL);
+
+  free_mst(mst);
+  free_dense_graph(dense);
+  printf("테스트 통과\n");
+}
+
 int main(void)
 {
   printf("\n=== Improved Prim 알고리즘 유닛 테스트 시작 ===\n\n");
@@ -299,6 +491,11 @@ int main(void)
   test_equal_weights();
   test_performance_measurement();
   test_large_graph();
+  test_heap_arity();
+  test_lazy_prim_equal_result();
+  test_lazy_prim_edge_cases();
+  test_dense_prim_kernels();
+  test_dense_prim_edge_cases();
 
   printf("\n=== 모든 테스트 통과! ===\n\n");
 
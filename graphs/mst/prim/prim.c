@@ -104,31 +104,28 @@ void free_graph(Graph *graph)
 /* ========== Min-Heap 관련 함수 ========== */
 
 /**
- * Min-Heap 노드 생성
- * @param vertex: 정점 번호
- * @param key: 우선순위 값
- * @return: 생성된 노드 포인터
+ * Min-Heap 생성 (기본 자식 개수 HEAP_ARITY 사용)
+ * @param capacity: 힙의 최대 용량
+ * @return: 생성된 Min-Heap 포인터
  */
-static HeapNode *create_heap_node(int vertex, int key)
+MinHeap *create_min_heap(int capacity)
 {
-  HeapNode *node = (HeapNode *)malloc(sizeof(HeapNode));
-  if (!node)
-  {
-    return NULL;
-  }
-  node->vertex = vertex;
-  node->key = key;
-  return node;
+  return create_min_heap_with_arity(capacity, HEAP_ARITY);
 }
 
 /**
- * Min-Heap 생성
+ * 자식 개수를 지정해서 Min-Heap 생성
  * @param capacity: 힙의 최대 용량
+ * @param arity: 한 노드의 자식 개수 (2 이상)
  * @return: 생성된 Min-Heap 포인터
+ *
+ * 노드마다 malloc하지 않고 HeapNode 배열 하나에 저장하므로
+ * 비교할 때 포인터를 따라가지 않고, 형제 노드들이 같은 캐시 라인에 모임
+ * (arity 8이면 자식 8개 = 64바이트)
  */
-MinHeap *create_min_heap(int capacity)
+MinHeap *create_min_heap_with_arity(int capacity, int arity)
 {
-  if (capacity <= 0)
+  if (capacity <= 0 || arity < 2)
   {
     return NULL;
   }
@@ -140,7 +137,7 @@ MinHeap *create_min_heap(int capacity)
   }
 
   heap->pos = (int *)malloc(capacity * sizeof(int));
-  heap->array = (HeapNode **)malloc(capacity * sizeof(HeapNode *));
+  heap->array = (HeapNode *)malloc(capacity * sizeof(HeapNode));
 
   if (!heap->pos || !heap->array)
   {
@@ -152,6 +149,7 @@ MinHeap *create_min_heap(int capacity)
 
   heap->size = 0;
   heap->capacity = capacity;
+  heap->arity = arity;
 
   return heap;
 }
@@ -159,48 +157,63 @@ MinHeap *create_min_heap(int capacity)
 /**
  * 두 힙 노드 교환
  */
-void swap_heap_node(HeapNode **a, HeapNode **b)
+void swap_heap_node(HeapNode *a, HeapNode *b)
 {
-  HeapNode *temp = *a;
+  HeapNode temp = *a;
   *a = *b;
   *b = temp;
 }
 
 /**
- * Min-Heapify 연산
+ * Min-Heapify 연산 (아래로 내려가며 정리)
  * @param heap: Min-Heap 포인터
  * @param idx: heapify를 시작할 인덱스
+ *
+ * 매 단계마다 교환하는 대신 내려갈 노드를 들고 있다가
+ * 빈 자리(hole)에 작은 자식을 끌어올리고, 마지막에 한 번만 기록
  */
 void min_heapify(MinHeap *heap, int idx)
 {
-  int smallest = idx;
-  int left = 2 * idx + 1;
-  int right = 2 * idx + 2;
-
-  if (left < heap->size && heap->array[left]->key < heap->array[smallest]->key)
-  {
-    smallest = left;
-  }
+  HeapNode moving = heap->array[idx];
+  int d = heap->arity;
 
-  if (right < heap->size && heap->array[right]->key < heap->array[smallest]->key)
+  for (;;)
   {
-    smallest = right;
-  }
+    int first = d * idx + 1;
+    if (first >= heap->size)
+    {
+      break;
+    }
 
-  if (smallest != idx)
-  {
-    /* 위치 업데이트 */
-    HeapNode *smallest_node = heap->array[smallest];
-    HeapNode *idx_node = heap->array[idx];
+    int last = first + d;
+    if (last > heap->size)
+    {
+      last = heap->size;
+    }
 
-    heap->pos[smallest_node->vertex] = idx;
-    heap->pos[idx_node->vertex] = smallest;
+    /* 자식들 중 최소 key 찾기 */
+    int smallest = first;
+    for (int c = first + 1; c < last; c++)
+    {
+      if (heap->array[c].key < heap->array[smallest].key)
+      {
+        smallest = c;
+      }
+    }
 
-    /* 노드 교환 */
-    swap_heap_node(&heap->array[smallest], &heap->array[idx]);
+    if (heap->array[smallest].key >= moving.key)
+    {
+      break;
+    }
 
-    min_heapify(heap, smallest);
+    /* 작은 자식을 위로 끌어올리고 위치 업데이트 */
+    heap->array[idx] = heap->array[smallest];
+    heap->pos[heap->array[idx].vertex] = idx;
+    idx = smallest;
   }
+
+  heap->array[idx] = moving;
+  heap->pos[moving.vertex] = idx;
 }
 
 /**
@@ -214,29 +227,30 @@ bool is_empty(MinHeap *heap)
 /**
  * 최소값 추출
  * @param heap: Min-Heap 포인터
- * @return: 최소값을 가진 노드
+ * @return: 최소값을 가진 노드 (비어있으면 vertex == -1)
  */
-HeapNode *extract_min(MinHeap *heap)
+HeapNode extract_min(MinHeap *heap)
 {
   if (is_empty(heap))
   {
-    return NULL;
+    HeapNode none = {-1, INT_MAX};
+    return none;
   }
 
   /* 루트 노드 저장 */
-  HeapNode *root = heap->array[0];
-
-  /* 마지막 노드를 루트로 이동 */
-  HeapNode *last_node = heap->array[heap->size - 1];
-  heap->array[0] = last_node;
+  HeapNode root = heap->array[0];
 
-  /* 위치 업데이트 */
-  heap->pos[root->vertex] = heap->size - 1;
-  heap->pos[last_node->vertex] = 0;
-
-  /* 힙 크기 감소 및 heapify */
+  /* 힙 크기 감소: 추출된 정점은 pos == size가 되어 힙 밖으로 표시됨 */
   heap->size--;
-  min_heapify(heap, 0);
+  heap->pos[root.vertex] = heap->size;
+
+  /* 마지막 노드를 루트로 옮기고 heapify */
+  if (heap->size > 0)
+  {
+    heap->array[0] = heap->array[heap->size];
+    heap->pos[heap->array[0].vertex] = 0;
+    min_heapify(heap, 0);
+  }
 
   return root;
 }
@@ -251,23 +265,20 @@ void decrease_key(MinHeap *heap, int vertex, int key)
 {
   /* 힙에서 정점의 위치 찾기 */
   int i = heap->pos[vertex];
+  int d = heap->arity;
 
-  /* key 값 업데이트 */
-  heap->array[i]->key = key;
-
-  /* 부모와 비교하며 위로 이동 */
-  while (i > 0 && heap->array[i]->key < heap->array[(i - 1) / 2]->key)
+  /* 부모가 더 크면 부모를 아래로 내리면서 위로 이동 */
+  while (i > 0 && key < heap->array[(i - 1) / d].key)
   {
-    /* 위치 정보 교환 */
-    heap->pos[heap->array[i]->vertex] = (i - 1) / 2;
-    heap->pos[heap->array[(i - 1) / 2]->vertex] = i;
-
-    /* 노드 교환 */
-    swap_heap_node(&heap->array[i], &heap->array[(i - 1) / 2]);
-
-    /* 부모 위치로 이동 */
-    i = (i - 1) / 2;
+    int parent = (i - 1) / d;
+    heap->array[i] = heap->array[parent];
+    heap->pos[heap->array[i].vertex] = i;
+    i = parent;
   }
+
+  heap->array[i].vertex = vertex;
+  heap->array[i].key = key;
+  heap->pos[vertex] = i;
 }
 
 /**
@@ -296,12 +307,6 @@ void free_min_heap(MinHeap *heap)
     return;
   }
 
-  /* 남아있는 노드들 해제 */
-  for (int i = 0; i < heap->size; i++)
-  {
-    free(heap->array[i]);
-  }
-
   free(heap->pos);
   free(heap->array);
   free(heap);
@@ -350,24 +355,22 @@ MST *prim_mst(Graph *graph, int start_vertex)
   {
     parent[v] = -1;
     key[v] = INT_MAX;
-    heap->array[v] = create_heap_node(v, key[v]);
+    heap->array[v].vertex = v;
+    heap->array[v].key = key[v];
     heap->pos[v] = v;
   }
 
+  heap->size = V;
+
   /* 시작 정점의 key를 0으로 설정 */
   key[start_vertex] = 0;
-  heap->array[start_vertex]->key = 0;
   decrease_key(heap, start_vertex, key[start_vertex]);
 
-  heap->size = V;
-
   /* 힙이 빌 때까지 반복 */
   while (!is_empty(heap))
   {
     /* 최소 key를 가진 정점 추출 */
-    HeapNode *min_node = extract_min(heap);
-    int u = min_node->vertex;
-    free(min_node);
+    int u = extract_min(heap).vertex;
 
     /* u의 모든 인접 정점 확인 */
     AdjNode *adj = graph->adj_lists[u];
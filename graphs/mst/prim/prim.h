@@ -6,6 +6,11 @@
 #include <stdbool.h>
 #include <limits.h>
 
+/* 힙의 기본 자식 개수 (-DHEAP_ARITY=8 처럼 컴파일 시 변경 가능) */
+#ifndef HEAP_ARITY
+#define HEAP_ARITY 4
+#endif
+
 /* 인접 리스트의 노드 구조체 */
 typedef struct AdjNode
 {
@@ -28,13 +33,14 @@ typedef struct HeapNode
   int key;    /* 우선순위 (가중치) */
 } HeapNode;
 
-/* Min-Heap 구조체 */
+/* Min-Heap 구조체 (d-ary, 노드를 따로 할당하지 않고 연속 배열에 저장) */
 typedef struct MinHeap
 {
-  int size;         /* 현재 힙의 크기 */
-  int capacity;     /* 힙의 최대 용량 */
-  int *pos;         /* pos[v] = 정점 v가 힙에서 위치한 인덱스 */
-  HeapNode **array; /* 힙 배열 */
+  int size;        /* 현재 힙의 크기 */
+  int capacity;    /* 힙의 최대 용량 */
+  int arity;       /* 한 노드의 자식 개수 (2, 4, 8) */
+  int *pos;        /* pos[v] = 정점 v가 힙에서 위치한 인덱스 */
+  HeapNode *array; /* 힙 배열 (vertex, key 쌍이 연속으로 저장됨) */
 } MinHeap;
 
 /* MST 간선 구조체 */
@@ -60,10 +66,11 @@ void free_graph(Graph *graph);
 
 /* Min-Heap 관련 함수 */
 MinHeap *create_min_heap(int capacity);
-void swap_heap_node(HeapNode **a, HeapNode **b);
+MinHeap *create_min_heap_with_arity(int capacity, int arity);
+void swap_heap_node(HeapNode *a, HeapNode *b);
 void min_heapify(MinHeap *heap, int idx);
 bool is_empty(MinHeap *heap);
-HeapNode *extract_min(MinHeap *heap);
+HeapNode extract_min(MinHeap *heap);
 void decrease_key(MinHeap *heap, int vertex, int key);
 bool is_in_min_heap(MinHeap *heap, int vertex);
 void free_min_heap(MinHeap *heap);
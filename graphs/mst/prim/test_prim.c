@@ -255,6 +255,54 @@ void test_linear_graph()
   printf("  ✓ 통과\n");
 }
 
+/* 테스트 12: d-ary Min-Heap (자식 2, 4, 8개) */
+void test_heap_arity()
+{
+  printf("테스트 12: d-ary Min-Heap 추출 순서...\n");
+
+  int arities[] = {2, 4, 8};
+
+  for (int a = 0; a < 3; a++)
+  {
+    MinHeap *heap = create_min_heap_with_arity(20, arities[a]);
+    assert(heap != NULL);
+    assert(heap->arity == arities[a]);
+
+    /* 모든 정점을 INT_MAX로 넣고 decrease_key로 key 설정 */
+    for (int v = 0; v < 20; v++)
+    {
+      heap->array[v].vertex = v;
+      heap->array[v].key = INT_MAX;
+      heap->pos[v] = v;
+    }
+    heap->size = 20;
+
+    for (int v = 0; v < 20; v++)
+    {
+      decrease_key(heap, v, (v * 7) % 20);
+    }
+
+    /* key가 0부터 19까지 오름차순으로 나와야 함 */
+    for (int expected = 0; expected < 20; expected++)
+    {
+      HeapNode node = extract_min(heap);
+      assert(node.key == expected);
+      assert((node.vertex * 7) % 20 == expected);
+      assert(is_in_min_heap(heap, node.vertex) == false);
+    }
+
+    assert(is_empty(heap) == true);
+    assert(extract_min(heap).vertex == -1);
+
+    free_min_heap(heap);
+  }
+
+  /* 잘못된 자식 개수 */
+  assert(create_min_heap_with_arity(5, 1) == NULL);
+
+  printf("  ✓ 통과\n");
+}
+
 int main(void)
 {
   printf("\n=== Prim 알고리즘 유닛 테스트 시작 ===\n\n");
@@ -270,6 +318,7 @@ int main(void)
   test_equal_weights();
   test_large_weight_difference();
   test_linear_graph();
+  test_heap_arity();
 
   printf("\n=== 모든 테스트 통과!!! ===\n\n");
 
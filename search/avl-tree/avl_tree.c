@@ -0,0 +1,264 @@
+#include "avl_tree.h"
+
+/**
+ * 새로운 노드 생성
+ * @param data: 노드에 저장할 값
+ * @return: 생성된 노드 포인터
+ */
+Node *create_node(int data)
+{
+  Node *node = (Node *)malloc(sizeof(Node));
+  node->data = data;
+  node->height = 1;
+  node->left = NULL;
+  node->right = NULL;
+  return node;
+}
+
+/**
+ * 서브트리 높이 조회
+ * @param root: 서브트리의 루트
+ * @return: 높이 (빈 트리는 0)
+ */
+int tree_height(Node *root)
+{
+  return root == NULL ? 0 : root->height;
+}
+
+/* 자식들의 높이로 노드 높이 갱신 */
+static void update_height(Node *node)
+{
+  int lh = tree_height(node->left);
+  int rh = tree_height(node->right);
+  node->height = (lh > rh ? lh : rh) + 1;
+}
+
+/* 균형 인수 = 왼쪽 높이 - 오른쪽 높이 */
+static int balance_factor(Node *node)
+{
+  return tree_height(node->left) - tree_height(node->right);
+}
+
+/**
+ * 오른쪽 회전
+ *
+ *       y            x
+ *      / \          / \
+ *     x   C  -->   A   y
+ *    / \              / \
+ *   A   B            B   C
+ */
+static Node *rotate_right(Node *y)
+{
+  Node *x = y->left;
+  y->left = x->right;
+  x->right = y;
+  update_height(y);
+  update_height(x);
+  return x;
+}
+
+/* 왼쪽 회전 (rotate_right의 대칭) */
+static Node *rotate_left(Node *x)
+{
+  Node *y = x->right;
+  x->right = y->left;
+  y->left = x;
+  update_height(x);
+  update_height(y);
+  return y;
+}
+
+/**
+ * 높이를 갱신하고 균형 인수가 ±2가 되었으면 회전으로 복구
+ * @param node: 자식 서브트리가 바뀐 노드
+ * @return: 균형을 맞춘 서브트리의 새 루트
+ *
+ * LL/RR은 한 번, LR/RL은 두 번 회전한다.
+ */
+static Node *rebalance(Node *node)
+{
+  update_height(node);
+  int balance = balance_factor(node);
+
+  if (balance > 1)
+  {
+    // LR: 왼쪽 자식을 먼저 왼쪽으로 회전
+    if (balance_factor(node->left) < 0)
+    {
+      node->left = rotate_left(node->left);
+    }
+    return rotate_right(node);
+  }
+
+  if (balance < -1)
+  {
+    // RL: 오른쪽 자식을 먼저 오른쪽으로 회전
+    if (balance_factor(node->right) > 0)
+    {
+      node->right = rotate_right(node->right);
+    }
+    return rotate_left(node);
+  }
+
+  return node;
+}
+
+/**
+ * AVL 트리에 값 삽입
+ * @param root: 트리의 루트 노드
+ * @param data: 삽입할 값
+ * @return: 삽입 후 루트 노드
+ *
+ * 시간 복잡도: 최악 O(log n) (정렬된 순서로 넣어도 높이 ≤ 1.44 log n)
+ */
+Node *insert_node(Node *root, int data)
+{
+  if (root == NULL)
+  {
+    return create_node(data);
+  }
+
+  if (data < root->data)
+  {
+    root->left = insert_node(root->left, data);
+  }
+  else if (data > root->data)
+  {
+    root->right = insert_node(root->right, data);
+  }
+  else
+  {
+    // 같은 값은 무시 (중복 허용 안 함), 구조가 바뀌지 않았으므로 회전 불필요
+    return root;
+  }
+
+  return rebalance(root);
+}
+
+/**
+ * AVL 트리에서 값 탐색
+ * @param root: 트리의 루트 노드
+ * @param data: 찾을 값
+ * @return: 찾은 노드, 없으면 NULL
+ *
+ * 시간 복잡도: 최악 O(log n)
+ */
+Node *search_node(Node *root, int data)
+{
+  while (root != NULL && root->data != data)
+  {
+    root = data < root->data ? root->left : root->right;
+  }
+  return root;
+}
+
+/**
+ * 서브트리에서 최솟값 노드 찾기 (가장 왼쪽 노드)
+ * @param root: 서브트리의 루트
+ * @return: 최솟값을 가진 노드
+ */
+Node *find_min(Node *root)
+{
+  while (root != NULL && root->left != NULL)
+  {
+    root = root->left;
+  }
+  return root;
+}
+
+/**
+ * AVL 트리에서 값 삭제
+ * @param root: 트리의 루트 노드
+ * @param data: 삭제할 값
+ * @return: 삭제 후 루트 노드
+ *
+ * BST와 같은 3가지 케이스로 삭제한 뒤,
+ * 돌아오는 경로의 모든 노드에서 rebalance를 수행한다.
+ */
+Node *delete_node(Node *root, int data)
+{
+  if (root == NULL)
+  {
+    return NULL;
+  }
+
+  if (data < root->data)
+  {
+    root->left = delete_node(root->left, data);
+  }
+  else if (data > root->data)
+  {
+    root->right = delete_node(root->right, data);
+  }
+  else
+  {
+    // 케이스 1, 2: 자식이 없거나 하나만 있는 경우
+    if (root->left == NULL || root->right == NULL)
+    {
+      Node *temp = root->left != NULL ? root->left : root->right;
+      free(root);
+      return temp;
+    }
+
+    // 케이스 3: 오른쪽 서브트리의 최솟값으로 대체
+    Node *temp = find_min(root->right);
+    root->data = temp->data;
+    root->right = delete_node(root->right, temp->data);
+  }
+
+  return rebalance(root);
+}
+
+/**
+ * 중위 순회 (Inorder: Left -> Root -> Right)
+ */
+void inorder_traversal(Node *root)
+{
+  if (root != NULL)
+  {
+    inorder_traversal(root->left);
+    printf("%d ", root->data);
+    inorder_traversal(root->right);
+  }
+}
+
+/**
+ * 전위 순회 (Preorder: Root -> Left -> Right)
+ */
+void preorder_traversal(Node *root)
+{
+  if (root != NULL)
+  {
+    printf("%d ", root->data);
+    preorder_traversal(root->left);
+    preorder_traversal(root->right);
+  }
+}
+
+/**
+ * 후위 순회 (Postorder: Left -> Right -> Root)
+ */
+void postorder_traversal(Node *root)
+{
+  if (root != NULL)
+  {
+    postorder_traversal(root->left);
+    postorder_traversal(root->right);
+    printf("%d ", root->data);
+  }
+}
+
+/**
+ * 트리 전체 메모리 해제 (후위 순회 방식)
+ * 높이가 O(log n)이므로 재귀 깊이도 O(log n)
+ */
+void free_tree(Node *root)
+{
+  if (root != NULL)
+  {
+    free_tree(root->left);
+    free_tree(root->right);
+    free(root);
+  }
+}
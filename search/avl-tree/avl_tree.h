@@ -0,0 +1,39 @@
+#ifndef AVL_TREE_H
+#define AVL_TREE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+/*
+ * AVL 트리 노드 구조체
+ * 이진 탐색 트리(binary-search-tree)와 같은 API를 제공하며,
+ * 모든 노드에서 왼쪽/오른쪽 서브트리 높이 차이가 1 이하로 유지된다.
+ */
+typedef struct Node
+{
+  int data;
+  int height; /* 이 노드를 루트로 하는 서브트리의 높이 (리프 = 1) */
+  struct Node *left;
+  struct Node *right;
+} Node;
+
+/* AVL 트리 함수 선언 (binary-search-tree와 동일한 시그니처) */
+Node *create_node(int data);
+Node *insert_node(Node *root, int data);
+Node *search_node(Node *root, int data);
+Node *delete_node(Node *root, int data);
+Node *find_min(Node *root);
+
+/* 높이 조회 (빈 트리 = 0) */
+int tree_height(Node *root);
+
+/* 순회 함수 */
+void inorder_traversal(Node *root);
+void preorder_traversal(Node *root);
+void postorder_traversal(Node *root);
+
+/* 메모리 해제 */
+void free_tree(Node *root);
+
+#endif // AVL_TREE_H
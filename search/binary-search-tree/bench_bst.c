@@ -0,0 +1,381 @@
+#include "bst.h"
+#include "bst_file.h"
+#include "slab.h"
+#include <string.h>
+#include <time.h>
+
+/*
+ * 벤치마크: 반복 구현(bst.c) vs 재귀 구현(아래 기존 코드)
+ * 1. 랜덤 순서 키 - 높이 O(log n), 함수 호출 비용 비교
+ * 2. 정렬된 순서 키 - 편향 트리, 깊이 n의 재귀
+ * build 모드: 삽입 반복 vs build_from_sorted, 삽입 반복 vs merge_trees
+ * load 모드: 시작 시 삽입 반복으로 재구성 vs 저장된 인덱스 파일에서 불러오기
+ */
+
+/* ---------- 비교용 재귀 구현 (반복 구현 이전의 bst.c) ---------- */
+
+static Node *recursive_insert(Node *root, int data)
+{
+  if (root == NULL)
+  {
+    return create_node(data);
+  }
+  if (data < root->data)
+  {
+    root->left = recursive_insert(root->left, data);
+  }
+  else if (data > root->data)
+  {
+    root->right = recursive_insert(root->right, data);
+  }
+  return root;
+}
+
+static Node *recursive_search(Node *root, int data)
+{
+  if (root == NULL || root->data == data)
+  {
+    return root;
+  }
+  if (data < root->data)
+  {
+    return recursive_search(root->left, data);
+  }
+  return recursive_search(root->right, data);
+}
+
+static Node *recursive_delete(Node *root, int data)
+{
+  if (root == NULL)
+  {
+    return NULL;
+  }
+  if (data < root->data)
+  {
+    root->left = recursive_delete(root->left, data);
+  }
+  else if (data > root->data)
+  {
+    root->right = recursive_delete(root->right, data);
+  }
+  else
+  {
+    if (root->left == NULL)
+    {
+      Node *temp = root->right;
+      free(root);
+      return temp;
+    }
+    else if (root->right == NULL)
+    {
+      Node *temp = root->left;
+      free(root);
+      return temp;
+    }
+    Node *temp = find_min(root->right);
+    root->data = temp->data;
+    root->right = recursive_delete(root->right, temp->data);
+  }
+  return root;
+}
+
+static void recursive_free(Node *root)
+{
+  if (root != NULL)
+  {
+    recursive_free(root->left);
+    recursive_free(root->right);
+    free(root);
+  }
+}
+
+/* ---------- 측정 ---------- */
+
+typedef struct Operations
+{
+  const char *name;
+  Node *(*insert)(Node *, int);
+  Node *(*search)(Node *, int);
+  Node *(*remove)(Node *, int);
+  void (*release)(Node *);
+} Operations;
+
+static double now_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* 0..n-1을 섞은 배열 (Fisher-Yates) */
+static int *shuffled_keys(int n, unsigned int seed)
+{
+  int *keys = (int *)malloc(n * sizeof(int));
+  for (int i = 0; i < n; i++)
+  {
+    keys[i] = i;
+  }
+  for (int i = n - 1; i > 0; i--)
+  {
+    seed = seed * 1103515245u + 12345u;
+    int j = (int)((seed >> 8) % (unsigned int)(i + 1));
+    int temp = keys[i];
+    keys[i] = keys[j];
+    keys[j] = temp;
+  }
+  return keys;
+}
+
+/**
+ * 삽입 -> 탐색 -> 절반 삭제 -> 전체 해제 시간 측정
+ * @param order: 삽입 순서
+ * @param lookups: 탐색 순서
+ */
+static void run(const Operations *ops, const int *order, const int *lookups, int n)
+{
+  double t0 = now_seconds();
+  Node *root = NULL;
+  for (int i = 0; i < n; i++)
+  {
+    root = ops->insert(root, order[i]);
+  }
+
+  double t1 = now_seconds();
+  long found = 0;
+  for (int i = 0; i < n; i++)
+  {
+    found += ops->search(root, lookups[i]) != NULL;
+  }
+
+  double t2 = now_seconds();
+  for (int i = 0; i < n; i += 2)
+  {
+    root = ops->remove(root, lookups[i]);
+  }
+
+  double t3 = now_seconds();
+  ops->release(root);
+  double t4 = now_seconds();
+
+  printf("  %-6s 삽입 %8.3f  탐색 %8.3f  삭제 %8.3f  해제 %8.3f  (초)%s\n",
+         ops->name, t1 - t0, t2 - t1, t3 - t2, t4 - t3,
+         found == n ? "" : "  [탐색 누락]");
+}
+
+/* 탐색 n회 시간 (초) */
+static double time_lookups(Node *root, const int *lookups, int n, long *found)
+{
+  double start = now_seconds();
+  *found = 0;
+  for (int i = 0; i < n; i++)
+  {
+    *found += search_node(root, lookups[i]) != NULL;
+  }
+  return now_seconds() - start;
+}
+
+/**
+ * 일괄 구성: 정렬된 키 n개로 인덱스를 다시 만드는 시간
+ * 1. 랜덤 순서 insert_node 반복 (정렬된 순서로 넣으면 O(n²)이라 비교 불가)
+ * 2. build_from_sorted (malloc)
+ * 3. build_from_sorted (슬랩, 노드 연속 배치)
+ * 병합: 짝수 키 트리 + 홀수 키 트리
+ */
+static void run_bulk_build(int n)
+{
+  int *sorted = (int *)malloc(n * sizeof(int));
+  for (int i = 0; i < n; i++)
+  {
+    sorted[i] = i;
+  }
+  int *order = shuffled_keys(n, 1);
+  int *lookups = shuffled_keys(n, 2);
+  long found;
+
+  printf("=== BST 일괄 구성: 키 %d개 ===\n", n);
+
+  double start = now_seconds();
+  Node *root = NULL;
+  for (int i = 0; i < n; i++)
+  {
+    root = insert_node(root, order[i]);
+  }
+  double elapsed = now_seconds() - start;
+  double lookup = time_lookups(root, lookups, n, &found);
+  printf("  %-26s 구성 %8.3f  탐색 %8.3f  높이 %2d  (초)\n", "insert_node 반복 (랜덤)",
+         elapsed, lookup, tree_height(root));
+  free_tree(root);
+
+  start = now_seconds();
+  root = build_from_sorted(sorted, n);
+  elapsed = now_seconds() - start;
+  lookup = time_lookups(root, lookups, n, &found);
+  printf("  %-26s 구성 %8.3f  탐색 %8.3f  높이 %2d  (초)\n", "build_from_sorted",
+         elapsed, lookup, tree_height(root));
+  free_tree(root);
+
+  SlabAllocator *slab = create_slab_allocator(sizeof(Node), 4096);
+  bst_set_allocator(slab);
+  start = now_seconds();
+  root = build_from_sorted(sorted, n);
+  elapsed = now_seconds() - start;
+  lookup = time_lookups(root, lookups, n, &found);
+  printf("  %-26s 구성 %8.3f  탐색 %8.3f  높이 %2d  (초)\n", "build_from_sorted (슬랩)",
+         elapsed, lookup, tree_height(root));
+  free_tree(root);
+  bst_set_allocator(NULL);
+  destroy_slab_allocator(slab);
+
+  // 병합: 짝수 / 홀수 키를 각각 랜덤 순서로 삽입한 두 트리
+  for (int pass = 0; pass < 2; pass++)
+  {
+    Node *a = NULL;
+    Node *b = NULL;
+    for (int i = 0; i < n; i++)
+    {
+      if (order[i] % 2 == 0)
+      {
+        a = insert_node(a, order[i]);
+      }
+      else
+      {
+        b = insert_node(b, order[i]);
+      }
+    }
+
+    start = now_seconds();
+    if (pass == 0)
+    {
+      // b의 키를 a에 하나씩 삽입
+      BSTIterator *it = create_bst_iterator(b);
+      while (bst_iterator_has_next(it))
+      {
+        a = insert_node(a, bst_iterator_next(it)->data);
+      }
+      free_bst_iterator(it);
+      free_tree(b);
+    }
+    else
+    {
+      a = merge_trees(a, b);
+    }
+    elapsed = now_seconds() - start;
+    lookup = time_lookups(a, lookups, n, &found);
+    printf("  %-26s 병합 %8.3f  탐색 %8.3f  높이 %2d  (초)%s\n",
+           pass == 0 ? "insert_node로 병합" : "merge_trees", elapsed, lookup, tree_height(a),
+           found == n ? "" : "  [탐색 누락]");
+    free_tree(a);
+  }
+  printf("\n");
+
+  free(sorted);
+  free(order);
+  free(lookups);
+}
+
+/**
+ * 프로세스 시작 시 인덱스 재구성 시간
+ * 1. 키 목록을 insert_node로 하나씩 삽입 (지금까지의 방식)
+ * 2. bst_load: 파일 매핑 + 체크섬 검증 + build_from_sorted
+ * 3. bst_open_key_file: 매핑 + 체크섬 검증만 (트리 없이 정렬 배열로 사용)
+ */
+static void run_load(int n)
+{
+  const char *path = "bench_bst_index.bin";
+  int *order = shuffled_keys(n, 1);
+
+  printf("=== BST 인덱스 불러오기: 키 %d개 ===\n", n);
+
+  double start = now_seconds();
+  Node *root = NULL;
+  for (int i = 0; i < n; i++)
+  {
+    root = insert_node(root, order[i]);
+  }
+  double elapsed = now_seconds() - start;
+  printf("  %-26s %8.3f 초\n", "insert_node 반복", elapsed);
+
+  start = now_seconds();
+  bool saved = bst_save(root, path);
+  elapsed = now_seconds() - start;
+  printf("  %-26s %8.3f 초%s\n", "bst_save", elapsed, saved ? "" : "  [실패]");
+  free_tree(root);
+
+  start = now_seconds();
+  root = NULL;
+  bool loaded = bst_load(path, &root);
+  elapsed = now_seconds() - start;
+  printf("  %-26s %8.3f 초  (높이 %d)%s\n", "bst_load", elapsed, tree_height(root),
+         loaded && bst_size(root) == n ? "" : "  [실패]");
+  free_tree(root);
+
+  BSTKeyFile file;
+  start = now_seconds();
+  bool opened = bst_open_key_file(path, &file);
+  elapsed = now_seconds() - start;
+  printf("  %-26s %8.3f 초%s\n\n", "bst_open_key_file", elapsed,
+         opened && file.count == (size_t)n ? "" : "  [실패]");
+  if (opened)
+  {
+    bst_close_key_file(&file);
+  }
+
+  remove(path);
+  free(order);
+}
+
+int main(int argc, char *argv[])
+{
+  Operations recursive = {"재귀", recursive_insert, recursive_search,
+                          recursive_delete, recursive_free};
+  Operations iterative = {"반복", insert_node, search_node, delete_node, free_tree};
+
+  /*
+   * 한 프로세스에서 두 구현을 연달아 돌리면 앞 구현이 해제한 노드들의
+   * 힙 배치 때문에 뒤 구현의 캐시 효율이 달라진다.
+   * 그래서 구현마다 프로세스를 따로 띄운다: ./bench_bst recursive|iterative|build|load
+   */
+  if (argc > 1 && strcmp(argv[1], "build") == 0)
+  {
+    run_bulk_build(1000000);
+    return 0;
+  }
+  if (argc > 1 && strcmp(argv[1], "load") == 0)
+  {
+    run_load(1000000);
+    return 0;
+  }
+
+  const Operations *ops = &iterative;
+  if (argc > 1 && strcmp(argv[1], "recursive") == 0)
+  {
+    ops = &recursive;
+  }
+
+  printf("=== BST 벤치마크: %s 구현 ===\n", ops->name);
+
+  // 1. 랜덤 순서: 높이가 낮아 재귀도 안전, 호출 비용만 차이
+  int n = 1000000;
+  int *order = shuffled_keys(n, 1);
+  int *lookups = shuffled_keys(n, 2);
+  printf("랜덤 순서 키 %d개\n", n);
+  run(ops, order, lookups, n);
+  free(order);
+  free(lookups);
+
+  // 2. 정렬된 순서: 깊이 n의 편향 트리 (연산당 O(n))
+  n = 20000;
+  order = (int *)malloc(n * sizeof(int));
+  for (int i = 0; i < n; i++)
+  {
+    order[i] = i;
+  }
+  lookups = shuffled_keys(n, 3);
+  printf("정렬된 순서 키 %d개 (편향 트리, 깊이 %d)\n", n, n);
+  run(ops, order, lookups, n);
+  free(order);
+  free(lookups);
+  printf("\n");
+
+  return 0;
+}
@@ -1,4 +1,36 @@
 #include "bst.h"
+#include "slab.h"
+
+/* 노드 할당기 (NULL이면 malloc/free) */
+static SlabAllocator *node_allocator = NULL;
+
+/**
+ * 노드 할당기 설정
+ * @param slab: sizeof(Node) 이상 크기의 슬랩 할당기, NULL이면 malloc으로 복귀
+ * @return: 설정했으면 true (객체 크기가 작으면 false)
+ */
+bool bst_set_allocator(SlabAllocator *slab)
+{
+  if (slab != NULL && slab->object_size < sizeof(Node))
+  {
+    return false;
+  }
+  node_allocator = slab;
+  return true;
+}
+
+/* 노드 하나 반납 */
+static void release_node(Node *node)
+{
+  if (node_allocator != NULL)
+  {
+    slab_free(node_allocator, node);
+  }
+  else
+  {
+    free(node);
+  }
+}
 
 /**
  * 새로운 노드 생성
@@ -7,68 +39,69 @@
  */
 Node *create_node(int data)
 {
-  Node *node = (Node *)malloc(sizeof(Node));
+  Node *node = node_allocator != NULL ? (Node *)slab_alloc(node_allocator)
+                                      : (Node *)malloc(sizeof(Node));
   node->data = data;
+  node->size = 1;
   node->left = NULL;
   node->right = NULL;
   return node;
 }
 
 /**
- * BST에 값 삽입
+ * BST에 값 삽입 (반복)
  * @param root: 트리의 루트 노드
  * @param data: 삽입할 값
  * @return: 삽입 후 루트 노드
  *
- * 시간 복잡도: 평균 O(log n), 최악 O(n)
+ * 부모의 자식 링크(Node **)를 따라 내려가므로 루트/비루트 구분이 없고,
+ * 재귀를 쓰지 않아 한쪽으로 치우친 트리에서도 스택이 넘치지 않는다.
+ * 내려가면서 경로의 서브트리 크기를 미리 1씩 늘리고,
+ * 중복이면 같은 경로를 다시 내려가며 되돌린다.
+ *
+ * 시간 복잡도: 평균 O(log n), 최악 O(n) / 추가 공간: O(1)
  */
 Node *insert_node(Node *root, int data)
 {
-  // 빈 트리이거나 삽입 위치에 도달
-  if (root == NULL)
-  {
-    return create_node(data);
-  }
+  Node **link = &root;
 
-  // 작으면 왼쪽 서브트리로
-  if (data < root->data)
-  {
-    root->left = insert_node(root->left, data);
-  }
-  // 크면 오른쪽 서브트리로
-  else if (data > root->data)
+  // 빈 링크(삽입 위치)에 도달할 때까지 내려감
+  while (*link != NULL)
   {
-    root->right = insert_node(root->right, data);
+    if (data == (*link)->data)
+    {
+      // 같은 값은 무시 (중복 허용 안 함): 늘린 크기 되돌리기
+      for (Node *node = root; node != *link; node = data < node->data ? node->left : node->right)
+      {
+        node->size--;
+      }
+      return root;
+    }
+
+    (*link)->size++;
+    link = data < (*link)->data ? &(*link)->left : &(*link)->right;
   }
-  // 같은 값은 무시 (중복 허용 안 함)
 
+  *link = create_node(data);
   return root;
 }
 
 /**
- * BST에서 값 탐색
+ * BST에서 값 탐색 (반복)
  * @param root: 트리의 루트 노드
  * @param data: 찾을 값
  * @return: 찾은 노드, 없으면 NULL
  *
- * 시간 복잡도: 평균 O(log n), 최악 O(n)
+ * 시간 복잡도: 평균 O(log n), 최악 O(n) / 추가 공간: O(1)
  */
 Node *search_node(Node *root, int data)
 {
-  // 빈 트리이거나 찾았음
-  if (root == NULL || root->data == data)
+  while (root != NULL && root->data != data)
   {
-    return root;
+    // 작으면 왼쪽, 크면 오른쪽 서브트리로
+    root = data < root->data ? root->left : root->right;
   }
-
-  // 작으면 왼쪽 서브트리에서 탐색
-  if (data < root->data)
-  {
-    return search_node(root->left, data);
-  }
-
-  // 크면 오른쪽 서브트리에서 탐색
-  return search_node(root->right, data);
+  return root;
 }
 
 /**
@@ -86,7 +119,7 @@ Node *find_min(Node *root)
 }
 
 /**
- * BST에서 값 삭제
+ * BST에서 값 삭제 (반복)
  * @param root: 트리의 루트 노드
  * @param data: 삭제할 값
  * @return: 삭제 후 루트 노드
@@ -95,105 +128,730 @@ Node *find_min(Node *root)
  * 1. 자식이 없는 경우 (리프 노드) - 그냥 삭제
  * 2. 자식이 하나인 경우 - 자식으로 대체
  * 3. 자식이 둘인 경우 - 오른쪽 서브트리의 최솟값으로 대체
+ *
+ * 서브트리 크기는 삽입과 같은 방식으로 내려가며 미리 줄이고,
+ * 값이 없으면 되돌린다.
+ *
+ * 시간 복잡도: 평균 O(log n), 최악 O(n) / 추가 공간: O(1)
  */
 Node *delete_node(Node *root, int data)
 {
-  if (root == NULL)
+  // 삭제할 노드를 가리키는 링크 찾기
+  Node **link = &root;
+  while (*link != NULL && (*link)->data != data)
+  {
+    (*link)->size--;
+    link = data < (*link)->data ? &(*link)->left : &(*link)->right;
+  }
+
+  Node *target = *link;
+  if (target == NULL)
+  {
+    // 없는 값: 줄인 크기 되돌리기
+    for (Node *node = root; node != NULL; node = data < node->data ? node->left : node->right)
+    {
+      node->size++;
+    }
+    return root;
+  }
+  target->size--;
+
+  // 케이스 1, 2: 자식이 없거나 하나만 있는 경우
+  if (target->left == NULL)
+  {
+    *link = target->right;
+    release_node(target);
+    return root;
+  }
+  if (target->right == NULL)
+  {
+    *link = target->left;
+    release_node(target);
+    return root;
+  }
+
+  // 케이스 3: 오른쪽 서브트리의 최솟값(후계자)을 찾아 값을 복사
+  Node **successor_link = &target->right;
+  while ((*successor_link)->left != NULL)
+  {
+    (*successor_link)->size--;
+    successor_link = &(*successor_link)->left;
+  }
+
+  // 후계자는 왼쪽 자식이 없으므로 오른쪽 자식으로 대체하면 됨
+  Node *successor = *successor_link;
+  target->data = successor->data;
+  *successor_link = successor->right;
+  release_node(successor);
+
+  return root;
+}
+
+/**
+ * 중위 순회 (Inorder: Left -> Root -> Right) - Morris 순회
+ * BST에서는 오름차순 정렬된 순서로 출력됨
+ *
+ * 왼쪽 서브트리의 가장 오른쪽 노드(전임자)의 right를 잠시 현재 노드로
+ * 연결(스레드)해 두었다가, 두 번째 방문 때 원래대로 되돌린다.
+ * 스택 없이 O(1) 추가 공간으로 순회하며, 순회가 끝나면 트리는 원래 모양이다.
+ */
+void inorder_traversal(Node *root)
+{
+  Node *current = root;
+
+  while (current != NULL)
+  {
+    if (current->left == NULL)
+    {
+      printf("%d ", current->data);
+      current = current->right;
+      continue;
+    }
+
+    // 전임자 찾기 (이미 스레드가 걸려 있으면 current에서 멈춤)
+    Node *predecessor = current->left;
+    while (predecessor->right != NULL && predecessor->right != current)
+    {
+      predecessor = predecessor->right;
+    }
+
+    if (predecessor->right == NULL)
+    {
+      // 첫 방문: 스레드를 걸고 왼쪽으로
+      predecessor->right = current;
+      current = current->left;
+    }
+    else
+    {
+      // 두 번째 방문: 왼쪽 서브트리 완료, 스레드 제거 후 출력
+      predecessor->right = NULL;
+      printf("%d ", current->data);
+      current = current->right;
+    }
+  }
+}
+
+/**
+ * 전위 순회 (Preorder: Root -> Left -> Right) - Morris 순회
+ * 중위 순회와 같지만 첫 방문(스레드를 걸 때) 시점에 출력한다.
+ */
+void preorder_traversal(Node *root)
+{
+  Node *current = root;
+
+  while (current != NULL)
+  {
+    if (current->left == NULL)
+    {
+      printf("%d ", current->data);
+      current = current->right;
+      continue;
+    }
+
+    Node *predecessor = current->left;
+    while (predecessor->right != NULL && predecessor->right != current)
+    {
+      predecessor = predecessor->right;
+    }
+
+    if (predecessor->right == NULL)
+    {
+      printf("%d ", current->data);
+      predecessor->right = current;
+      current = current->left;
+    }
+    else
+    {
+      predecessor->right = NULL;
+      current = current->right;
+    }
+  }
+}
+
+/**
+ * 후위 순회 (Postorder: Left -> Right -> Root) - 명시적 스택
+ *
+ * 힙에 할당한 스택에 내려온 경로를 쌓고, 직전에 출력한 노드(last)로
+ * 오른쪽 서브트리를 이미 끝냈는지 판단한다.
+ * 스택은 트리 높이만큼만 커지며 필요할 때 두 배로 늘린다.
+ */
+void postorder_traversal(Node *root)
+{
+  int capacity = 64;
+  int top = 0;
+  Node **stack = (Node **)malloc(capacity * sizeof(Node *));
+  if (stack == NULL)
+  {
+    return;
+  }
+
+  Node *current = root;
+  Node *last = NULL;
+
+  while (current != NULL || top > 0)
+  {
+    // 왼쪽 끝까지 경로를 스택에 쌓음
+    while (current != NULL)
+    {
+      if (top == capacity)
+      {
+        Node **grown = (Node **)realloc(stack, 2 * capacity * sizeof(Node *));
+        if (grown == NULL)
+        {
+          free(stack);
+          return;
+        }
+        stack = grown;
+        capacity *= 2;
+      }
+      stack[top++] = current;
+      current = current->left;
+    }
+
+    Node *peek = stack[top - 1];
+    if (peek->right != NULL && peek->right != last)
+    {
+      // 오른쪽 서브트리를 아직 방문하지 않음
+      current = peek->right;
+    }
+    else
+    {
+      printf("%d ", peek->data);
+      last = peek;
+      top--;
+    }
+  }
+
+  free(stack);
+}
+
+/**
+ * 트리 전체 메모리 해제 (회전 방식)
+ * @param root: 트리의 루트 노드
+ *
+ * 왼쪽 자식이 있으면 오른쪽으로 회전해 왼쪽 서브트리를 위로 끌어올리고,
+ * 왼쪽 자식이 없으면 현재 노드를 해제한 뒤 오른쪽으로 이동한다.
+ * 트리를 오른쪽 사슬로 펴가며 해제하므로 추가 공간은 O(1), 시간은 O(n).
+ */
+void free_tree(Node *root)
+{
+  while (root != NULL)
+  {
+    if (root->left != NULL)
+    {
+      Node *left = root->left;
+      root->left = left->right;
+      left->right = root;
+      root = left;
+    }
+    else
+    {
+      Node *right = root->right;
+      release_node(root);
+      root = right;
+    }
+  }
+}
+
+/* ---------- 일괄 구성 ---------- */
+
+/*
+ * nodes[lo..hi] (오름차순)를 가운데 노드를 루트로 하는 균형 트리로 연결
+ * 재귀 깊이는 log2(n)이다.
+ */
+static Node *link_balanced(Node **nodes, int lo, int hi)
+{
+  if (lo > hi)
   {
     return NULL;
   }
 
-  // 삭제할 노드 찾기
-  if (data < root->data)
+  int mid = lo + (hi - lo) / 2;
+  Node *root = nodes[mid];
+  root->left = link_balanced(nodes, lo, mid - 1);
+  root->right = link_balanced(nodes, mid + 1, hi);
+  root->size = hi - lo + 1;
+  return root;
+}
+
+/*
+ * keys[lo..hi]로 균형 트리 구성, 노드는 pool에서 전위 순서로 꺼냄
+ * 전위 순서로 배치하면 부모 바로 뒤에 왼쪽 자식이 오므로 탐색 경로가 가깝다.
+ * pool이 없으면(슬랩 할당기 미설정) 노드마다 malloc하고, 실패하면 *failed를 켜고
+ * 이 서브트리에서 만든 노드를 모두 해제한 뒤 NULL을 돌려준다.
+ */
+static Node *build_balanced(const int *keys, int lo, int hi, Node *pool, int *next, bool *failed)
+{
+  if (lo > hi)
   {
-    root->left = delete_node(root->left, data);
+    return NULL;
   }
-  else if (data > root->data)
+
+  int mid = lo + (hi - lo) / 2;
+  Node *root = pool != NULL ? &pool[(*next)++] : (Node *)malloc(sizeof(Node));
+  if (root == NULL)
   {
-    root->right = delete_node(root->right, data);
+    *failed = true;
+    return NULL;
   }
-  else
+  root->data = keys[mid];
+  root->size = hi - lo + 1;
+  root->left = build_balanced(keys, lo, mid - 1, pool, next, failed);
+  root->right = *failed ? NULL : build_balanced(keys, mid + 1, hi, pool, next, failed);
+  if (*failed)
   {
-    // 찾았음! 삭제 처리
+    free_tree(root);
+    return NULL;
+  }
+  return root;
+}
 
-    // 케이스 1: 자식이 없거나 하나만 있는 경우
-    if (root->left == NULL)
+/**
+ * 정렬된 키로 완전 균형 트리 구성
+ * @param keys: 엄격히 증가하는 키 배열
+ * @param n: 키 개수
+ * @return: 루트 노드 (정렬되지 않았거나 n <= 0이거나 할당 실패 시 NULL)
+ *
+ * 가운데 키를 루트로 삼아 양쪽을 재귀적으로 구성하므로 높이는 ceil(log2(n + 1)).
+ * 슬랩 할당기가 설정되어 있으면 노드 n개를 slab_alloc_contiguous로
+ * 한 덩어리에 배치한다 (각 노드는 이후 delete_node/free_tree로 개별 반납 가능).
+ *
+ * 시간 복잡도: O(n)  (insert_node 반복은 정렬된 입력에서 O(n²))
+ */
+Node *build_from_sorted(const int *keys, int n)
+{
+  if (keys == NULL || n <= 0)
+  {
+    return NULL;
+  }
+  for (int i = 1; i < n; i++)
+  {
+    if (keys[i - 1] >= keys[i])
     {
-      Node *temp = root->right;
-      free(root);
-      return temp;
+      return NULL;
     }
-    else if (root->right == NULL)
+  }
+
+  Node *pool = NULL;
+  if (node_allocator != NULL)
+  {
+    pool = (Node *)slab_alloc_contiguous(node_allocator, (size_t)n);
+    if (pool == NULL)
     {
-      Node *temp = root->left;
-      free(root);
-      return temp;
+      return NULL;
     }
+  }
+
+  int next = 0;
+  bool failed = false;
+  return build_balanced(keys, 0, n - 1, pool, &next, &failed);
+}
+
+/* 트리의 노드들을 오름차순으로 nodes에 담음 (반복자 이용, 메모리 부족이면 -1) */
+static int collect_nodes(Node *root, Node **nodes)
+{
+  int count = 0;
+  BSTIterator *it = create_bst_iterator(root);
+  if (it == NULL)
+  {
+    return -1;
+  }
+  while (bst_iterator_has_next(it))
+  {
+    nodes[count++] = bst_iterator_next(it);
+  }
+  if (bst_iterator_failed(it))
+  {
+    count = -1;
+  }
+  free_bst_iterator(it);
+  return count;
+}
 
-    // 케이스 3: 자식이 둘 다 있는 경우
-    // 오른쪽 서브트리의 최솟값 찾기
-    Node *temp = find_min(root->right);
+/**
+ * 두 트리를 하나의 균형 트리로 병합
+ * @param a, b: 병합할 트리 (둘 다 소비됨)
+ * @return: 병합된 트리의 루트 (할당 실패 시 NULL, 이때 a와 b는 그대로)
+ *
+ * 1. 각 트리를 중위 순서로 노드 배열에 펼침 (O(n), O(m))
+ * 2. 두 정렬 배열을 병합, 같은 키는 하나만 남기고 나머지 노드는 반납
+ * 3. 병합된 배열로 균형 트리를 다시 연결 (O(n + m))
+ * 새 노드를 만들지 않고 기존 노드의 링크만 바꾼다.
+ */
+Node *merge_trees(Node *a, Node *b)
+{
+  int n = bst_size(a);
+  int m = bst_size(b);
+  if (n == 0)
+  {
+    return b;
+  }
+  if (m == 0)
+  {
+    return a;
+  }
 
-    // 최솟값을 현재 노드로 복사
-    root->data = temp->data;
+  Node **left = (Node **)malloc(n * sizeof(Node *));
+  Node **right = (Node **)malloc(m * sizeof(Node *));
+  Node **merged = (Node **)malloc((size_t)(n + m) * sizeof(Node *));
+  if (left == NULL || right == NULL || merged == NULL ||
+      collect_nodes(a, left) != n || collect_nodes(b, right) != m)
+  {
+    free(left);
+    free(right);
+    free(merged);
+    return NULL;
+  }
 
-    // 오른쪽 서브트리에서 최솟값 삭제
-    root->right = delete_node(root->right, temp->data);
+  int i = 0, j = 0, count = 0;
+  while (i < n && j < m)
+  {
+    if (left[i]->data < right[j]->data)
+    {
+      merged[count++] = left[i++];
+    }
+    else if (left[i]->data > right[j]->data)
+    {
+      merged[count++] = right[j++];
+    }
+    else
+    {
+      // 같은 키: 한쪽 노드만 남김
+      merged[count++] = left[i++];
+      release_node(right[j++]);
+    }
+  }
+  while (i < n)
+  {
+    merged[count++] = left[i++];
   }
+  while (j < m)
+  {
+    merged[count++] = right[j++];
+  }
+
+  Node *root = link_balanced(merged, 0, count - 1);
 
+  free(left);
+  free(right);
+  free(merged);
   return root;
 }
 
+/* ---------- 순서 통계 / 범위 질의 ---------- */
+
 /**
- * 중위 순회 (Inorder: Left -> Root -> Right)
- * BST에서는 오름차순 정렬된 순서로 출력됨
+ * 서브트리의 노드 수
+ * @param root: 서브트리의 루트 (NULL이면 0)
  */
-void inorder_traversal(Node *root)
+int bst_size(Node *root)
+{
+  return root == NULL ? 0 : root->size;
+}
+
+/**
+ * 트리 높이 (빈 트리는 0, 노드 하나는 1)
+ *
+ * 재귀 없이 레벨 순서로 한 층씩 내려가며 센다. 큐 크기는 bst_size로 정한다.
+ * 시간 복잡도: O(n)
+ * @return: 높이 (메모리 할당 실패 시 -1)
+ */
+int tree_height(Node *root)
 {
-  if (root != NULL)
+  if (root == NULL)
   {
-    inorder_traversal(root->left);
-    printf("%d ", root->data);
-    inorder_traversal(root->right);
+    return 0;
   }
+
+  Node **queue = (Node **)malloc(root->size * sizeof(Node *));
+  if (queue == NULL)
+  {
+    return -1;
+  }
+
+  int head = 0, tail = 0, height = 0;
+  queue[tail++] = root;
+  while (head < tail)
+  {
+    int level_end = tail;
+    while (head < level_end)
+    {
+      Node *node = queue[head++];
+      if (node->left != NULL)
+      {
+        queue[tail++] = node->left;
+      }
+      if (node->right != NULL)
+      {
+        queue[tail++] = node->right;
+      }
+    }
+    height++;
+  }
+
+  free(queue);
+  return height;
 }
 
 /**
- * 전위 순회 (Preorder: Root -> Left -> Right)
+ * key보다 작은 키의 개수 (= key가 들어갈 0부터 시작하는 순위)
+ *
+ * 오른쪽으로 내려갈 때마다 왼쪽 서브트리 전체와 현재 노드를 센다.
+ * 시간 복잡도: O(h)
  */
-void preorder_traversal(Node *root)
+int bst_rank(Node *root, int key)
 {
-  if (root != NULL)
+  int rank = 0;
+  while (root != NULL)
   {
-    printf("%d ", root->data);
-    preorder_traversal(root->left);
-    preorder_traversal(root->right);
+    if (key <= root->data)
+    {
+      root = root->left;
+    }
+    else
+    {
+      rank += bst_size(root->left) + 1;
+      root = root->right;
+    }
   }
+  return rank;
 }
 
 /**
- * 후위 순회 (Postorder: Left -> Right -> Root)
+ * index번째로 작은 노드 (0부터 시작)
+ * @return: 해당 노드, 범위를 벗어나면 NULL
+ *
+ * 왼쪽 서브트리 크기와 비교해 한 방향으로만 내려간다.
+ * 시간 복잡도: O(h)
  */
-void postorder_traversal(Node *root)
+Node *bst_select(Node *root, int index)
 {
-  if (root != NULL)
+  if (index < 0 || index >= bst_size(root))
   {
-    postorder_traversal(root->left);
-    postorder_traversal(root->right);
-    printf("%d ", root->data);
+    return NULL;
   }
+
+  while (root != NULL)
+  {
+    int left_size = bst_size(root->left);
+    if (index < left_size)
+    {
+      root = root->left;
+    }
+    else if (index == left_size)
+    {
+      return root;
+    }
+    else
+    {
+      index -= left_size + 1;
+      root = root->right;
+    }
+  }
+  return NULL;
 }
 
 /**
- * 트리 전체 메모리 해제 (후위 순회 방식)
- * @param root: 트리의 루트 노드
+ * lo 이상 hi 이하인 키의 개수 (키를 나열하지 않고 O(h))
  */
-void free_tree(Node *root)
+int bst_count_range(Node *root, int lo, int hi)
+{
+  if (lo > hi)
+  {
+    return 0;
+  }
+
+  // hi 이하인 키의 개수 = hi보다 작은 개수 + (hi가 있으면 1)
+  int upto_hi = bst_rank(root, hi) + (search_node(root, hi) != NULL ? 1 : 0);
+  return upto_hi - bst_rank(root, lo);
+}
+
+/**
+ * lo 이상 hi 이하인 키를 오름차순으로 out에 최대 max_out개 저장
+ * @return: 저장한 개수 (메모리 부족이면 -1)
+ *
+ * lo 위치로 한 번 내려간 뒤 반복자로 다음 키를 꺼내므로
+ * 시간 복잡도는 O(h + 출력 크기)이다.
+ */
+int bst_range(Node *root, int lo, int hi, int *out, int max_out)
+{
+  if (lo > hi || max_out <= 0)
+  {
+    return 0;
+  }
+
+  BSTIterator *it = create_bst_iterator_from(root, lo);
+  if (it == NULL)
+  {
+    return -1;
+  }
+
+  int count = 0;
+  while (count < max_out && bst_iterator_has_next(it))
+  {
+    Node *node = bst_iterator_next(it);
+    if (node->data > hi)
+    {
+      break;
+    }
+    out[count++] = node->data;
+  }
+
+  if (bst_iterator_failed(it))
+  {
+    count = -1;
+  }
+  free_bst_iterator(it);
+  return count;
+}
+
+/* ---------- 반복자 ---------- */
+
+/* 스택에 노드 추가 (가득 차면 두 배로, 실패하면 failed 표시) */
+static bool iterator_push(BSTIterator *it, Node *node)
+{
+  if (it->top == it->capacity)
+  {
+    Node **grown = (Node **)realloc(it->stack, 2 * it->capacity * sizeof(Node *));
+    if (grown == NULL)
+    {
+      it->failed = true;
+      return false;
+    }
+    it->stack = grown;
+    it->capacity *= 2;
+  }
+  it->stack[it->top++] = node;
+  return true;
+}
+
+static BSTIterator *allocate_iterator(void)
+{
+  BSTIterator *it = (BSTIterator *)malloc(sizeof(BSTIterator));
+  if (it == NULL)
+  {
+    return NULL;
+  }
+
+  it->capacity = 32;
+  it->top = 0;
+  it->failed = false;
+  it->stack = (Node **)malloc(it->capacity * sizeof(Node *));
+  if (it->stack == NULL)
+  {
+    free(it);
+    return NULL;
+  }
+  return it;
+}
+
+/* node와 그 왼쪽 자손들을 스택에 쌓음 */
+static void push_left_path(BSTIterator *it, Node *node)
 {
-  if (root != NULL)
+  while (node != NULL && iterator_push(it, node))
   {
-    free_tree(root->left);
-    free_tree(root->right);
-    free(root);
+    node = node->left;
   }
-}
\ No newline at end of file
+}
+
+/**
+ * 가장 작은 키부터 시작하는 반복자 생성
+ * @return: 반복자 (할당 실패 시 NULL)
+ */
+BSTIterator *create_bst_iterator(Node *root)
+{
+  BSTIterator *it = allocate_iterator();
+  if (it != NULL)
+  {
+    push_left_path(it, root);
+    if (it->failed)
+    {
+      free_bst_iterator(it);
+      return NULL;
+    }
+  }
+  return it;
+}
+
+/**
+ * key 이상인 첫 키부터 시작하는 반복자 생성
+ *
+ * 내려가다가 왼쪽으로 꺾은 노드(key 이상)만 스택에 남기면
+ * 스택 맨 위가 key 이상인 가장 작은 노드가 된다.
+ * @return: 반복자 (할당 실패 시 NULL)
+ */
+BSTIterator *create_bst_iterator_from(Node *root, int key)
+{
+  BSTIterator *it = allocate_iterator();
+  if (it == NULL)
+  {
+    return NULL;
+  }
+
+  while (root != NULL)
+  {
+    if (root->data >= key)
+    {
+      if (!iterator_push(it, root))
+      {
+        free_bst_iterator(it);
+        return NULL;
+      }
+      root = root->left;
+    }
+    else
+    {
+      root = root->right;
+    }
+  }
+  return it;
+}
+
+/**
+ * 남은 노드가 있는지 (실패한 반복자는 더 꺼내지 않음)
+ */
+bool bst_iterator_has_next(BSTIterator *it)
+{
+  return !it->failed && it->top > 0;
+}
+
+/**
+ * 스택을 늘리지 못해 노드를 빠뜨렸는지
+ * 순회가 끝난 뒤 확인해서, true면 꺼낸 결과를 버려야 한다.
+ */
+bool bst_iterator_failed(const BSTIterator *it)
+{
+  return it->failed;
+}
+
+/**
+ * 다음 노드 (오름차순)
+ * @return: 다음 노드, 끝이면 NULL
+ *
+ * 꺼낸 노드의 오른쪽 서브트리의 왼쪽 경로를 쌓는다.
+ * 전체 순회 기준으로 호출당 분할 상환 O(1).
+ */
+Node *bst_iterator_next(BSTIterator *it)
+{
+  if (it->failed || it->top == 0)
+  {
+    return NULL;
+  }
+
+  Node *node = it->stack[--it->top];
+  push_left_path(it, node->right);
+  return node;
+}
+
+/**
+ * 반복자 해제 (트리는 건드리지 않음)
+ */
+void free_bst_iterator(BSTIterator *it)
+{
+  if (it == NULL)
+  {
+    return;
+  }
+  free(it->stack);
+  free(it);
+}
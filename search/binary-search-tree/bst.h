@@ -9,6 +9,7 @@
 typedef struct Node
 {
   int data;
+  int size; /* 이 노드를 루트로 하는 서브트리의 노드 수 (순서 통계용) */
   struct Node *left;
   struct Node *right;
 } Node;
@@ -28,4 +29,55 @@ void postorder_traversal(Node *root);
 /* 메모리 해제 */
 void free_tree(Node *root);
 
+/*
+ * 일괄 구성
+ * build_from_sorted: 엄격히 증가하는 키로 완전 균형 트리를 O(n)에 구성
+ *                    (정렬되지 않았거나 n <= 0이거나 할당 실패 시 NULL)
+ * merge_trees: 두 트리를 합쳐 균형 트리로 재구성, O(n + m)
+ *              (두 트리의 노드를 재사용하며, 원래 트리 포인터는 더 이상 쓰면 안 됨)
+ */
+Node *build_from_sorted(const int *keys, int n);
+Node *merge_trees(Node *a, Node *b);
+
+/* 순서 통계 / 범위 질의 (서브트리 크기 이용, O(h) 또는 O(h + 출력 크기)) */
+int bst_size(Node *root);
+int tree_height(Node *root);
+int bst_rank(Node *root, int key);
+Node *bst_select(Node *root, int index);
+int bst_count_range(Node *root, int lo, int hi);
+int bst_range(Node *root, int lo, int hi, int *out, int max_out); /* 메모리 부족이면 -1 */
+
+/*
+ * 중위 순서 반복자 (printf 없이 노드를 하나씩 꺼냄)
+ * 스택에 현재 위치의 조상들을 보관하므로 O(h) 공간을 쓴다.
+ * 순회하는 동안 트리를 수정하면 안 된다.
+ * 순회 도중 스택을 늘리지 못하면 멈추고 bst_iterator_failed가 true가 된다
+ * (그때까지 꺼낸 노드가 전부라고 보면 안 됨).
+ */
+typedef struct BSTIterator
+{
+  Node **stack; /* 아직 방문하지 않은 조상 노드들 */
+  int top;      /* 스택에 쌓인 개수 */
+  int capacity; /* 스택 용량 */
+  bool failed;  /* 스택을 늘리지 못해 노드를 빠뜨림 */
+} BSTIterator;
+
+BSTIterator *create_bst_iterator(Node *root);
+BSTIterator *create_bst_iterator_from(Node *root, int key);
+bool bst_iterator_has_next(BSTIterator *it);
+Node *bst_iterator_next(BSTIterator *it);
+bool bst_iterator_failed(const BSTIterator *it);
+void free_bst_iterator(BSTIterator *it);
+
+/*
+ * 노드 할당기 설정 (fundamentals/slab-allocator)
+ * NULL이면 malloc/free를 사용한다 (기본값).
+ * 살아 있는 트리가 없을 때만 바꿔야 한다 (노드는 받은 곳으로 반납되어야 함).
+ *
+ * 아레나 모드: 트리 전체를 free_tree 대신 slab_reset(slab)으로 O(1)에 해제하고
+ * 루트 포인터를 NULL로 되돌린다.
+ */
+struct SlabAllocator;
+bool bst_set_allocator(struct SlabAllocator *slab);
+
 #endif // BST_H
\ No newline at end of file
@@ -0,0 +1,205 @@
+#include "bst_file.h"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* 저장할 때 키를 모아서 쓰는 단위 */
+#define BST_FILE_BUFFER 4096
+
+/* FNV-1a 64비트 상수 */
+#define FNV_OFFSET 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+/* 체크섬 이어서 계산 (저장할 때 버퍼 단위로 누적) */
+static uint64_t checksum_update(uint64_t hash, const int *keys, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    hash ^= (uint32_t)keys[i];
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+/**
+ * 키 배열 체크섬
+ * FNV-1a를 바이트 대신 32비트 키 단위로 돌린다.
+ * 키 하나당 곱셈 한 번이라 읽기 속도를 거의 떨어뜨리지 않는다.
+ */
+uint64_t bst_file_checksum(const int *keys, size_t count)
+{
+  return checksum_update(FNV_OFFSET, keys, count);
+}
+
+/**
+ * 트리를 파일로 저장
+ * @param root: 저장할 트리
+ * @param path: 파일 경로
+ * @return: 성공 여부
+ *
+ * 반복자로 키를 오름차순으로 꺼내 버퍼 단위로 쓰고, 체크섬은 쓰면서 누적한다.
+ * 헤더는 마지막에 앞으로 돌아가 채운다.
+ * path.tmp에 다 쓴 뒤 rename하므로, 도중에 실패해도 기존 파일은 그대로다.
+ */
+bool bst_save(Node *root, const char *path)
+{
+  size_t length = strlen(path);
+  char *temp_path = (char *)malloc(length + 5);
+  if (temp_path == NULL)
+  {
+    return false;
+  }
+  memcpy(temp_path, path, length);
+  memcpy(temp_path + length, ".tmp", 5);
+
+  FILE *fp = fopen(temp_path, "wb");
+  BSTIterator *it = create_bst_iterator(root);
+  if (fp == NULL || it == NULL)
+  {
+    if (fp != NULL)
+    {
+      fclose(fp);
+      remove(temp_path);
+    }
+    free_bst_iterator(it);
+    free(temp_path);
+    return false;
+  }
+
+  BSTFileHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, BST_FILE_MAGIC, 4);
+  header.version = BST_FILE_VERSION;
+  header.checksum = FNV_OFFSET;
+
+  bool ok = fwrite(&header, sizeof(header), 1, fp) == 1;
+
+  int buffer[BST_FILE_BUFFER];
+  while (ok && bst_iterator_has_next(it))
+  {
+    size_t filled = 0;
+    while (filled < BST_FILE_BUFFER && bst_iterator_has_next(it))
+    {
+      buffer[filled++] = bst_iterator_next(it)->data;
+    }
+    header.checksum = checksum_update(header.checksum, buffer, filled);
+    header.count += filled;
+    ok = fwrite(buffer, sizeof(int), filled, fp) == filled;
+  }
+  ok = ok && !bst_iterator_failed(it); // 빠진 노드가 있으면 잘린 파일을 남기지 않음
+  free_bst_iterator(it);
+
+  ok = ok && fseek(fp, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, fp) == 1;
+  ok = fclose(fp) == 0 && ok;
+  ok = ok && rename(temp_path, path) == 0;
+  if (!ok)
+  {
+    remove(temp_path);
+  }
+
+  free(temp_path);
+  return ok;
+}
+
+/**
+ * 키 파일 매핑 + 검증
+ * 파일 크기가 헤더의 count와 정확히 맞고, 체크섬이 일치해야 한다.
+ */
+bool bst_open_key_file(const char *path, BSTKeyFile *file)
+{
+  int fd = open(path, O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(BSTFileHeader))
+  {
+    close(fd);
+    return false;
+  }
+
+  size_t size = (size_t)st.st_size;
+  void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); // 매핑은 fd를 닫아도 유지됨
+  if (map == MAP_FAILED)
+  {
+    return false;
+  }
+
+  // 체크섬 검사와 트리 구성 모두 앞에서부터 한 번 읽으므로 미리 읽기를 요청
+  posix_madvise(map, size, POSIX_MADV_SEQUENTIAL);
+
+  const BSTFileHeader *header = (const BSTFileHeader *)map;
+  const int *keys = (const int *)((const char *)map + sizeof(BSTFileHeader));
+  size_t payload = size - sizeof(BSTFileHeader);
+
+  bool valid = memcmp(header->magic, BST_FILE_MAGIC, 4) == 0 &&
+               header->version == BST_FILE_VERSION &&
+               payload % sizeof(int) == 0 &&
+               header->count == payload / sizeof(int) &&
+               bst_file_checksum(keys, payload / sizeof(int)) == header->checksum;
+  if (!valid)
+  {
+    munmap(map, size);
+    return false;
+  }
+
+  file->keys = keys;
+  file->count = payload / sizeof(int);
+  file->map = map;
+  file->map_size = size;
+  return true;
+}
+
+/* 매핑 해제 */
+void bst_close_key_file(BSTKeyFile *file)
+{
+  if (file->map != NULL)
+  {
+    munmap(file->map, file->map_size);
+  }
+  file->keys = NULL;
+  file->count = 0;
+  file->map = NULL;
+  file->map_size = 0;
+}
+
+/**
+ * 파일에서 트리 구성
+ * 매핑한 키 배열을 복사하지 않고 그대로 build_from_sorted에 넘긴다.
+ * 시간 복잡도: O(n) (insert_node 반복은 랜덤 순서 O(n log n), 정렬된 순서 O(n²))
+ */
+bool bst_load(const char *path, Node **root)
+{
+  BSTKeyFile file;
+  if (!bst_open_key_file(path, &file))
+  {
+    return false;
+  }
+
+  if (file.count > (size_t)INT32_MAX)
+  {
+    bst_close_key_file(&file);
+    return false;
+  }
+
+  Node *loaded = NULL;
+  bool ok = true;
+  if (file.count > 0)
+  {
+    // 정렬되지 않았거나 중복이 있으면 NULL (체크섬이 맞아도 잘못 만든 파일)
+    loaded = build_from_sorted(file.keys, (int)file.count);
+    ok = loaded != NULL;
+  }
+
+  bst_close_key_file(&file);
+  if (ok)
+  {
+    *root = loaded;
+  }
+  return ok;
+}
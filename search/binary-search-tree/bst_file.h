@@ -0,0 +1,59 @@
+#ifndef BST_FILE_H
+#define BST_FILE_H
+
+#include <stdint.h>
+#include "bst.h"
+
+/*
+ * BST 인덱스 파일 저장 / 불러오기
+ *
+ * 파일 형식 (호스트 바이트 순서):
+ *   BSTFileHeader (24바이트)
+ *   int32 키 count개 (오름차순, 중복 없음)
+ *
+ * 트리 모양은 저장하지 않는다. 정렬된 키만 있으면 build_from_sorted로
+ * 완전 균형 트리를 O(n)에 다시 만들 수 있기 때문이다.
+ * 시작할 때마다 insert_node를 n번 부르는 대신 파일을 읽어 바로 구성한다.
+ */
+
+#define BST_FILE_MAGIC "BSTK"
+#define BST_FILE_VERSION 1
+
+typedef struct BSTFileHeader
+{
+  char magic[4];     /* "BSTK" */
+  uint32_t version;  /* BST_FILE_VERSION */
+  uint64_t count;    /* 키 개수 */
+  uint64_t checksum; /* 키 배열의 체크섬 (bst_file_checksum) */
+} BSTFileHeader;
+
+/* mmap으로 연 키 배열 (읽기 전용, 닫을 때까지 유효) */
+typedef struct BSTKeyFile
+{
+  const int *keys; /* 오름차순 키 */
+  size_t count;
+  void *map;       /* 매핑 시작 주소 (헤더 포함) */
+  size_t map_size;
+} BSTKeyFile;
+
+/* 트리의 키를 오름차순으로 저장 (임시 파일에 쓴 뒤 rename, 실패 시 false) */
+bool bst_save(Node *root, const char *path);
+
+/*
+ * 파일에서 균형 트리 구성 (O(n))
+ * 헤더/크기/체크섬/정렬 중 하나라도 맞지 않으면 false, *root는 그대로 둔다.
+ * 키가 0개인 파일이면 true와 함께 *root = NULL.
+ */
+bool bst_load(const char *path, Node **root);
+
+/*
+ * 키 배열을 복사 없이 매핑 (트리를 만들지 않고 이진 탐색 등에 바로 사용)
+ * 헤더와 체크섬을 검증한 뒤에만 true를 반환한다.
+ */
+bool bst_open_key_file(const char *path, BSTKeyFile *file);
+void bst_close_key_file(BSTKeyFile *file);
+
+/* 키 배열 체크섬 (32비트 단위 FNV-1a, 64비트) */
+uint64_t bst_file_checksum(const int *keys, size_t count);
+
+#endif // BST_FILE_H
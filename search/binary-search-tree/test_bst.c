@@ -1,4 +1,6 @@
 #include "bst.h"
+#include "bst_file.h"
+#include "slab.h"
 
 /**
  * 테스트 1: 빈 트리에서 탐색
@@ -215,6 +217,499 @@ void test_memory()
   printf("✓ 모든 노드 메모리 해제 완료\n\n");
 }
 
+/**
+ * 한쪽으로 치우친 사슬 트리 직접 생성 (0, 1, 2, ... 순서)
+ * insert_node로 만들면 O(n²)이므로 링크를 직접 연결한다.
+ */
+Node *build_chain(int n, bool to_right)
+{
+  Node *root = NULL;
+  Node *tail = NULL;
+  for (int i = 0; i < n; i++)
+  {
+    Node *node = create_node(to_right ? i : n - 1 - i);
+    node->size = n - i;
+    if (tail == NULL)
+    {
+      root = node;
+    }
+    else if (to_right)
+    {
+      tail->right = node;
+    }
+    else
+    {
+      tail->left = node;
+    }
+    tail = node;
+  }
+  return root;
+}
+
+/**
+ * 테스트 7: 깊이 100만의 편향 트리 (재귀 구현이라면 스택 오버플로우)
+ */
+void test_degenerate_tree()
+{
+  printf("╔═══════════════════════════════════╗\n");
+  printf("║  [테스트 7] 깊이 100만 편향 트리         ║\n");
+  printf("╚═══════════════════════════════════╝\n");
+
+  int n = 1000000;
+  Node *root = build_chain(n, true);
+  printf("0 → 1 → ... → %d 오른쪽 사슬 생성\n", n - 1);
+
+  Node *deepest = search_node(root, n - 1);
+  if (deepest != NULL && deepest->data == n - 1)
+  {
+    printf("✓ 가장 깊은 값 %d 탐색 성공\n", n - 1);
+  }
+  else
+  {
+    printf("✗ 가장 깊은 값 탐색 실패\n");
+  }
+
+  root = insert_node(root, n);
+  root = delete_node(root, n / 2);
+  root = delete_node(root, 0);
+  if (search_node(root, n) != NULL && search_node(root, n / 2) == NULL &&
+      search_node(root, 0) == NULL && root->data == 1)
+  {
+    printf("✓ 맨 아래 삽입, 중간/루트 삭제 성공\n");
+  }
+  else
+  {
+    printf("✗ 편향 트리 삽입/삭제 오류\n");
+  }
+
+  free_tree(root);
+
+  // 왼쪽 사슬도 해제 (회전 방식 free_tree가 사슬 전체를 펴야 함)
+  root = build_chain(n, false);
+  free_tree(root);
+  printf("✓ 오른쪽/왼쪽 사슬 모두 메모리 해제 완료\n\n");
+}
+
+/**
+ * 테스트 8: Morris 순회 후 트리 구조 복원 + 후계자에 오른쪽 자식이 있는 삭제
+ */
+void test_morris_restores_tree()
+{
+  printf("╔═══════════════════════════════════╗\n");
+  printf("║  [테스트 8] Morris 순회 후 구조 복원     ║\n");
+  printf("╚═══════════════════════════════════╝\n");
+
+  Node *root = NULL;
+  int keys[] = {50, 30, 70, 20, 40, 60, 80, 65};
+  for (int i = 0; i < 8; i++)
+  {
+    root = insert_node(root, keys[i]);
+  }
+
+  printf("중위 순회: ");
+  inorder_traversal(root);
+  printf("\n전위 순회: ");
+  preorder_traversal(root);
+  printf("\n");
+
+  // 스레드가 모두 제거되었는지 (리프의 right가 NULL인지) 확인
+  if (search_node(root, 20)->right == NULL && search_node(root, 40)->right == NULL &&
+      search_node(root, 65)->right == NULL && root->left->data == 30)
+  {
+    printf("✓ 순회 후 임시 스레드 제거 확인\n");
+  }
+  else
+  {
+    printf("✗ 순회 후 트리 구조가 바뀜\n");
+  }
+
+  // 50의 후계자 60은 오른쪽 자식 65를 가짐
+  root = delete_node(root, 50);
+  Node *seventy = search_node(root, 70);
+  if (root->data == 60 && seventy->left != NULL && seventy->left->data == 65)
+  {
+    printf("✓ 루트 삭제: 후계자 60으로 대체, 65가 70의 왼쪽 자식이 됨\n");
+  }
+  else
+  {
+    printf("✗ 후계자 삭제 오류\n");
+  }
+
+  printf("후위 순회: ");
+  postorder_traversal(root);
+  printf("\n\n");
+
+  free_tree(root);
+}
+
+/**
+ * 테스트 9: 슬랩 할당기로 노드 할당 + 아레나 모드 해제
+ */
+void test_slab_allocator()
+{
+  printf("╔═══════════════════════════════════╗\n");
+  printf("║  [테스트 9] 슬랩 할당기 / 아레나 모드    ║\n");
+  printf("╚═══════════════════════════════════╝\n");
+
+  SlabAllocator *small = create_slab_allocator(sizeof(int), 0);
+  if (!bst_set_allocator(small))
+  {
+    printf("✓ 노드보다 작은 객체 크기의 할당기는 거부\n");
+  }
+  else
+  {
+    printf("✗ 작은 할당기를 받아들임\n");
+  }
+  destroy_slab_allocator(small);
+
+  SlabAllocator *slab = create_slab_allocator(sizeof(Node), 256);
+  bst_set_allocator(slab);
+
+  Node *root = NULL;
+  for (int i = 0; i < 1000; i++)
+  {
+    root = insert_node(root, (i * 7919) % 1000);
+  }
+  for (int i = 0; i < 1000; i += 2)
+  {
+    root = delete_node(root, i);
+  }
+  size_t slabs = slab->num_slabs;
+
+  // 삭제된 노드 자리를 free list에서 재사용
+  for (int i = 0; i < 1000; i += 2)
+  {
+    root = insert_node(root, i);
+  }
+  if (slab->live_objects == 1000 && slab->num_slabs == slabs && search_node(root, 998) != NULL)
+  {
+    printf("✓ 삭제 후 재삽입: 슬랩 %zu개 그대로, 노드 1000개 사용 중\n", slabs);
+  }
+  else
+  {
+    printf("✗ free list 재사용 오류\n");
+  }
+
+  free_tree(root);
+  if (slab->live_objects == 0)
+  {
+    printf("✓ free_tree 후 사용 중인 노드 0개\n");
+  }
+  else
+  {
+    printf("✗ free_tree 후 남은 노드 %zu개\n", slab->live_objects);
+  }
+
+  // 아레나 모드: 노드를 하나씩 해제하지 않고 한 번에 반납
+  root = NULL;
+  for (int i = 0; i < 1000; i++)
+  {
+    root = insert_node(root, (i * 7919) % 1000);
+  }
+  slab_reset(slab);
+  root = NULL;
+  root = insert_node(root, 42);
+  if (slab->live_objects == 1 && slab->num_slabs == slabs && root->data == 42)
+  {
+    printf("✓ slab_reset으로 트리 전체 O(1) 해제 후 슬랩 재사용\n");
+  }
+  else
+  {
+    printf("✗ 아레나 모드 오류\n");
+  }
+
+  bst_set_allocator(NULL);
+  destroy_slab_allocator(slab);
+  printf("\n");
+}
+
+/* 모든 노드의 size가 실제 서브트리 노드 수와 같은지 확인 (작은 트리용 재귀) */
+int checked_size(Node *root)
+{
+  if (root == NULL)
+  {
+    return 0;
+  }
+  int left = checked_size(root->left);
+  int right = checked_size(root->right);
+  if (left < 0 || right < 0 || root->size != left + right + 1)
+  {
+    return -1;
+  }
+  return root->size;
+}
+
+/**
+ * 테스트 10: 순서 통계 (rank/select), 범위 질의, 반복자
+ */
+void test_order_statistics()
+{
+  printf("╔═══════════════════════════════════╗\n");
+  printf("║  [테스트 10] 순서 통계 / 범위 / 반복자  ║\n");
+  printf("╚═══════════════════════════════════╝\n");
+
+  // 0, 3, 6, ..., 2997 (1000개)를 섞어서 삽입, 중복 삽입/없는 값 삭제도 섞음
+  Node *root = NULL;
+  for (int i = 0; i < 1000; i++)
+  {
+    root = insert_node(root, ((i * 7919) % 1000) * 3);
+    root = insert_node(root, ((i * 7919) % 1000) * 3);
+    root = delete_node(root, 1);
+  }
+  // 3의 배수 중 6의 배수가 아닌 것 삭제 → 0, 6, 12, ..., 2994 (500개)
+  for (int i = 0; i < 1000; i += 2)
+  {
+    root = delete_node(root, ((i * 7919) % 1000 | 1) * 3);
+  }
+
+  if (bst_size(root) == 500 && checked_size(root) == 500)
+  {
+    printf("✓ 삽입/중복 삽입/삭제 후 모든 서브트리 크기 일치 (500개)\n");
+  }
+  else
+  {
+    printf("✗ 서브트리 크기 불일치\n");
+  }
+
+  bool ok = true;
+  for (int i = 0; i < 500 && ok; i++)
+  {
+    Node *node = bst_select(root, i);
+    ok = node != NULL && node->data == i * 6 && bst_rank(root, i * 6) == i &&
+         bst_rank(root, i * 6 + 1) == i + 1;
+  }
+  ok = ok && bst_select(root, -1) == NULL && bst_select(root, 500) == NULL;
+  printf("%s select(i) = 6i, rank(6i) = i, 범위 밖 select는 NULL\n", ok ? "✓" : "✗");
+
+  int out[600];
+  int count = bst_range(root, 100, 200, out, 600);
+  ok = count == 17 && out[0] == 102 && out[16] == 198;
+  for (int i = 1; i < count && ok; i++)
+  {
+    ok = out[i] == out[i - 1] + 6;
+  }
+  ok = ok && bst_count_range(root, 100, 200) == 17 && bst_count_range(root, 102, 198) == 17 &&
+       bst_count_range(root, 200, 100) == 0 && bst_range(root, 0, 3000, out, 5) == 5 && out[4] == 24;
+  printf("%s range [100, 200] = 102..198 (17개), count_range 일치, max_out에서 멈춤\n",
+         ok ? "✓" : "✗");
+
+  // 반복자: 출력 없이 오름차순으로 전부 꺼냄
+  BSTIterator *it = create_bst_iterator(root);
+  int expected = 0;
+  ok = true;
+  while (bst_iterator_has_next(it) && ok)
+  {
+    ok = bst_iterator_next(it)->data == expected;
+    expected += 6;
+  }
+  ok = ok && expected == 3000 && bst_iterator_next(it) == NULL;
+  free_bst_iterator(it);
+
+  it = create_bst_iterator_from(root, 2990);
+  ok = ok && bst_iterator_next(it)->data == 2994 && !bst_iterator_has_next(it);
+  free_bst_iterator(it);
+  printf("%s 반복자: 전체 오름차순 500개, 2990부터 시작하면 2994 하나\n", ok ? "✓" : "✗");
+
+  free_tree(root);
+
+  // 한쪽으로 치우친 트리 (높이 2000): 스택이 초기 용량(32)을 넘어 여러 번 늘어남
+  root = NULL;
+  for (int i = 2000; i > 0; i--)
+  {
+    root = insert_node(root, i);
+  }
+  it = create_bst_iterator(root);
+  expected = 1;
+  ok = it != NULL;
+  while (ok && bst_iterator_has_next(it))
+  {
+    ok = bst_iterator_next(it)->data == expected++;
+  }
+  ok = ok && expected == 2001 && !bst_iterator_failed(it) && bst_range(root, 1990, 5000, out, 600) == 11;
+  free_bst_iterator(it);
+  printf("%s 높이 2000 트리: 스택이 늘어나도 2000개 모두, 실패 표시 없음\n", ok ? "✓" : "✗");
+  free_tree(root);
+
+  // 빈 트리
+  ok = bst_size(NULL) == 0 && bst_rank(NULL, 5) == 0 && bst_select(NULL, 0) == NULL &&
+       bst_range(NULL, 0, 10, out, 10) == 0;
+  it = create_bst_iterator(NULL);
+  ok = ok && !bst_iterator_has_next(it);
+  free_bst_iterator(it);
+  printf("%s 빈 트리\n\n", ok ? "✓" : "✗");
+}
+
+/**
+ * 테스트 11: 정렬된 키로 일괄 구성, 트리 병합
+ */
+void test_bulk_build()
+{
+  printf("╔═══════════════════════════════════╗\n");
+  printf("║  [테스트 11] 일괄 구성 / 트리 병합      ║\n");
+  printf("╚═══════════════════════════════════╝\n");
+
+  int keys[1023];
+  for (int i = 0; i < 1023; i++)
+  {
+    keys[i] = i * 2;
+  }
+
+  // 2^10 - 1개 → 높이 10의 완전 이진 트리
+  Node *root = build_from_sorted(keys, 1023);
+  bool ok = root != NULL && tree_height(root) == 10 && checked_size(root) == 1023;
+  for (int i = 0; i < 1023 && ok; i++)
+  {
+    ok = bst_select(root, i)->data == i * 2 && search_node(root, i * 2 + 1) == NULL;
+  }
+  printf("%s 1023개: 높이 10, 서브트리 크기 일치, 모든 키 탐색 가능\n", ok ? "✓" : "✗");
+
+  // 구성된 트리에도 삽입/삭제 가능
+  root = insert_node(root, 1);
+  root = delete_node(root, 1022);
+  ok = checked_size(root) == 1023 && search_node(root, 1) != NULL && search_node(root, 1022) == NULL;
+  printf("%s 구성 후 삽입/삭제 정상\n", ok ? "✓" : "✗");
+  free_tree(root);
+
+  // 정렬되지 않았거나 중복이 있으면 거부
+  int unsorted[] = {1, 3, 2};
+  int duplicated[] = {1, 2, 2};
+  ok = build_from_sorted(unsorted, 3) == NULL && build_from_sorted(duplicated, 3) == NULL &&
+       build_from_sorted(keys, 0) == NULL && build_from_sorted(NULL, 5) == NULL;
+  printf("%s 정렬되지 않은 입력/중복/빈 입력은 NULL\n", ok ? "✓" : "✗");
+
+  // 슬랩 할당기: 노드가 한 덩어리에 전위 순서로 배치됨
+  SlabAllocator *slab = create_slab_allocator(sizeof(Node), 64);
+  bst_set_allocator(slab);
+  root = insert_node(NULL, -1); // 현재 슬랩을 일부 사용해 둠
+  free_tree(root);
+  root = build_from_sorted(keys, 1000);
+  ok = root != NULL && checked_size(root) == 1000 && slab->live_objects == 1000 &&
+       root->left == root + 1;
+  Node *lowest = root;
+  Node *highest = root;
+  BSTIterator *it = create_bst_iterator(root);
+  while (bst_iterator_has_next(it))
+  {
+    Node *node = bst_iterator_next(it);
+    lowest = node < lowest ? node : lowest;
+    highest = node > highest ? node : highest;
+  }
+  free_bst_iterator(it);
+  ok = ok && lowest == root && highest == root + 999;
+  printf("%s 슬랩: 노드 1000개가 연속 배치 (루트가 맨 앞)\n", ok ? "✓" : "✗");
+  free_tree(root);
+  ok = slab->live_objects == 0;
+  bst_set_allocator(NULL);
+  destroy_slab_allocator(slab);
+  printf("%s 슬랩: free_tree 후 사용 중인 노드 0개\n", ok ? "✓" : "✗");
+
+  // 병합: 짝수 0..1998과 3의 배수 0..2997 (겹치는 키 포함)
+  Node *a = build_from_sorted(keys, 1000);
+  Node *b = NULL;
+  for (int i = 0; i < 1000; i++)
+  {
+    b = insert_node(b, ((i * 7919) % 1000) * 3);
+  }
+  root = merge_trees(a, b);
+  int expected = 0;
+  for (int i = 0; i < 3000; i++)
+  {
+    expected += (i % 2 == 0 && i < 2000) || i % 3 == 0;
+  }
+  ok = checked_size(root) == expected && tree_height(root) <= 11;
+  int previous = -1;
+  it = create_bst_iterator(root);
+  while (bst_iterator_has_next(it) && ok)
+  {
+    int value = bst_iterator_next(it)->data;
+    ok = value > previous && ((value % 2 == 0 && value < 2000) || value % 3 == 0);
+    previous = value;
+  }
+  free_bst_iterator(it);
+  printf("%s 병합: 겹치는 키 하나로, %d개 균형 트리 (높이 %d)\n", ok ? "✓" : "✗", expected,
+         tree_height(root));
+
+  // 빈 트리와 병합하면 그대로
+  ok = merge_trees(root, NULL) == root && merge_trees(NULL, root) == root &&
+       merge_trees(NULL, NULL) == NULL;
+  printf("%s 빈 트리와 병합\n\n", ok ? "✓" : "✗");
+  free_tree(root);
+}
+
+/* 파일의 offset 위치 바이트를 뒤집음 (손상 파일 만들기) */
+static void corrupt_byte(const char *path, long offset)
+{
+  FILE *fp = fopen(path, "r+b");
+  fseek(fp, offset, SEEK_SET);
+  int byte = fgetc(fp);
+  fseek(fp, offset, SEEK_SET);
+  fputc(byte ^ 0xFF, fp);
+  fclose(fp);
+}
+
+/**
+ * 테스트 12: 인덱스 파일 저장 / 불러오기 / 매핑
+ */
+void test_save_load()
+{
+  printf("╔═══════════════════════════════════╗\n");
+  printf("║  [테스트 12] 인덱스 파일 저장/불러오기  ║\n");
+  printf("╚═══════════════════════════════════╝\n");
+
+  const char *path = "test_bst_index.bin";
+
+  // 10000개 랜덤 순서 삽입 (편향되지 않은 보통 트리)
+  Node *root = NULL;
+  for (int i = 0; i < 10000; i++)
+  {
+    root = insert_node(root, ((i * 7919) % 10000) * 5 - 20000);
+  }
+
+  bool ok = bst_save(root, path);
+  Node *loaded = (Node *)1;
+  ok = ok && bst_load(path, &loaded) && checked_size(loaded) == 10000 && tree_height(loaded) == 14;
+  BSTIterator *a = create_bst_iterator(root);
+  BSTIterator *b = create_bst_iterator(loaded);
+  while (ok && bst_iterator_has_next(a))
+  {
+    ok = bst_iterator_has_next(b) && bst_iterator_next(a)->data == bst_iterator_next(b)->data;
+  }
+  ok = ok && !bst_iterator_has_next(b);
+  free_bst_iterator(a);
+  free_bst_iterator(b);
+  printf("%s 저장 후 불러오기: 같은 키 10000개, 높이 14의 균형 트리\n", ok ? "✓" : "✗");
+  free_tree(loaded);
+
+  BSTKeyFile file;
+  ok = bst_open_key_file(path, &file) && file.count == 10000 && file.keys[0] == -20000 &&
+       file.keys[9999] == 29995;
+  bst_close_key_file(&file);
+  printf("%s 매핑: 키 배열을 복사 없이 열어 첫/마지막 키 확인\n", ok ? "✓" : "✗");
+
+  // 키 하나 손상 -> 체크섬 불일치
+  corrupt_byte(path, (long)sizeof(BSTFileHeader) + 4 * 1234);
+  loaded = root;
+  ok = !bst_load(path, &loaded) && loaded == root && !bst_open_key_file(path, &file);
+  printf("%s 키 손상: 체크섬 불일치로 거부, 기존 루트 유지\n", ok ? "✓" : "✗");
+
+  // 헤더 손상 / 잘린 파일 / 없는 파일
+  bst_save(root, path);
+  corrupt_byte(path, 0);
+  ok = !bst_load(path, &loaded);
+  FILE *fp = fopen(path, "wb");
+  fwrite("BSTK", 1, 4, fp);
+  fclose(fp);
+  ok = ok && !bst_load(path, &loaded) && !bst_load("no_such_bst_index.bin", &loaded);
+  printf("%s 매직 손상 / 헤더보다 짧은 파일 / 없는 파일 거부\n", ok ? "✓" : "✗");
+
+  // 빈 트리
+  ok = bst_save(NULL, path) && bst_load(path, &loaded) && loaded == NULL;
+  printf("%s 빈 트리 저장 후 불러오기 = NULL\n\n", ok ? "✓" : "✗");
+
+  remove(path);
+  free_tree(root);
+}
+
 int main()
 {
   printf("╔═══════════════════════════════════════════════╗\n");
@@ -230,6 +725,12 @@ int main()
   test_delete();
   test_traversals();
   test_memory();
+  test_degenerate_tree();
+  test_morris_restores_tree();
+  test_slab_allocator();
+  test_order_statistics();
+  test_bulk_build();
+  test_save_load();
 
   printf("✓ 모든 테스트가 완료되었습니다.\n");
   return 0;
@@ -0,0 +1,156 @@
+#include "binary_search.h"
+#include "sequential_search.h"
+#include <time.h>
+
+/*
+ * 벤치마크: 정렬 배열 탐색 (ns/쿼리)
+ * 배열 크기 4KB(L1) ~ 64MB(DRAM), 랜덤 쿼리 절반은 없는 값
+ * 1. 고른 분포: 순차 탐색(SIMD) vs 이진 / 분기 없음 / 보간 / 지수 / 배치
+ * 2. 치우친 분포: 보간 탐색이 불리한 경우
+ * 3. 앞쪽 쿼리: 지수 탐색이 유리한 경우
+ */
+
+#define QUERIES 2000000
+#define LINEAR_BYTES (1L << 30) /* 순차 탐색은 쿼리당 O(n)이라 총 읽는 양으로 쿼리 수를 정함 */
+
+static double now_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int seed = 77;
+
+static unsigned int next_random(void)
+{
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 1;
+}
+
+typedef int (*SearchFunc)(const int *arr, int size, int target);
+
+static void time_single(const char *name, SearchFunc search, const int *arr, int size, const int *queries,
+                        int count)
+{
+  long found = 0;
+  double start = now_seconds();
+  for (int i = 0; i < count; i++)
+  {
+    found += search(arr, size, queries[i]) >= 0;
+  }
+  double elapsed = now_seconds() - start;
+  printf("  %-22s %9.1f ns/쿼리  (찾음 %.1f%%)\n", name, elapsed * 1e9 / count, 100.0 * found / count);
+}
+
+static void time_batch(const int *arr, int size, const int *queries, int count, int *out)
+{
+  double start = now_seconds();
+  binary_search_batch(arr, size, queries, count, out);
+  double elapsed = now_seconds() - start;
+  long found = 0;
+  for (int i = 0; i < count; i++)
+  {
+    found += out[i] >= 0;
+  }
+  printf("  %-22s %9.1f ns/쿼리  (찾음 %.1f%%)\n", "배치 + prefetch", elapsed * 1e9 / count,
+         100.0 * found / count);
+}
+
+static void time_linear(const int *arr, int size, const int *queries)
+{
+  long count = LINEAR_BYTES / ((long)size * sizeof(int));
+  count = count < 16 ? 16 : count > QUERIES ? QUERIES : count;
+  long found = 0;
+  double start = now_seconds();
+  for (long i = 0; i < count; i++)
+  {
+    found += sequential_search((int *)arr, size, queries[i]) >= 0;
+  }
+  double elapsed = now_seconds() - start;
+  printf("  %-22s %9.1f ns/쿼리  (찾음 %.1f%%, %s 커널)\n", "순차 탐색", elapsed * 1e9 / count,
+         100.0 * found / count, search_kernel_name(sequential_search_kernel()));
+}
+
+static void fill_queries(const int *arr, int size, int *queries, int count, int front)
+{
+  // 절반은 배열에 있는 값, 절반은 그 값 + 1 (간격이 2 이상이면 없는 값)
+  int range = front > 0 && front < size ? front : size;
+  for (int i = 0; i < count; i++)
+  {
+    int value = arr[next_random() % (unsigned int)range];
+    queries[i] = (i & 1) ? value + 1 : value;
+  }
+}
+
+static void run_all(const char *title, const int *arr, int size, int *queries, int *out)
+{
+  printf("%s\n", title);
+  time_linear(arr, size, queries);
+  time_single("이진 (분기)", binary_search, arr, size, queries, QUERIES);
+  time_single("이진 (분기 없음)", binary_search_branchless, arr, size, queries, QUERIES);
+  time_single("보간", interpolation_search, arr, size, queries, QUERIES);
+  time_single("지수", exponential_search, arr, size, queries, QUERIES);
+  time_batch(arr, size, queries, QUERIES, out);
+  printf("\n");
+}
+
+int main()
+{
+  int max_size = 16 * 1024 * 1024; // 64MB
+  int *arr = (int *)malloc((size_t)max_size * sizeof(int));
+  int *queries = (int *)malloc(QUERIES * sizeof(int));
+  int *out = (int *)malloc(QUERIES * sizeof(int));
+  if (arr == NULL || queries == NULL || out == NULL)
+  {
+    fprintf(stderr, "메모리 할당 실패\n");
+    return 1;
+  }
+
+  printf("=== 정렬 배열 탐색 벤치마크 (랜덤 쿼리 %d개) ===\n\n", QUERIES);
+  char title[128];
+
+  // 1. 고른 분포: 간격 2~5 랜덤
+  int sizes[] = {1024, 64 * 1024, 1024 * 1024, max_size}; // 4KB, 256KB, 4MB, 64MB
+  for (int s = 0; s < 4; s++)
+  {
+    int size = sizes[s];
+    arr[0] = 0;
+    for (int i = 1; i < size; i++)
+    {
+      arr[i] = arr[i - 1] + 2 + (int)(next_random() % 4);
+    }
+    fill_queries(arr, size, queries, QUERIES, 0);
+    snprintf(title, sizeof(title), "[고른 분포] 키 %d개 (%dKB)", size, size >> 8);
+    run_all(title, arr, size, queries, out);
+  }
+
+  // 2. 치우친 분포: 대부분 간격 2, 1/1000 확률로 간격 100000
+  int size = max_size / 16;
+  arr[0] = 0;
+  for (int i = 1; i < size; i++)
+  {
+    arr[i] = arr[i - 1] + (next_random() % 1000 == 0 ? 100000 : 2);
+  }
+  fill_queries(arr, size, queries, QUERIES, 0);
+  snprintf(title, sizeof(title), "[치우친 분포] 키 %d개 (1/1000 확률로 큰 간격)", size);
+  run_all(title, arr, size, queries, out);
+
+  // 3. 앞쪽 쿼리: 64MB 배열의 앞 256개 키만 찾음
+  size = max_size;
+  arr[0] = 0;
+  for (int i = 1; i < size; i++)
+  {
+    arr[i] = arr[i - 1] + 2 + (int)(next_random() % 4);
+  }
+  fill_queries(arr, size, queries, QUERIES, 256);
+  printf("[앞쪽 쿼리] 키 %d개, 앞 256개 키만 탐색\n", size);
+  time_single("이진 (분기 없음)", binary_search_branchless, arr, size, queries, QUERIES);
+  time_single("지수", exponential_search, arr, size, queries, QUERIES);
+  time_linear(arr, size, queries);
+
+  free(arr);
+  free(queries);
+  free(out);
+  return 0;
+}
@@ -0,0 +1,231 @@
+#include "binary_search.h"
+
+/* lower bound 위치를 "처음 나오는 인덱스 또는 -1"로 바꿈 */
+static int found_at(const int *arr, int size, int position, int target)
+{
+  return position < size && arr[position] == target ? position : -1;
+}
+
+/**
+ * target 이상인 첫 위치 (분기 없음)
+ *
+ * 남은 범위의 절반 지점과 비교해 시작 위치만 옮긴다. 비교 결과는 cmov로 들어가므로
+ * 분기 예측이 빗나갈 일이 없고, 반복 횟수는 size로만 정해진다 (ceil(log2 size)).
+ * 같다고 일찍 멈추지 않기 때문에 중복이 있어도 항상 첫 위치가 나온다.
+ */
+int binary_search_lower_bound(const int *arr, int size, int target)
+{
+  if (arr == NULL || size <= 0)
+  {
+    return 0;
+  }
+
+  const int *base = arr;
+  int n = size;
+  while (n > 1)
+  {
+    int half = n / 2;
+    base = base[half] < target ? base + half : base;
+    n -= half;
+  }
+  return (int)(base - arr) + (*base < target);
+}
+
+/**
+ * 이진 탐색 (분기 구현)
+ *
+ * 시간 복잡도: O(log n)
+ * 범위 중간과 비교해 같으면 왼쪽 절반에서 계속 찾는다 (첫 위치를 위해).
+ * 작은 배열에서는 빠르지만, 큰 배열의 랜덤 쿼리는 비교마다 절반 확률로
+ * 분기 예측이 빗나가고 다음 메모리 접근도 분기가 풀릴 때까지 시작되지 않는다.
+ */
+int binary_search(const int *arr, int size, int target)
+{
+  if (arr == NULL || size <= 0)
+  {
+    return -1;
+  }
+
+  int lo = 0;
+  int hi = size - 1;
+  int result = -1;
+  while (lo <= hi)
+  {
+    int mid = lo + (hi - lo) / 2;
+    if (arr[mid] < target)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      if (arr[mid] == target)
+      {
+        result = mid;
+      }
+      hi = mid - 1;
+    }
+  }
+  return result;
+}
+
+/**
+ * 분기 없는 이진 탐색
+ * 시간 복잡도: O(log n), 비교 횟수가 쿼리와 상관없이 일정
+ */
+int binary_search_branchless(const int *arr, int size, int target)
+{
+  if (arr == NULL || size <= 0)
+  {
+    return -1;
+  }
+  return found_at(arr, size, binary_search_lower_bound(arr, size, target), target);
+}
+
+/**
+ * 보간 탐색
+ *
+ * [lo, hi) 범위의 양 끝 값으로 target의 위치를 직선 보간해서 찍는다.
+ * 키가 고르게 분포하면 O(log log n)번 만에 범위가 작아진다.
+ * 분포가 치우치면 한 번에 한 칸씩만 줄어 O(n)이 될 수 있으므로,
+ * 찍은 결과 범위가 절반 이하로 줄지 않았으면 다음 한 번은 가운데를 찍는다 (최악 O(log n)).
+ * 범위가 INTERPOLATION_MIN_RANGE 이하가 되면 분기 없는 이진 탐색으로 마무리한다.
+ *
+ * 추정 위치는 double로 계산한다 (값 차이 2^32 x 길이 2^31은 64비트 정수도 넘침).
+ */
+int interpolation_search(const int *arr, int size, int target)
+{
+  if (arr == NULL || size <= 0)
+  {
+    return -1;
+  }
+
+  // 불변식: 답(target 이상인 첫 위치)은 [lo, hi] 안에 있음
+  int lo = 0;
+  int hi = size;
+  bool bisect = false;
+  while (hi - lo > INTERPOLATION_MIN_RANGE)
+  {
+    int first = arr[lo];
+    int last = arr[hi - 1];
+    if (target <= first)
+    {
+      hi = lo;
+      break;
+    }
+    if (target > last)
+    {
+      lo = hi;
+      break;
+    }
+
+    int probe;
+    if (bisect)
+    {
+      probe = lo + (hi - lo) / 2;
+    }
+    else
+    {
+      double fraction = ((double)target - first) / ((double)last - first);
+      probe = lo + (int)(fraction * (hi - 1 - lo));
+    }
+
+    int before = hi - lo;
+    if (arr[probe] < target)
+    {
+      lo = probe + 1;
+    }
+    else
+    {
+      hi = probe;
+    }
+    bisect = !bisect && (hi - lo) * 2 > before;
+  }
+
+  int position = lo + binary_search_lower_bound(arr + lo, hi - lo, target);
+  return found_at(arr, size, position, target);
+}
+
+/**
+ * 지수 탐색 (galloping)
+ *
+ * arr[1], arr[2], arr[4], ... 를 target 이상이 나올 때까지 확인한 뒤
+ * 마지막 두 지점 사이에서 이진 탐색한다.
+ * 시간 복잡도: O(log i) (i = 답의 위치). 앞쪽에 있는 키는 배열 크기와 상관없이 빠르고,
+ * 확인하는 위치가 앞쪽에 모여 있어 캐시에도 잘 남는다.
+ */
+int exponential_search(const int *arr, int size, int target)
+{
+  if (arr == NULL || size <= 0)
+  {
+    return -1;
+  }
+  if (arr[0] >= target)
+  {
+    return arr[0] == target ? 0 : -1;
+  }
+
+  // arr[previous] < target 이고, arr[bound] >= target 이거나 bound가 끝
+  int previous = 0;
+  int bound = 1;
+  while (bound < size && arr[bound] < target)
+  {
+    previous = bound;
+    bound = bound > size / 2 ? size : bound * 2;
+  }
+
+  int lo = previous + 1;
+  int hi = bound < size ? bound : size;
+  int position = lo + binary_search_lower_bound(arr + lo, hi - lo, target);
+  return found_at(arr, size, position, target);
+}
+
+/**
+ * 배치 탐색
+ *
+ * 분기 없는 이진 탐색은 쿼리와 상관없이 단계 수가 같으므로
+ * BINARY_SEARCH_BATCH개 쿼리를 한 단계씩 번갈아 진행할 수 있다.
+ * 서로 독립인 메모리 접근이 동시에 여러 개 진행되고,
+ * 다음 단계에서 볼 수 있는 두 위치(왼쪽/오른쪽 절반의 중간)를 미리 읽어 두므로
+ * 큰 배열에서 메모리 지연이 대부분 가려진다.
+ */
+void binary_search_batch(const int *arr, int size, const int *targets, int count, int *out_idx)
+{
+  if (arr == NULL || size <= 0)
+  {
+    for (int i = 0; i < count; i++)
+    {
+      out_idx[i] = -1;
+    }
+    return;
+  }
+
+  for (int start = 0; start < count; start += BINARY_SEARCH_BATCH)
+  {
+    int batch = count - start < BINARY_SEARCH_BATCH ? count - start : BINARY_SEARCH_BATCH;
+    const int *base[BINARY_SEARCH_BATCH];
+    for (int i = 0; i < batch; i++)
+    {
+      base[i] = arr;
+    }
+
+    int n = size;
+    while (n > 1)
+    {
+      int half = n / 2;
+      int next_half = (n - half) / 2;
+      for (int i = 0; i < batch; i++)
+      {
+        __builtin_prefetch(base[i] + next_half);
+        __builtin_prefetch(base[i] + half + next_half);
+        base[i] = base[i][half] < targets[start + i] ? base[i] + half : base[i];
+      }
+      n -= half;
+    }
+
+    for (int i = 0; i < batch; i++)
+    {
+      int position = (int)(base[i] - arr) + (*base[i] < targets[start + i]);
+      out_idx[start + i] = found_at(arr, size, position, targets[start + i]);
+    }
+  }
+}
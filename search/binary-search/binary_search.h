@@ -0,0 +1,44 @@
+#ifndef BINARY_SEARCH_H
+#define BINARY_SEARCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+/*
+ * 정렬된 배열 탐색
+ *
+ * 모든 함수는 오름차순(중복 허용) 배열을 받고 sequential_search와 같은 규칙으로
+ * target이 처음 나오는 인덱스, 없으면 -1을 반환한다.
+ *
+ * - binary_search: 일반 이진 탐색 (같으면 바로 반환하는 분기 구현)
+ * - binary_search_branchless: 비교 결과로 cmov만 하고 분기하지 않음
+ * - interpolation_search: 값으로 위치를 추정 (고르게 분포된 키에서 O(log log n))
+ * - exponential_search: 1, 2, 4, ... 로 범위를 넓힌 뒤 이진 탐색 (앞쪽 키에 O(log i))
+ * - binary_search_batch: 여러 쿼리를 번갈아 진행하고 다음 위치를 미리 읽음
+ */
+
+/* 한 번에 함께 진행하는 배치 탐색 쿼리 수 */
+#define BINARY_SEARCH_BATCH 16
+
+/* 보간 탐색이 범위가 이 크기 이하로 줄면 분기 없는 이진 탐색으로 마무리 */
+#define INTERPOLATION_MIN_RANGE 32
+
+/**
+ * target 이상인 첫 위치 (0..size, 모두 작으면 size)
+ * 분기 없는 구현, 나머지 함수들의 기본 연산
+ */
+int binary_search_lower_bound(const int *arr, int size, int target);
+
+int binary_search(const int *arr, int size, int target);
+int binary_search_branchless(const int *arr, int size, int target);
+int interpolation_search(const int *arr, int size, int target);
+int exponential_search(const int *arr, int size, int target);
+
+/*
+ * 배치 탐색: out_idx[i] = binary_search_branchless(arr, size, targets[i])
+ * BINARY_SEARCH_BATCH개 쿼리가 같은 단계를 함께 진행하므로 캐시 미스가 겹친다.
+ */
+void binary_search_batch(const int *arr, int size, const int *targets, int count, int *out_idx);
+
+#endif // BINARY_SEARCH_H
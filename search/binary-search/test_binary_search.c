@@ -0,0 +1,246 @@
+#include "binary_search.h"
+#include <limits.h>
+
+static int failures = 0;
+
+/* 조건 확인 헬퍼: ✓/✗ 출력 후 실패 횟수 누적 */
+static void check(bool condition, const char *message)
+{
+  printf("%s %s\n", condition ? "✓" : "✗", message);
+  if (!condition)
+  {
+    failures++;
+  }
+}
+
+/* 기준값: 처음부터 훑어 처음 나오는 인덱스 */
+static int linear_first(const int *arr, int size, int target)
+{
+  for (int i = 0; i < size; i++)
+  {
+    if (arr[i] == target)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+typedef int (*SearchFunc)(const int *arr, int size, int target);
+
+static const char *names[] = {"binary_search", "binary_search_branchless", "interpolation_search",
+                              "exponential_search"};
+static SearchFunc functions[] = {binary_search, binary_search_branchless, interpolation_search,
+                                 exponential_search};
+
+/* 모든 함수가 값 -1 ~ max+1 전체에서 기준값과 같은지 */
+static bool matches_linear(const int *arr, int size, int lo_value, int hi_value, int *which)
+{
+  for (int f = 0; f < 4; f++)
+  {
+    for (int target = lo_value; target <= hi_value; target++)
+    {
+      if (functions[f](arr, size, target) != linear_first(arr, size, target))
+      {
+        *which = f;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * 테스트 1: 모든 크기, 모든 위치
+ */
+void test_all_sizes()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 1] 크기 0~300, 모든 위치      ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  int arr[300];
+  bool ok = true;
+  int which = 0;
+  for (int size = 0; size <= 300 && ok; size++)
+  {
+    // 짝수만 저장: 홀수 target은 항상 실패
+    for (int i = 0; i < size; i++)
+    {
+      arr[i] = i * 2;
+    }
+    ok = matches_linear(arr, size, -2, size * 2 + 1, &which);
+  }
+  check(ok, ok ? "네 함수 모두 있는 값/없는 값이 순차 탐색과 일치" : names[which]);
+
+  bool null_ok = true;
+  for (int f = 0; f < 4; f++)
+  {
+    null_ok = null_ok && functions[f](NULL, 10, 0) == -1 && functions[f](arr, 0, 0) == -1;
+  }
+  check(null_ok, "NULL / 빈 배열은 -1");
+  printf("\n");
+}
+
+/**
+ * 테스트 2: 중복 값은 첫 위치
+ */
+void test_duplicates()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 2] 중복 값                   ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  // 0이 40개, 1이 1개, 2가 100개, ... (길이가 제각각인 구간)
+  int arr[1000];
+  int size = 0;
+  for (int value = 0; size < 1000; value++)
+  {
+    int run = (value * 37) % 101 + 1;
+    for (int r = 0; r < run && size < 1000; r++)
+    {
+      arr[size++] = value;
+    }
+  }
+
+  int which = 0;
+  bool ok = matches_linear(arr, size, -1, arr[size - 1] + 1, &which);
+  check(ok, ok ? "같은 값이 여러 개면 모든 함수가 첫 인덱스 반환" : names[which]);
+
+  int same[64];
+  for (int i = 0; i < 64; i++)
+  {
+    same[i] = 7;
+  }
+  ok = matches_linear(same, 64, 6, 8, &which);
+  check(ok, "모든 원소가 같은 배열 (보간식의 분모 0)");
+  printf("\n");
+}
+
+/**
+ * 테스트 3: 보간 탐색이 불리한 분포
+ */
+void test_skewed()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 3] 치우친 분포 / 극단값        ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  // 대부분 작은 값 + 끝에 아주 큰 값: 보간 추정이 계속 앞쪽을 찍음
+  int size = 5000;
+  int *arr = (int *)malloc(size * sizeof(int));
+  for (int i = 0; i < size - 1; i++)
+  {
+    arr[i] = i;
+  }
+  arr[size - 1] = INT_MAX;
+
+  int which = 0;
+  bool ok = matches_linear(arr, size, -1, size + 1, &which);
+  ok = ok && interpolation_search(arr, size, INT_MAX) == size - 1;
+  check(ok, "앞쪽에 몰린 값 + INT_MAX");
+
+  // 제곱수 (점점 벌어지는 간격)
+  for (int i = 0; i < size; i++)
+  {
+    arr[i] = i * i;
+  }
+  ok = true;
+  for (int i = 0; i < size && ok; i++)
+  {
+    ok = interpolation_search(arr, size, i * i) == i && (i == 0 || interpolation_search(arr, size, i * i + 1) == -1) &&
+         exponential_search(arr, size, i * i) == i;
+  }
+  check(ok, "제곱수 배열에서 모든 값과 사이 값");
+
+  // INT_MIN ~ INT_MAX 전체에 걸친 값 (차이가 int 범위를 넘음)
+  int wide[] = {INT_MIN, INT_MIN + 1, -1000, 0, 1000, INT_MAX - 1, INT_MAX};
+  ok = true;
+  for (int f = 0; f < 4; f++)
+  {
+    for (int i = 0; i < 7; i++)
+    {
+      ok = ok && functions[f](wide, 7, wide[i]) == i;
+    }
+    ok = ok && functions[f](wide, 7, 1) == -1 && functions[f](wide, 7, INT_MIN + 2) == -1;
+  }
+  check(ok, "INT_MIN / INT_MAX 가 섞인 배열 (넘침 없음)");
+
+  free(arr);
+  printf("\n");
+}
+
+/**
+ * 테스트 4: 배치 탐색
+ */
+void test_batch()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 4] 배치 탐색                 ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  int size = 100000;
+  int *arr = (int *)malloc(size * sizeof(int));
+  for (int i = 0; i < size; i++)
+  {
+    arr[i] = i / 3 * 5; // 같은 값 3개씩, 간격 5
+  }
+
+  int count = 1000 + BINARY_SEARCH_BATCH / 2; // 마지막 묶음은 일부만 참
+  int *targets = (int *)malloc(count * sizeof(int));
+  int *out = (int *)malloc(count * sizeof(int));
+  unsigned int seed = 42;
+  for (int i = 0; i < count; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    targets[i] = (int)((seed >> 8) % (unsigned int)(size / 3 * 5 + 10)) - 5;
+  }
+
+  binary_search_batch(arr, size, targets, count, out);
+  bool ok = true;
+  for (int i = 0; i < count && ok; i++)
+  {
+    ok = out[i] == binary_search_branchless(arr, size, targets[i]) && out[i] == binary_search(arr, size, targets[i]);
+  }
+  check(ok, "배치 결과가 단건 탐색과 일치 (일부만 찬 마지막 묶음 포함)");
+
+  bool small_ok = true;
+  for (int n = 0; n <= 40 && small_ok; n++)
+  {
+    binary_search_batch(arr, n, targets, 40, out);
+    for (int i = 0; i < 40; i++)
+    {
+      small_ok = small_ok && out[i] == linear_first(arr, n, targets[i]);
+    }
+  }
+  check(small_ok, "크기 0~40 배열");
+
+  free(arr);
+  free(targets);
+  free(out);
+  printf("\n");
+}
+
+int main()
+{
+  printf("╔═══════════════════════════════════════════════╗\n");
+  printf("║      정렬 배열 탐색 (이진 / 보간 / 지수) 테스트       ║\n");
+  printf("║                                               ║\n");
+  printf("║  이진: O(log n), 보간: 평균 O(log log n)           ║\n");
+  printf("║  지수: O(log i) (i = 찾은 위치)                   ║\n");
+  printf("╚═══════════════════════════════════════════════╝\n\n");
+
+  test_all_sizes();
+  test_duplicates();
+  test_skewed();
+  test_batch();
+
+  if (failures > 0)
+  {
+    printf("✗ 실패한 검사: %d개\n", failures);
+    return 1;
+  }
+
+  printf("✓ 모든 테스트가 완료되었습니다.\n");
+  return 0;
+}
@@ -0,0 +1,140 @@
+#include "bplus_tree.h"
+#include "bst.h"
+#include <time.h>
+
+/*
+ * 벤치마크: B+ 트리 vs 이진 탐색 트리 (랜덤 키)
+ * BST는 레벨마다 malloc된 노드 하나 = 캐시 미스 하나,
+ * B+ 트리는 노드 하나에 키 BPT_MAX_KEYS개라 레벨 수 자체가 적다.
+ */
+
+#define LOOKUPS 2000000
+#define RANGE_QUERIES 10000
+#define RANGE_WIDTH 1000
+
+static double now_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int seed = 99;
+
+static unsigned int next_random(void)
+{
+  seed = seed * 1103515245u + 12345u;
+  return seed;
+}
+
+/* 0..n-1을 섞은 배열 (Fisher-Yates) */
+static int *shuffled_keys(int n)
+{
+  int *keys = (int *)malloc(n * sizeof(int));
+  for (int i = 0; i < n; i++)
+  {
+    keys[i] = i;
+  }
+  for (int i = n - 1; i > 0; i--)
+  {
+    int j = (int)(next_random() % (unsigned int)(i + 1));
+    int temp = keys[i];
+    keys[i] = keys[j];
+    keys[j] = temp;
+  }
+  return keys;
+}
+
+static void run(int n)
+{
+  int *order = shuffled_keys(n);
+  int *lookups = (int *)malloc(LOOKUPS * sizeof(int));
+  for (int i = 0; i < LOOKUPS; i++)
+  {
+    lookups[i] = (int)(next_random() % (unsigned int)n);
+  }
+
+  printf("키 %d개 (노드당 최대 키 %d개)\n", n, BPT_MAX_KEYS);
+
+  // 이진 탐색 트리
+  double t0 = now_seconds();
+  Node *root = NULL;
+  for (int i = 0; i < n; i++)
+  {
+    root = insert_node(root, order[i]);
+  }
+  double t1 = now_seconds();
+  long found = 0;
+  for (int i = 0; i < LOOKUPS; i++)
+  {
+    found += search_node(root, lookups[i]) != NULL;
+  }
+  double t2 = now_seconds();
+  free_tree(root);
+  printf("  BST       랜덤 삽입 %7.3f 초   탐색 %7.1f ns%s\n",
+         t1 - t0, (t2 - t1) * 1e9 / LOOKUPS, found == LOOKUPS ? "" : " [누락]");
+
+  // B+ 트리: 랜덤 삽입
+  t0 = now_seconds();
+  BPlusTree *tree = create_bplus_tree();
+  for (int i = 0; i < n; i++)
+  {
+    bplus_insert(tree, order[i]);
+  }
+  t1 = now_seconds();
+  found = 0;
+  for (int i = 0; i < LOOKUPS; i++)
+  {
+    found += bplus_search(tree, lookups[i]);
+  }
+  t2 = now_seconds();
+  printf("  B+ 트리   랜덤 삽입 %7.3f 초   탐색 %7.1f ns%s  (높이 %d)\n",
+         t1 - t0, (t2 - t1) * 1e9 / LOOKUPS, found == LOOKUPS ? "" : " [누락]", tree->height);
+  free_bplus_tree(tree);
+
+  // B+ 트리: 정렬된 키로 벌크 로딩
+  for (int i = 0; i < n; i++)
+  {
+    order[i] = i;
+  }
+  t0 = now_seconds();
+  tree = bplus_bulk_load(order, n);
+  t1 = now_seconds();
+  found = 0;
+  for (int i = 0; i < LOOKUPS; i++)
+  {
+    found += bplus_search(tree, lookups[i]);
+  }
+  t2 = now_seconds();
+  printf("  B+ 트리   벌크 로딩 %7.3f 초   탐색 %7.1f ns%s  (높이 %d)\n",
+         t1 - t0, (t2 - t1) * 1e9 / LOOKUPS, found == LOOKUPS ? "" : " [누락]", tree->height);
+
+  // 범위 탐색: 리프 연결 리스트 스캔
+  int *out = (int *)malloc(RANGE_WIDTH * sizeof(int));
+  long scanned = 0;
+  t0 = now_seconds();
+  for (int i = 0; i < RANGE_QUERIES; i++)
+  {
+    int lo = (int)(next_random() % (unsigned int)n);
+    scanned += bplus_range(tree, lo, lo + RANGE_WIDTH - 1, out, RANGE_WIDTH);
+  }
+  t1 = now_seconds();
+  printf("  B+ 트리   범위 탐색 (폭 %d) %d회: %.1f us/회, 키당 %.2f ns\n\n",
+         RANGE_WIDTH, RANGE_QUERIES, (t1 - t0) * 1e6 / RANGE_QUERIES,
+         (t1 - t0) * 1e9 / (scanned > 0 ? scanned : 1));
+
+  free(out);
+  free_bplus_tree(tree);
+  free(order);
+  free(lookups);
+}
+
+int main()
+{
+  printf("=== B+ 트리 vs 이진 탐색 트리 벤치마크 (랜덤 탐색 %d회) ===\n\n", LOOKUPS);
+
+  run(1000000);
+  run(10000000);
+
+  return 0;
+}
@@ -0,0 +1,745 @@
+#include "bplus_tree.h"
+#include <limits.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/* ---------- 노드 할당 ---------- */
+
+/* 캐시 라인에 정렬된 노드 할당 (리프는 children 배열 없이) */
+static BPlusNode *allocate_node(bool is_leaf)
+{
+  size_t size = is_leaf ? offsetof(BPlusNode, children) : sizeof(BPlusNode);
+  void *memory = NULL;
+  if (posix_memalign(&memory, BPT_ALIGNMENT, size) != 0)
+  {
+    return NULL;
+  }
+
+  BPlusNode *node = (BPlusNode *)memory;
+  node->num_keys = 0;
+  node->is_leaf = is_leaf;
+  node->next = NULL;
+  return node;
+}
+
+/**
+ * 빈 B+ 트리 생성
+ * @return: 생성된 트리 (할당 실패 시 NULL)
+ */
+BPlusTree *create_bplus_tree(void)
+{
+  BPlusTree *tree = (BPlusTree *)malloc(sizeof(BPlusTree));
+  if (tree == NULL)
+  {
+    return NULL;
+  }
+  tree->root = NULL;
+  tree->height = 0;
+  tree->size = 0;
+  return tree;
+}
+
+/* ---------- 노드 안 탐색 ---------- */
+
+/**
+ * keys[0..num_keys)에서 key보다 작은 키의 개수
+ *
+ * 키가 정렬되어 있으므로 "작은 키의 개수"가 곧 삽입 위치다.
+ * 이진 탐색 대신 노드 전체를 비교해 결과(-1 또는 0)를 누적하므로
+ * 분기 예측 실패가 없고, 64개 키도 AVX2로 8번, SSE2로 16번이면 끝난다.
+ */
+int bplus_lower_bound(const int *keys, int num_keys, int key)
+{
+  int i = 0;
+  int count = 0;
+
+#if defined(__AVX2__)
+  __m256i needle8 = _mm256_set1_epi32(key);
+  __m256i acc8 = _mm256_setzero_si256();
+  for (; i + 8 <= num_keys; i += 8)
+  {
+    __m256i block = _mm256_loadu_si256((const __m256i *)(keys + i));
+    // keys[j] < key 이면 -1 이므로 빼면 1 증가
+    acc8 = _mm256_sub_epi32(acc8, _mm256_cmpgt_epi32(needle8, block));
+  }
+  __m128i acc = _mm_add_epi32(_mm256_castsi256_si128(acc8), _mm256_extracti128_si256(acc8, 1));
+#elif defined(__SSE2__)
+  __m128i acc = _mm_setzero_si128();
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__)
+  __m128i needle = _mm_set1_epi32(key);
+  for (; i + 4 <= num_keys; i += 4)
+  {
+    __m128i block = _mm_loadu_si128((const __m128i *)(keys + i));
+    acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(needle, block));
+  }
+
+  // 4개 레인 합산
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+  count = _mm_cvtsi128_si32(acc);
+#endif
+
+  // 나머지 (SIMD가 없으면 전체)
+  for (; i < num_keys; i++)
+  {
+    count += keys[i] < key;
+  }
+
+  return count;
+}
+
+/* 내부 노드에서 key가 내려갈 자식 번호 = key 이하인 구분자의 개수 */
+static int child_index(const BPlusNode *node, int key)
+{
+  if (key == INT_MAX)
+  {
+    return node->num_keys;
+  }
+  return bplus_lower_bound(node->keys, node->num_keys, key + 1);
+}
+
+/* key가 들어 있을 수 있는 리프 */
+static BPlusNode *find_leaf(BPlusNode *node, int key)
+{
+  while (!node->is_leaf)
+  {
+    node = node->children[child_index(node, key)];
+  }
+  return node;
+}
+
+/**
+ * B+ 트리에서 키 탐색
+ * @return: 있으면 true
+ *
+ * 시간 복잡도: O(log_B n) 노드 방문, 노드마다 O(B) SIMD 비교
+ */
+bool bplus_search(const BPlusTree *tree, int key)
+{
+  if (tree == NULL || tree->root == NULL)
+  {
+    return false;
+  }
+
+  BPlusNode *leaf = find_leaf(tree->root, key);
+  int pos = bplus_lower_bound(leaf->keys, leaf->num_keys, key);
+  return pos < leaf->num_keys && leaf->keys[pos] == key;
+}
+
+/* ---------- 삽입 ---------- */
+
+/*
+ * 삽입 한 번에 필요한 새 노드
+ * 분할은 경로 아래쪽에서 연속으로 꽉 찬 노드에서만 일어나므로 개수를 미리 셀 수 있다.
+ * 트리를 바꾸기 전에 모두 할당해 두면, 할당이 실패해도 트리는 그대로다.
+ * 내부 노드의 자식은 최소 2개라 int 키로는 높이가 32를 넘지 않는다.
+ */
+#define BPT_MAX_SPLITS 34
+
+typedef struct SpareNodes
+{
+  BPlusNode *nodes[BPT_MAX_SPLITS]; /* [0]은 리프, 나머지는 아래층부터 쓰는 내부 노드 */
+  int count;
+  int used;
+} SpareNodes;
+
+static BPlusNode *take_spare(SpareNodes *spares)
+{
+  return spares->nodes[spares->used++];
+}
+
+static void free_spares(SpareNodes *spares)
+{
+  for (int i = spares->used; i < spares->count; i++)
+  {
+    free(spares->nodes[i]);
+  }
+}
+
+/**
+ * key를 넣을 때 필요한 새 노드를 미리 할당
+ * @return: 할당 실패 시 false (할당한 것은 해제함)
+ */
+static bool reserve_split_nodes(const BPlusTree *tree, int key, SpareNodes *spares)
+{
+  // 리프까지 내려가며, 끝에서부터 연속으로 꽉 찬 노드 수 = 분할 횟수
+  int full_run = 0;
+  const BPlusNode *node = tree->root;
+  while (true)
+  {
+    full_run = node->num_keys == BPT_MAX_KEYS ? full_run + 1 : 0;
+    if (node->is_leaf)
+    {
+      break;
+    }
+    node = node->children[child_index(node, key)];
+  }
+
+  spares->count = 0;
+  spares->used = 0;
+  if (full_run == 0)
+  {
+    return true;
+  }
+
+  // 리프 1개 + 내부 노드 분할 (full_run - 1)개 + 루트까지 분할되면 새 루트 1개
+  int needed = full_run + (full_run == tree->height ? 1 : 0);
+  for (int i = 0; i < needed; i++)
+  {
+    BPlusNode *spare = allocate_node(i == 0);
+    if (spare == NULL)
+    {
+      free_spares(spares);
+      return false;
+    }
+    spares->nodes[spares->count++] = spare;
+  }
+  return true;
+}
+
+/**
+ * 서브트리에 키 삽입
+ * @param spares: 분할에 쓸 노드 (reserve_split_nodes로 미리 할당)
+ * @param split_key: 노드가 분할되면 새 오른쪽 노드의 구분자
+ * @param split_node: 노드가 분할되면 새 오른쪽 노드, 아니면 NULL
+ * @return: 삽입했으면 true (중복이면 false)
+ */
+static bool insert_recursive(BPlusNode *node, int key, SpareNodes *spares, int *split_key,
+                             BPlusNode **split_node)
+{
+  *split_node = NULL;
+
+  if (node->is_leaf)
+  {
+    int pos = bplus_lower_bound(node->keys, node->num_keys, key);
+    if (pos < node->num_keys && node->keys[pos] == key)
+    {
+      return false;
+    }
+
+    if (node->num_keys < BPT_MAX_KEYS)
+    {
+      memmove(&node->keys[pos + 1], &node->keys[pos], (node->num_keys - pos) * sizeof(int));
+      node->keys[pos] = key;
+      node->num_keys++;
+      return true;
+    }
+
+    // 꽉 찬 리프: MAX + 1개를 반씩 나눔
+    int temp[BPT_MAX_KEYS + 1];
+    memcpy(temp, node->keys, pos * sizeof(int));
+    temp[pos] = key;
+    memcpy(&temp[pos + 1], &node->keys[pos], (BPT_MAX_KEYS - pos) * sizeof(int));
+
+    BPlusNode *right = take_spare(spares);
+    int left_count = (BPT_MAX_KEYS + 1) / 2;
+    node->num_keys = left_count;
+    memcpy(node->keys, temp, left_count * sizeof(int));
+    right->num_keys = BPT_MAX_KEYS + 1 - left_count;
+    memcpy(right->keys, &temp[left_count], right->num_keys * sizeof(int));
+
+    // 리프 연결 리스트에 끼워 넣음
+    right->next = node->next;
+    node->next = right;
+
+    *split_key = right->keys[0];
+    *split_node = right;
+    return true;
+  }
+
+  int index = child_index(node, key);
+  int child_key;
+  BPlusNode *child_split;
+  bool inserted = insert_recursive(node->children[index], key, spares, &child_key, &child_split);
+  if (child_split == NULL)
+  {
+    return inserted;
+  }
+
+  // 자식이 분할됨: 구분자 child_key와 새 자식을 index 위치에 추가
+  if (node->num_keys < BPT_MAX_KEYS)
+  {
+    memmove(&node->keys[index + 1], &node->keys[index], (node->num_keys - index) * sizeof(int));
+    memmove(&node->children[index + 2], &node->children[index + 1],
+            (node->num_keys - index) * sizeof(BPlusNode *));
+    node->keys[index] = child_key;
+    node->children[index + 1] = child_split;
+    node->num_keys++;
+    return true;
+  }
+
+  // 꽉 찬 내부 노드: 가운데 키를 위로 올리고 나머지를 반씩 나눔
+  int temp_keys[BPT_MAX_KEYS + 1];
+  BPlusNode *temp_children[BPT_MAX_KEYS + 2];
+  memcpy(temp_keys, node->keys, index * sizeof(int));
+  temp_keys[index] = child_key;
+  memcpy(&temp_keys[index + 1], &node->keys[index], (BPT_MAX_KEYS - index) * sizeof(int));
+  memcpy(temp_children, node->children, (index + 1) * sizeof(BPlusNode *));
+  temp_children[index + 1] = child_split;
+  memcpy(&temp_children[index + 2], &node->children[index + 1],
+         (BPT_MAX_KEYS - index) * sizeof(BPlusNode *));
+
+  int mid = (BPT_MAX_KEYS + 1) / 2;
+  BPlusNode *right = take_spare(spares);
+
+  node->num_keys = mid;
+  memcpy(node->keys, temp_keys, mid * sizeof(int));
+  memcpy(node->children, temp_children, (mid + 1) * sizeof(BPlusNode *));
+
+  right->num_keys = BPT_MAX_KEYS - mid;
+  memcpy(right->keys, &temp_keys[mid + 1], right->num_keys * sizeof(int));
+  memcpy(right->children, &temp_children[mid + 1], (right->num_keys + 1) * sizeof(BPlusNode *));
+
+  *split_key = temp_keys[mid];
+  *split_node = right;
+  return true;
+}
+
+/**
+ * B+ 트리에 키 삽입
+ * @return: 삽입했으면 true, 이미 있거나 할당 실패 시 false (트리는 그대로)
+ *
+ * 리프가 넘치면 분할하고 구분자를 부모로 올린다.
+ * 루트가 분할되면 새 루트를 만들어 높이가 1 증가한다.
+ */
+bool bplus_insert(BPlusTree *tree, int key)
+{
+  if (tree == NULL)
+  {
+    return false;
+  }
+
+  if (tree->root == NULL)
+  {
+    BPlusNode *leaf = allocate_node(true);
+    if (leaf == NULL)
+    {
+      return false;
+    }
+    tree->root = leaf;
+    tree->root->keys[0] = key;
+    tree->root->num_keys = 1;
+    tree->height = 1;
+    tree->size = 1;
+    return true;
+  }
+
+  SpareNodes spares;
+  if (!reserve_split_nodes(tree, key, &spares))
+  {
+    return false;
+  }
+
+  int split_key;
+  BPlusNode *split_node;
+  bool inserted = insert_recursive(tree->root, key, &spares, &split_key, &split_node);
+  if (split_node != NULL)
+  {
+    BPlusNode *root = take_spare(&spares);
+    root->keys[0] = split_key;
+    root->children[0] = tree->root;
+    root->children[1] = split_node;
+    root->num_keys = 1;
+    tree->root = root;
+    tree->height++;
+  }
+  free_spares(&spares); // 중복이라 쓰지 않은 노드
+
+  if (inserted)
+  {
+    tree->size++;
+  }
+  return inserted;
+}
+
+/* ---------- 삭제 ---------- */
+
+/* 왼쪽 형제에서 키 하나를 빌려옴 */
+static void borrow_from_left(BPlusNode *parent, int index)
+{
+  BPlusNode *child = parent->children[index];
+  BPlusNode *left = parent->children[index - 1];
+
+  memmove(&child->keys[1], &child->keys[0], child->num_keys * sizeof(int));
+
+  if (child->is_leaf)
+  {
+    child->keys[0] = left->keys[left->num_keys - 1];
+    parent->keys[index - 1] = child->keys[0];
+  }
+  else
+  {
+    // 구분자를 내리고 형제의 마지막 키를 올림
+    memmove(&child->children[1], &child->children[0], (child->num_keys + 1) * sizeof(BPlusNode *));
+    child->keys[0] = parent->keys[index - 1];
+    child->children[0] = left->children[left->num_keys];
+    parent->keys[index - 1] = left->keys[left->num_keys - 1];
+  }
+
+  left->num_keys--;
+  child->num_keys++;
+}
+
+/* 오른쪽 형제에서 키 하나를 빌려옴 */
+static void borrow_from_right(BPlusNode *parent, int index)
+{
+  BPlusNode *child = parent->children[index];
+  BPlusNode *right = parent->children[index + 1];
+
+  if (child->is_leaf)
+  {
+    child->keys[child->num_keys] = right->keys[0];
+    memmove(&right->keys[0], &right->keys[1], (right->num_keys - 1) * sizeof(int));
+    parent->keys[index] = right->keys[0];
+  }
+  else
+  {
+    child->keys[child->num_keys] = parent->keys[index];
+    child->children[child->num_keys + 1] = right->children[0];
+    parent->keys[index] = right->keys[0];
+    memmove(&right->keys[0], &right->keys[1], (right->num_keys - 1) * sizeof(int));
+    memmove(&right->children[0], &right->children[1], right->num_keys * sizeof(BPlusNode *));
+  }
+
+  child->num_keys++;
+  right->num_keys--;
+}
+
+/* children[index]와 children[index + 1]을 하나로 합치고 구분자 제거 */
+static void merge_children(BPlusNode *parent, int index)
+{
+  BPlusNode *left = parent->children[index];
+  BPlusNode *right = parent->children[index + 1];
+
+  if (left->is_leaf)
+  {
+    memcpy(&left->keys[left->num_keys], right->keys, right->num_keys * sizeof(int));
+    left->num_keys += right->num_keys;
+    left->next = right->next;
+  }
+  else
+  {
+    // 내부 노드는 구분자를 내려서 사이에 끼움
+    left->keys[left->num_keys] = parent->keys[index];
+    memcpy(&left->keys[left->num_keys + 1], right->keys, right->num_keys * sizeof(int));
+    memcpy(&left->children[left->num_keys + 1], right->children,
+           (right->num_keys + 1) * sizeof(BPlusNode *));
+    left->num_keys += right->num_keys + 1;
+  }
+
+  free(right);
+
+  memmove(&parent->keys[index], &parent->keys[index + 1],
+          (parent->num_keys - index - 1) * sizeof(int));
+  memmove(&parent->children[index + 1], &parent->children[index + 2],
+          (parent->num_keys - index - 1) * sizeof(BPlusNode *));
+  parent->num_keys--;
+}
+
+/* 최소 키 개수보다 작아진 children[index]를 빌리기 또는 합치기로 복구 */
+static void fix_underflow(BPlusNode *parent, int index)
+{
+  if (index > 0 && parent->children[index - 1]->num_keys > BPT_MIN_KEYS)
+  {
+    borrow_from_left(parent, index);
+  }
+  else if (index < parent->num_keys && parent->children[index + 1]->num_keys > BPT_MIN_KEYS)
+  {
+    borrow_from_right(parent, index);
+  }
+  else if (index > 0)
+  {
+    merge_children(parent, index - 1);
+  }
+  else
+  {
+    merge_children(parent, index);
+  }
+}
+
+static bool delete_recursive(BPlusNode *node, int key)
+{
+  if (node->is_leaf)
+  {
+    int pos = bplus_lower_bound(node->keys, node->num_keys, key);
+    if (pos == node->num_keys || node->keys[pos] != key)
+    {
+      return false;
+    }
+    memmove(&node->keys[pos], &node->keys[pos + 1], (node->num_keys - pos - 1) * sizeof(int));
+    node->num_keys--;
+    return true;
+  }
+
+  int index = child_index(node, key);
+  if (!delete_recursive(node->children[index], key))
+  {
+    return false;
+  }
+
+  if (node->children[index]->num_keys < BPT_MIN_KEYS)
+  {
+    fix_underflow(node, index);
+  }
+  return true;
+}
+
+/**
+ * B+ 트리에서 키 삭제
+ * @return: 삭제했으면 true, 없으면 false
+ *
+ * 노드가 절반 미만으로 줄면 형제에게서 빌리고, 빌릴 수 없으면 합친다.
+ * 루트의 자식이 하나만 남으면 그 자식이 새 루트가 된다.
+ */
+bool bplus_delete(BPlusTree *tree, int key)
+{
+  if (tree == NULL || tree->root == NULL)
+  {
+    return false;
+  }
+
+  if (!delete_recursive(tree->root, key))
+  {
+    return false;
+  }
+  tree->size--;
+
+  BPlusNode *root = tree->root;
+  if (root->num_keys == 0)
+  {
+    tree->root = root->is_leaf ? NULL : root->children[0];
+    tree->height--;
+    free(root);
+  }
+  return true;
+}
+
+/* ---------- 범위 탐색 / 출력 ---------- */
+
+/**
+ * lo 이상 hi 이하의 키를 오름차순으로 수집
+ *
+ * lo가 들어갈 리프까지 한 번만 내려간 뒤, 리프의 next 포인터를 따라
+ * 연속된 키 배열을 훑는다 (트리를 다시 오르내리지 않음).
+ */
+int bplus_range(const BPlusTree *tree, int lo, int hi, int *out, int max_out)
+{
+  if (tree == NULL || tree->root == NULL || lo > hi || max_out <= 0)
+  {
+    return 0;
+  }
+
+  BPlusNode *leaf = find_leaf(tree->root, lo);
+  int pos = bplus_lower_bound(leaf->keys, leaf->num_keys, lo);
+  int count = 0;
+
+  while (leaf != NULL)
+  {
+    for (; pos < leaf->num_keys; pos++)
+    {
+      if (leaf->keys[pos] > hi || count == max_out)
+      {
+        return count;
+      }
+      out[count++] = leaf->keys[pos];
+    }
+    leaf = leaf->next;
+    pos = 0;
+  }
+
+  return count;
+}
+
+/**
+ * 오름차순 출력 (중위 순회에 해당)
+ */
+void bplus_print(const BPlusTree *tree)
+{
+  if (tree == NULL || tree->root == NULL)
+  {
+    return;
+  }
+
+  BPlusNode *leaf = tree->root;
+  while (!leaf->is_leaf)
+  {
+    leaf = leaf->children[0];
+  }
+
+  for (; leaf != NULL; leaf = leaf->next)
+  {
+    for (int i = 0; i < leaf->num_keys; i++)
+    {
+      printf("%d ", leaf->keys[i]);
+    }
+  }
+}
+
+/* ---------- 벌크 로딩 ---------- */
+
+static void free_node(BPlusNode *node);
+
+/*
+ * 벌크 로딩 도중 할당 실패: 지금까지 만든 노드를 모두 해제
+ * level[0..built)은 이번 층에서 만든 노드, level[rest..count)는 아직 부모가 없는 노드
+ * (그 사이 칸의 노드는 이미 만든 부모가 가지고 있음)
+ */
+static void free_partial_level(BPlusNode **level, int built, int rest, int count)
+{
+  for (int i = 0; i < built; i++)
+  {
+    free_node(level[i]);
+  }
+  for (int i = rest; i < count; i++)
+  {
+    free_node(level[i]);
+  }
+}
+
+/**
+ * 정렬된 키로 트리를 아래에서 위로 한 층씩 구성
+ * @param keys: 엄격히 증가하는 키 배열
+ * @param n: 키 개수
+ * @return: 생성된 트리 (정렬되지 않았거나 할당 실패 시 NULL)
+ *
+ * 각 층을 ceil(개수 / 용량)개의 노드로 균등하게 나누므로
+ * 마지막 노드도 최소 키 개수를 만족한다. 리프는 가득 채운다.
+ * 시간 복잡도: O(n)
+ */
+BPlusTree *bplus_bulk_load(const int *keys, int n)
+{
+  if (n < 0 || (n > 0 && keys == NULL))
+  {
+    return NULL;
+  }
+  for (int i = 1; i < n; i++)
+  {
+    if (keys[i - 1] >= keys[i])
+    {
+      return NULL;
+    }
+  }
+
+  BPlusTree *tree = create_bplus_tree();
+  if (tree == NULL || n == 0)
+  {
+    return tree;
+  }
+
+  // 리프 층
+  int count = (n + BPT_MAX_KEYS - 1) / BPT_MAX_KEYS;
+  BPlusNode **level = (BPlusNode **)malloc(count * sizeof(BPlusNode *));
+  int *mins = (int *)malloc(count * sizeof(int));
+  if (level == NULL || mins == NULL)
+  {
+    free(level);
+    free(mins);
+    free(tree);
+    return NULL;
+  }
+
+  int offset = 0;
+  for (int i = 0; i < count; i++)
+  {
+    int size = n / count + (i < n % count ? 1 : 0);
+    BPlusNode *leaf = allocate_node(true);
+    if (leaf == NULL)
+    {
+      free_partial_level(level, i, count, count);
+      free(level);
+      free(mins);
+      free(tree);
+      return NULL;
+    }
+    memcpy(leaf->keys, &keys[offset], size * sizeof(int));
+    leaf->num_keys = size;
+    if (i > 0)
+    {
+      level[i - 1]->next = leaf;
+    }
+    level[i] = leaf;
+    mins[i] = keys[offset];
+    offset += size;
+  }
+  tree->height = 1;
+
+  // 내부 층: 한 노드에 자식 최대 MAX + 1개
+  while (count > 1)
+  {
+    int parents = (count + BPT_MAX_KEYS) / (BPT_MAX_KEYS + 1);
+    int child = 0;
+
+    for (int p = 0; p < parents; p++)
+    {
+      int fanout = count / parents + (p < count % parents ? 1 : 0);
+      BPlusNode *node = allocate_node(false);
+      if (node == NULL)
+      {
+        free_partial_level(level, p, child, count);
+        free(level);
+        free(mins);
+        free(tree);
+        return NULL;
+      }
+      node->children[0] = level[child];
+      int subtree_min = mins[child];
+      for (int c = 1; c < fanout; c++)
+      {
+        node->children[c] = level[child + c];
+        node->keys[c - 1] = mins[child + c];
+      }
+      node->num_keys = fanout - 1;
+      child += fanout;
+
+      // 제자리 갱신: p < child 이므로 아직 읽지 않은 칸을 덮지 않음
+      level[p] = node;
+      mins[p] = subtree_min;
+    }
+
+    count = parents;
+    tree->height++;
+  }
+
+  tree->root = level[0];
+  tree->size = n;
+  free(level);
+  free(mins);
+  return tree;
+}
+
+/* ---------- 해제 ---------- */
+
+static void free_node(BPlusNode *node)
+{
+  if (!node->is_leaf)
+  {
+    for (int i = 0; i <= node->num_keys; i++)
+    {
+      free_node(node->children[i]);
+    }
+  }
+  free(node);
+}
+
+/**
+ * 트리 전체 메모리 해제
+ * 재귀 깊이는 트리 높이(log_B n)뿐이다.
+ */
+void free_bplus_tree(BPlusTree *tree)
+{
+  if (tree == NULL)
+  {
+    return;
+  }
+  if (tree->root != NULL)
+  {
+    free_node(tree->root);
+  }
+  free(tree);
+}
@@ -0,0 +1,86 @@
+#ifndef BPLUS_TREE_H
+#define BPLUS_TREE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+/*
+ * 노드당 최대 키 개수
+ * 기본값 64: 키 배열이 256바이트(캐시 라인 4개)라 노드 안 탐색이 SIMD 16번으로 끝난다.
+ * 컴파일 시 -DBPT_MAX_KEYS=N 으로 조절할 수 있다.
+ *   - 14:   리프 하나(키 + 헤더)가 캐시 라인 하나(64바이트)에 들어감
+ *   - 1000: 내부 노드가 4KB 페이지 두 개 정도 (디스크/페이지 단위 인덱스)
+ */
+#ifndef BPT_MAX_KEYS
+#define BPT_MAX_KEYS 64
+#endif
+
+#if BPT_MAX_KEYS < 3
+#error "BPT_MAX_KEYS는 3 이상이어야 합니다"
+#endif
+
+/* 루트를 제외한 노드가 가져야 하는 최소 키 개수 */
+#define BPT_MIN_KEYS (BPT_MAX_KEYS / 2)
+
+/* 노드 정렬 단위 (캐시 라인) */
+#define BPT_ALIGNMENT 64
+
+/*
+ * B+ 트리 노드
+ * 키는 노드 맨 앞에 두어 캐시 라인 경계에 맞춘다.
+ * 리프는 children 배열 없이 할당하므로 (offsetof(BPlusNode, children) 바이트)
+ * 리프에서는 children에 접근하면 안 된다.
+ */
+typedef struct BPlusNode
+{
+  int keys[BPT_MAX_KEYS];
+  int num_keys;
+  bool is_leaf;
+  struct BPlusNode *next;                       /* 리프: 오른쪽 리프 (범위 탐색용) */
+  struct BPlusNode *children[BPT_MAX_KEYS + 1]; /* 내부 노드: 자식 포인터 */
+} BPlusNode;
+
+/*
+ * B+ 트리 구조체
+ * 모든 키는 리프에 있고, 내부 노드의 키 keys[i]는
+ * children[i + 1] 서브트리의 최솟값 이하인 구분자다.
+ */
+typedef struct BPlusTree
+{
+  BPlusNode *root; /* 빈 트리면 NULL */
+  int height;      /* 리프만 있으면 1, 빈 트리면 0 */
+  long long size;  /* 저장된 키 개수 */
+} BPlusTree;
+
+/* 생성/해제 */
+BPlusTree *create_bplus_tree(void);
+void free_bplus_tree(BPlusTree *tree);
+
+/* 기본 연산 (bst.h와 같은 int 키 집합, 중복 허용 안 함) */
+bool bplus_insert(BPlusTree *tree, int key);
+bool bplus_search(const BPlusTree *tree, int key);
+bool bplus_delete(BPlusTree *tree, int key);
+
+/*
+ * 범위 탐색: lo <= key <= hi 인 키를 오름차순으로 out에 최대 max_out개 저장
+ * @return: 저장한 키 개수
+ */
+int bplus_range(const BPlusTree *tree, int lo, int hi, int *out, int max_out);
+
+/*
+ * 정렬된 키 배열로 한 번에 트리 구성 (O(n))
+ * 키가 엄격히 증가하지 않으면 NULL 반환
+ */
+BPlusTree *bplus_bulk_load(const int *keys, int n);
+
+/*
+ * 노드 안 탐색: keys[0..num_keys)에서 key보다 작은 키의 개수 (= lower bound)
+ * SSE2/AVX2가 있으면 비교 결과를 더하는 분기 없는 SIMD로 계산한다.
+ */
+int bplus_lower_bound(const int *keys, int num_keys, int key);
+
+/* 오름차순 출력 (리프 연결 리스트를 따라감) */
+void bplus_print(const BPlusTree *tree);
+
+#endif // BPLUS_TREE_H
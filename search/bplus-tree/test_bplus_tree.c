@@ -0,0 +1,387 @@
+#include "bplus_tree.h"
+#include <limits.h>
+
+static int failures = 0;
+
+/* 조건 확인 헬퍼: ✓/✗ 출력 후 실패 횟수 누적 */
+static void check(bool condition, const char *message)
+{
+  printf("%s %s\n", condition ? "✓" : "✗", message);
+  if (!condition)
+  {
+    failures++;
+  }
+}
+
+/* 결정적인 랜덤 값 생성을 위한 간단한 LCG */
+static unsigned int seed = 2024;
+
+static unsigned int next_random(void)
+{
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 8;
+}
+
+/**
+ * 노드 불변식 검사
+ * - 키 개수: 루트가 아니면 MIN 이상, 항상 MAX 이하
+ * - 노드 안 키가 엄격히 증가하고 [lo, hi) 범위 안에 있음
+ * - 모든 리프가 같은 깊이
+ */
+static bool verify_node(BPlusNode *node, long lo, long hi, bool is_root, int depth, int *leaf_depth)
+{
+  if (node->num_keys > BPT_MAX_KEYS || node->num_keys < (is_root ? 1 : BPT_MIN_KEYS))
+  {
+    return false;
+  }
+  for (int i = 0; i < node->num_keys; i++)
+  {
+    if (node->keys[i] < lo || node->keys[i] >= hi || (i > 0 && node->keys[i - 1] >= node->keys[i]))
+    {
+      return false;
+    }
+  }
+
+  if (node->is_leaf)
+  {
+    if (*leaf_depth < 0)
+    {
+      *leaf_depth = depth;
+    }
+    return *leaf_depth == depth;
+  }
+
+  for (int i = 0; i <= node->num_keys; i++)
+  {
+    long child_lo = i == 0 ? lo : node->keys[i - 1];
+    long child_hi = i == node->num_keys ? hi : node->keys[i];
+    if (!verify_node(node->children[i], child_lo, child_hi, false, depth + 1, leaf_depth))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* 트리 전체 검사: 노드 불변식 + 높이 + 리프 연결 리스트가 size개를 오름차순으로 가짐 */
+static bool is_valid_bplus(BPlusTree *tree)
+{
+  if (tree->root == NULL)
+  {
+    return tree->size == 0 && tree->height == 0;
+  }
+
+  int leaf_depth = -1;
+  if (!verify_node(tree->root, (long)INT_MIN, (long)INT_MAX + 1, true, 1, &leaf_depth) ||
+      leaf_depth != tree->height)
+  {
+    return false;
+  }
+
+  BPlusNode *leaf = tree->root;
+  while (!leaf->is_leaf)
+  {
+    leaf = leaf->children[0];
+  }
+
+  long long count = 0;
+  long previous = (long)INT_MIN - 1;
+  for (; leaf != NULL; leaf = leaf->next)
+  {
+    for (int i = 0; i < leaf->num_keys; i++)
+    {
+      if (leaf->keys[i] <= previous)
+      {
+        return false;
+      }
+      previous = leaf->keys[i];
+      count++;
+    }
+  }
+  return count == tree->size;
+}
+
+/**
+ * 테스트 1: 노드 안 SIMD 탐색 vs 스칼라
+ */
+void test_lower_bound()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 1] 노드 안 SIMD 탐색          ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  int keys[BPT_MAX_KEYS];
+  bool correct = true;
+
+  for (int n = 0; n <= BPT_MAX_KEYS && correct; n++)
+  {
+    // 간격이 1~3인 정렬된 키 (음수 포함)
+    int value = -100;
+    for (int i = 0; i < n; i++)
+    {
+      value += 1 + (int)(next_random() % 3);
+      keys[i] = value;
+    }
+
+    int queries[] = {INT_MIN, INT_MAX, -101, -100, 0, value, value + 1};
+    for (int q = -110; q < value + 5 && correct; q++)
+    {
+      int expected = 0;
+      while (expected < n && keys[expected] < q)
+      {
+        expected++;
+      }
+      correct = bplus_lower_bound(keys, n, q) == expected;
+    }
+    for (int q = 0; q < 7 && correct; q++)
+    {
+      int expected = 0;
+      while (expected < n && keys[expected] < queries[q])
+      {
+        expected++;
+      }
+      correct = bplus_lower_bound(keys, n, queries[q]) == expected;
+    }
+  }
+
+  check(correct, "키 0~MAX개, 모든 위치와 INT_MIN/INT_MAX에서 스칼라 결과와 일치");
+  printf("\n");
+}
+
+/**
+ * 테스트 2: 빈 트리와 작은 트리
+ */
+void test_small_tree()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 2] 빈 트리와 작은 트리         ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  BPlusTree *tree = create_bplus_tree();
+  check(!bplus_search(tree, 10) && !bplus_delete(tree, 10), "빈 트리 탐색/삭제: 없음");
+
+  int keys[] = {50, 30, 70, 20, 40, 60, 80};
+  for (int i = 0; i < 7; i++)
+  {
+    bplus_insert(tree, keys[i]);
+  }
+  check(!bplus_insert(tree, 40), "중복 삽입은 false");
+  check(bplus_search(tree, 40) && !bplus_search(tree, 45), "40 있음, 45 없음");
+  check(tree->size == 7 && is_valid_bplus(tree), "키 7개, 불변식 유지");
+
+  printf("오름차순 출력: ");
+  bplus_print(tree);
+  printf("\n");
+
+  bplus_insert(tree, INT_MIN);
+  bplus_insert(tree, INT_MAX);
+  check(bplus_search(tree, INT_MIN) && bplus_search(tree, INT_MAX), "INT_MIN/INT_MAX 키");
+
+  free_bplus_tree(tree);
+  printf("\n");
+}
+
+/**
+ * 테스트 3: 정렬된 순서로 삽입 (노드 분할)
+ */
+void test_sorted_insertion()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 3] 정렬된 순서로 삽입          ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  int n = 200000;
+  BPlusTree *ascending = create_bplus_tree();
+  BPlusTree *descending = create_bplus_tree();
+  for (int i = 0; i < n; i++)
+  {
+    bplus_insert(ascending, i * 2);
+    bplus_insert(descending, (n - 1 - i) * 2);
+  }
+
+  printf("키 %d개, 노드당 최대 키 %d개, 높이: %d / %d\n",
+         n, BPT_MAX_KEYS, ascending->height, descending->height);
+  check(is_valid_bplus(ascending) && is_valid_bplus(descending), "B+ 트리 불변식 유지");
+
+  bool all_found = true;
+  for (int i = 0; i < n && all_found; i++)
+  {
+    all_found = bplus_search(ascending, i * 2) && !bplus_search(ascending, i * 2 + 1) &&
+                bplus_search(descending, i * 2);
+  }
+  check(all_found, "짝수 키는 모두 있고 홀수 키는 없음");
+
+  free_bplus_tree(ascending);
+  free_bplus_tree(descending);
+  printf("\n");
+}
+
+/**
+ * 테스트 4: 리프 연결 리스트를 이용한 범위 탐색
+ */
+void test_range_scan()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 4] 범위 탐색                 ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  BPlusTree *tree = create_bplus_tree();
+  for (int i = 0; i < 10000; i++)
+  {
+    bplus_insert(tree, i * 3);
+  }
+
+  int out[5000];
+  int count = bplus_range(tree, 100, 3000, out, 5000);
+  bool correct = count == 967 && out[0] == 102;
+  for (int i = 1; i < count && correct; i++)
+  {
+    correct = out[i] == out[i - 1] + 3;
+  }
+  check(correct, "[100, 3000]: 102부터 3씩 증가하는 키 967개 (여러 리프에 걸침)");
+
+  count = bplus_range(tree, 29990, INT_MAX, out, 5000);
+  check(count == 3 && out[2] == 29997, "마지막 리프까지 스캔 후 종료");
+  check(bplus_range(tree, 0, 29997, out, 10) == 10 && out[9] == 27, "max_out개에서 멈춤");
+  check(bplus_range(tree, 200, 100, out, 5000) == 0, "lo > hi 이면 0개");
+  check(bplus_range(tree, 1, 2, out, 5000) == 0, "범위 안에 키가 없으면 0개");
+
+  free_bplus_tree(tree);
+  printf("\n");
+}
+
+/**
+ * 테스트 5: 벌크 로딩
+ */
+void test_bulk_load()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 5] 벌크 로딩                 ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  int n = 300000;
+  int *keys = (int *)malloc(n * sizeof(int));
+  for (int i = 0; i < n; i++)
+  {
+    keys[i] = i * 5 - 1000;
+  }
+
+  // 리프/내부 노드 경계 크기들
+  int sizes[] = {0, 1, BPT_MAX_KEYS, BPT_MAX_KEYS + 1,
+                 (BPT_MAX_KEYS + 1) * BPT_MAX_KEYS + 1, n};
+  bool valid = true;
+  for (int s = 0; s < 6 && valid; s++)
+  {
+    if (sizes[s] > n)
+    {
+      continue;
+    }
+
+    BPlusTree *tree = bplus_bulk_load(keys, sizes[s]);
+    valid = tree != NULL && tree->size == sizes[s] && is_valid_bplus(tree);
+    for (int i = 0; i < sizes[s] && valid; i += 97)
+    {
+      valid = bplus_search(tree, keys[i]) && !bplus_search(tree, keys[i] + 1);
+    }
+    free_bplus_tree(tree);
+  }
+  check(valid, "경계 크기(0, 1, MAX, MAX+1, ...)와 30만 개 모두 불변식 유지");
+
+  BPlusTree *tree = bplus_bulk_load(keys, n);
+  printf("키 %d개 벌크 로딩, 높이: %d\n", n, tree->height);
+
+  // 벌크 로딩한 트리(리프가 가득 참)에 삽입/삭제
+  for (int i = 0; i < 5000; i++)
+  {
+    bplus_insert(tree, keys[i] + 1);
+    bplus_delete(tree, keys[n - 1 - i]);
+  }
+  check(is_valid_bplus(tree) && tree->size == n && bplus_search(tree, keys[0] + 1) &&
+            !bplus_search(tree, keys[n - 1]),
+        "벌크 로딩 후 삽입/삭제");
+  free_bplus_tree(tree);
+
+  keys[10] = keys[9];
+  check(bplus_bulk_load(keys, n) == NULL, "정렬되지 않은(중복) 입력은 NULL");
+  free(keys);
+  printf("\n");
+}
+
+/**
+ * 테스트 6: 랜덤 삽입/삭제 혼합 (빌리기, 합치기, 루트 축소)
+ */
+void test_random_operations()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 6] 랜덤 삽입/삭제             ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  enum
+  {
+    RANGE = 20000,
+    OPERATIONS = 200000
+  };
+  static bool present[RANGE];
+  BPlusTree *tree = create_bplus_tree();
+  bool consistent = true;
+  int max_height = 0;
+
+  for (int op = 0; op < OPERATIONS && consistent; op++)
+  {
+    unsigned int r = next_random();
+    int key = (int)(r % RANGE);
+
+    // 앞 절반은 삽입 위주, 뒤 절반은 삭제 위주
+    bool insert = (r >> 20) % 4 < (op < OPERATIONS / 2 ? 3u : 1u);
+    bool changed = insert ? bplus_insert(tree, key) : bplus_delete(tree, key);
+    consistent = changed == (insert ? !present[key] : present[key]);
+    present[key] = insert;
+    consistent = consistent && bplus_search(tree, key) == present[key];
+
+    if (tree->height > max_height)
+    {
+      max_height = tree->height;
+    }
+    if (op % 5000 == 0)
+    {
+      consistent = consistent && is_valid_bplus(tree);
+    }
+  }
+  check(consistent && is_valid_bplus(tree), "연산 20만 회 동안 탐색 결과와 불변식 일치");
+
+  for (int key = 0; key < RANGE; key++)
+  {
+    bplus_delete(tree, key);
+  }
+  printf("최대 높이: %d\n", max_height);
+  check(tree->root == NULL && tree->size == 0 && tree->height == 0, "모두 삭제하면 빈 트리");
+
+  free_bplus_tree(tree);
+  printf("\n");
+}
+
+int main()
+{
+  printf("╔═══════════════════════════════════════════════╗\n");
+  printf("║           B+ Tree (B+ 트리) 테스트              ║\n");
+  printf("║                                               ║\n");
+  printf("║  시간 복잡도: 삽입/탐색/삭제 O(log_B n)            ║\n");
+  printf("║  범위 탐색: O(log_B n + k)                       ║\n");
+  printf("╚═══════════════════════════════════════════════╝\n\n");
+
+  test_lower_bound();
+  test_small_tree();
+  test_sorted_insertion();
+  test_range_scan();
+  test_bulk_load();
+  test_random_operations();
+
+  if (failures > 0)
+  {
+    printf("✗ 실패한 검사: %d개\n", failures);
+    return 1;
+  }
+
+  printf("✓ 모든 테스트가 완료되었습니다.\n");
+  return 0;
+}
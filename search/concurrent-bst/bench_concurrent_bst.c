@@ -0,0 +1,168 @@
+#include "concurrent_bst.h"
+#include "avl_tree.h"
+#include <time.h>
+
+/*
+ * 벤치마크: 읽기 스레드 N개 + 쓰기 스레드 1개
+ * 1. pthread_rwlock으로 보호한 AVL 트리 (avl-tree 모듈)
+ * 2. 경로 복사 + 에포크 회수 (concurrent_bst)
+ * 읽기 스레드는 각자 LOOKUPS회 탐색하고, 그동안 쓰기 스레드는 삽입/삭제를 계속한다.
+ */
+
+#define KEYS 1000000
+#define LOOKUPS 1000000
+
+typedef struct BenchContext
+{
+  bool use_rcu;
+  ConcurrentBST *tree;     /* use_rcu */
+  Node *avl;               /* !use_rcu */
+  pthread_rwlock_t lock;
+  atomic_bool readers_done;
+  atomic_long writes;
+  atomic_uint next_seed;   /* 읽기 스레드마다 다른 시드 */
+} BenchContext;
+
+static double now_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int next_random(unsigned int *seed)
+{
+  *seed = *seed * 1103515245u + 12345u;
+  return *seed >> 8;
+}
+
+static void *reader_thread(void *arg)
+{
+  BenchContext *ctx = (BenchContext *)arg;
+  unsigned int seed = atomic_fetch_add(&ctx->next_seed, 1);
+  long found = 0;
+
+  if (ctx->use_rcu)
+  {
+    int reader = cbst_register_reader(ctx->tree);
+    for (int i = 0; i < LOOKUPS; i++)
+    {
+      found += cbst_contains(ctx->tree, reader, (int)(next_random(&seed) % KEYS) * 2);
+    }
+    cbst_unregister_reader(ctx->tree, reader);
+  }
+  else
+  {
+    for (int i = 0; i < LOOKUPS; i++)
+    {
+      int key = (int)(next_random(&seed) % KEYS) * 2;
+      pthread_rwlock_rdlock(&ctx->lock);
+      found += search_node(ctx->avl, key) != NULL;
+      pthread_rwlock_unlock(&ctx->lock);
+    }
+  }
+
+  return (void *)(intptr_t)(found == LOOKUPS ? 0 : 1); // 누락이 있으면 NULL이 아닌 값
+}
+
+/* 홀수 키를 넣었다 뺐다 반복 (짝수 키는 그대로라 탐색은 항상 성공) */
+static void *writer_thread(void *arg)
+{
+  BenchContext *ctx = (BenchContext *)arg;
+  unsigned int seed = 4242;
+  long writes = 0;
+
+  while (!atomic_load(&ctx->readers_done))
+  {
+    int key = (int)(next_random(&seed) % KEYS) * 2 + 1;
+    if (ctx->use_rcu)
+    {
+      if (!cbst_insert(ctx->tree, key))
+      {
+        cbst_delete(ctx->tree, key);
+      }
+    }
+    else
+    {
+      pthread_rwlock_wrlock(&ctx->lock);
+      if (search_node(ctx->avl, key) == NULL)
+      {
+        ctx->avl = insert_node(ctx->avl, key);
+      }
+      else
+      {
+        ctx->avl = delete_node(ctx->avl, key);
+      }
+      pthread_rwlock_unlock(&ctx->lock);
+    }
+    writes++;
+  }
+
+  atomic_store(&ctx->writes, writes);
+  return NULL;
+}
+
+static void run(BenchContext *ctx, int readers)
+{
+  pthread_t threads[16];
+  pthread_t writer;
+  atomic_store(&ctx->readers_done, false);
+
+  double start = now_seconds();
+  pthread_create(&writer, NULL, writer_thread, ctx);
+  for (int i = 0; i < readers; i++)
+  {
+    pthread_create(&threads[i], NULL, reader_thread, ctx);
+  }
+
+  bool missing = false;
+  for (int i = 0; i < readers; i++)
+  {
+    void *result;
+    pthread_join(threads[i], &result);
+    missing = missing || result != NULL;
+  }
+  double elapsed = now_seconds() - start;
+  atomic_store(&ctx->readers_done, true);
+  pthread_join(writer, NULL);
+
+  printf("  %-12s 읽기 스레드 %2d  탐색 %7.2f M/s  쓰기 %8.0f /s%s\n",
+         ctx->use_rcu ? "경로 복사" : "rwlock+AVL", readers,
+         (double)readers * LOOKUPS / elapsed / 1e6, atomic_load(&ctx->writes) / elapsed,
+         missing ? "  [탐색 누락]" : "");
+}
+
+int main()
+{
+  printf("=== 동시성 BST 벤치마크 (짝수 키 %d개, 스레드당 탐색 %d회) ===\n", KEYS, LOOKUPS);
+
+  BenchContext ctx;
+  atomic_init(&ctx.next_seed, 1);
+  atomic_init(&ctx.readers_done, false);
+  atomic_init(&ctx.writes, 0);
+  pthread_rwlock_init(&ctx.lock, NULL);
+  ctx.avl = NULL;
+  ctx.tree = create_concurrent_bst();
+  for (int i = 0; i < KEYS; i++)
+  {
+    ctx.avl = insert_node(ctx.avl, i * 2);
+    cbst_insert(ctx.tree, i * 2);
+  }
+
+  int counts[] = {1, 2, 4, 8};
+  for (int i = 0; i < 4; i++)
+  {
+    ctx.use_rcu = false;
+    run(&ctx, counts[i]);
+    ctx.use_rcu = true;
+    run(&ctx, counts[i]);
+  }
+
+  cbst_reclaim(ctx.tree);
+  printf("\n회수된 옛 노드: %zu개, 대기 중: %zu개\n", ctx.tree->reclaimed, ctx.tree->pending);
+
+  free_tree(ctx.avl);
+  free_concurrent_bst(ctx.tree);
+  pthread_rwlock_destroy(&ctx.lock);
+  return 0;
+}
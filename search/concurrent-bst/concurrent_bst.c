@@ -0,0 +1,563 @@
+#include "concurrent_bst.h"
+
+/* ---------- 노드 관리 (writer 전용) ---------- */
+
+static int node_height(const CNode *node)
+{
+  return node == NULL ? 0 : node->height;
+}
+
+static void update_height(CNode *node)
+{
+  int lh = node_height(node->left);
+  int rh = node_height(node->right);
+  node->height = (lh > rh ? lh : rh) + 1;
+}
+
+static int balance_factor(const CNode *node)
+{
+  return node_height(node->left) - node_height(node->right);
+}
+
+/**
+ * 쓰기 한 번에 필요한 노드와 회수 묶음을 미리 확보
+ * @param needed: 필요한 예비 노드 수
+ * @return: 할당 실패 시 false (트리는 바뀌지 않음)
+ *
+ * 경로 복사 도중에 할당이 실패하면 반쯤 만든 버전을 되돌리기 어렵다.
+ * 그래서 최대 필요량을 먼저 확보해 두고, 연산 중에는 실패하지 않게 한다.
+ */
+static bool reserve(ConcurrentBST *tree, size_t needed)
+{
+  if (tree->spare_batch == NULL)
+  {
+    tree->spare_batch = (RetiredBatch *)malloc(sizeof(RetiredBatch));
+    if (tree->spare_batch == NULL)
+    {
+      return false;
+    }
+  }
+
+  while (tree->spare_count < needed)
+  {
+    CNode *node = (CNode *)malloc(sizeof(CNode));
+    if (node == NULL)
+    {
+      return false;
+    }
+    node->link = tree->spare;
+    tree->spare = node;
+    tree->spare_count++;
+  }
+  return true;
+}
+
+/* 예비 노드로 새 노드 생성 (이번 연산 번호가 찍힘) */
+static CNode *take_node(ConcurrentBST *tree, int data, const CNode *left, const CNode *right)
+{
+  CNode *node = tree->spare;
+  tree->spare = node->link;
+  tree->spare_count--;
+
+  node->data = data;
+  node->left = left;
+  node->right = right;
+  node->version = tree->write_version;
+  node->link = NULL;
+  update_height(node);
+  return node;
+}
+
+/*
+ * 새 버전에서 빠지는 공개된 노드를 회수 대기 목록에 추가
+ * 읽기 스레드는 link를 읽지 않으므로 공개된 노드의 link를 써도 된다.
+ */
+static void retire(ConcurrentBST *tree, const CNode *node)
+{
+  CNode *old = (CNode *)node;
+  old->link = tree->replaced;
+  tree->replaced = old;
+  tree->replaced_count++;
+}
+
+/**
+ * 수정 가능한 노드 얻기
+ * 이번 연산에서 만든 노드면 그대로, 공개된 노드면 복사본을 만들고 원본은 회수 대기
+ */
+static CNode *writable(ConcurrentBST *tree, const CNode *node)
+{
+  if (node->version == tree->write_version)
+  {
+    return (CNode *)node;
+  }
+  CNode *copy = take_node(tree, node->data, node->left, node->right);
+  retire(tree, node);
+  return copy;
+}
+
+/* ---------- 경로 복사 AVL ---------- */
+
+/**
+ * 오른쪽 회전 (y는 수정 가능한 노드)
+ *
+ *       y            x
+ *      / \          / \
+ *     x   C  -->   A   y
+ *    / \              / \
+ *   A   B            B   C
+ *
+ * x도 바뀌므로 공개된 노드라면 복사한다.
+ */
+static CNode *rotate_right(ConcurrentBST *tree, CNode *y)
+{
+  CNode *x = writable(tree, y->left);
+  y->left = x->right;
+  x->right = y;
+  update_height(y);
+  update_height(x);
+  return x;
+}
+
+/* 왼쪽 회전 (rotate_right의 대칭) */
+static CNode *rotate_left(ConcurrentBST *tree, CNode *x)
+{
+  CNode *y = writable(tree, x->right);
+  x->right = y->left;
+  y->left = x;
+  update_height(x);
+  update_height(y);
+  return y;
+}
+
+/* 높이를 갱신하고 균형 인수가 ±2가 되었으면 회전으로 복구 */
+static CNode *rebalance(ConcurrentBST *tree, CNode *node)
+{
+  update_height(node);
+  int balance = balance_factor(node);
+
+  if (balance > 1)
+  {
+    if (balance_factor(node->left) < 0)
+    {
+      node->left = rotate_left(tree, writable(tree, node->left));
+    }
+    return rotate_right(tree, node);
+  }
+  if (balance < -1)
+  {
+    if (balance_factor(node->right) > 0)
+    {
+      node->right = rotate_right(tree, writable(tree, node->right));
+    }
+    return rotate_left(tree, node);
+  }
+  return node;
+}
+
+/*
+ * 삽입 경로 복사 (재귀 깊이 = AVL 높이 = O(log n))
+ * 키가 이미 있으면 *inserted = false, 원래 서브트리를 그대로 반환
+ */
+static const CNode *insert_path(ConcurrentBST *tree, const CNode *node, int key, bool *inserted)
+{
+  if (node == NULL)
+  {
+    *inserted = true;
+    return take_node(tree, key, NULL, NULL);
+  }
+  if (key == node->data)
+  {
+    return node;
+  }
+
+  const CNode *child = insert_path(tree, key < node->data ? node->left : node->right, key, inserted);
+  if (!*inserted)
+  {
+    return node;
+  }
+
+  CNode *copy = writable(tree, node);
+  if (key < copy->data)
+  {
+    copy->left = child;
+  }
+  else
+  {
+    copy->right = child;
+  }
+  return rebalance(tree, copy);
+}
+
+/* 서브트리의 최솟값 노드를 빼고 그 키를 *min_key에 저장 */
+static const CNode *delete_min(ConcurrentBST *tree, const CNode *node, int *min_key)
+{
+  if (node->left == NULL)
+  {
+    *min_key = node->data;
+    retire(tree, node);
+    return node->right;
+  }
+
+  const CNode *left = delete_min(tree, node->left, min_key);
+  CNode *copy = writable(tree, node);
+  copy->left = left;
+  return rebalance(tree, copy);
+}
+
+/* 삭제 경로 복사, 키가 없으면 *deleted = false */
+static const CNode *delete_path(ConcurrentBST *tree, const CNode *node, int key, bool *deleted)
+{
+  if (node == NULL)
+  {
+    return NULL;
+  }
+
+  if (key != node->data)
+  {
+    const CNode *child = delete_path(tree, key < node->data ? node->left : node->right, key, deleted);
+    if (!*deleted)
+    {
+      return node;
+    }
+
+    CNode *copy = writable(tree, node);
+    if (key < copy->data)
+    {
+      copy->left = child;
+    }
+    else
+    {
+      copy->right = child;
+    }
+    return rebalance(tree, copy);
+  }
+
+  *deleted = true;
+
+  // 케이스 1, 2: 자식이 없거나 하나만 있는 경우
+  if (node->left == NULL || node->right == NULL)
+  {
+    retire(tree, node);
+    return node->left != NULL ? node->left : node->right;
+  }
+
+  // 케이스 3: 오른쪽 서브트리의 최솟값으로 대체 (공개된 노드의 data는 바꾸지 않고 복사본에 씀)
+  int successor;
+  const CNode *right = delete_min(tree, node->right, &successor);
+  CNode *copy = writable(tree, node);
+  copy->data = successor;
+  copy->right = right;
+  return rebalance(tree, copy);
+}
+
+/* ---------- 에포크 기반 회수 ---------- */
+
+/*
+ * 읽는 중인 스레드 중 가장 오래된 진입 에포크 (없으면 UINT64_MAX)
+ *
+ * 읽기: 슬롯에 에포크 기록 -> 루트 읽기
+ * 쓰기: 루트 교체 -> 슬롯 검사
+ * 모두 seq_cst라서, 옛 루트를 읽은 스레드의 슬롯 기록은 쓰기 쪽 검사에서 반드시 보인다.
+ * 그 스레드의 에포크는 옛 노드를 회수 대기에 넣을 때의 에포크 이하이므로 해제되지 않는다.
+ */
+static uint64_t oldest_active_epoch(ConcurrentBST *tree)
+{
+  uint64_t oldest = UINT64_MAX;
+  for (int i = 0; i < CBST_MAX_READERS; i++)
+  {
+    uint64_t epoch = atomic_load(&tree->readers[i].epoch);
+    if (epoch != 0 && epoch < oldest)
+    {
+      oldest = epoch;
+    }
+  }
+  return oldest;
+}
+
+/* 모든 읽기 스레드가 지나간 묶음 해제 (writer_lock을 잡은 상태에서 호출) */
+static size_t reclaim_locked(ConcurrentBST *tree)
+{
+  uint64_t oldest = oldest_active_epoch(tree);
+  size_t freed = 0;
+
+  while (tree->oldest != NULL && tree->oldest->epoch < oldest)
+  {
+    RetiredBatch *batch = tree->oldest;
+    CNode *node = batch->nodes;
+    while (node != NULL)
+    {
+      CNode *next = node->link;
+      free(node);
+      node = next;
+    }
+    freed += batch->count;
+
+    tree->oldest = batch->next;
+    if (tree->oldest == NULL)
+    {
+      tree->newest = NULL;
+    }
+    free(batch);
+  }
+
+  tree->pending -= freed;
+  tree->reclaimed += freed;
+  return freed;
+}
+
+/* 새 루트 공개 -> 교체된 노드를 현재 에포크로 묶음 -> 에포크 증가 -> 회수 시도 */
+static void publish(ConcurrentBST *tree, const CNode *root)
+{
+  atomic_store(&tree->root, root);
+
+  if (tree->replaced != NULL)
+  {
+    RetiredBatch *batch = tree->spare_batch;
+    tree->spare_batch = NULL;
+    batch->epoch = atomic_load(&tree->global_epoch);
+    batch->nodes = tree->replaced;
+    batch->count = tree->replaced_count;
+    batch->next = NULL;
+
+    if (tree->newest == NULL)
+    {
+      tree->oldest = batch;
+    }
+    else
+    {
+      tree->newest->next = batch;
+    }
+    tree->newest = batch;
+    tree->pending += tree->replaced_count;
+  }
+  tree->replaced = NULL;
+  tree->replaced_count = 0;
+
+  atomic_fetch_add(&tree->global_epoch, 1);
+  reclaim_locked(tree);
+}
+
+/* 연산 시작: 예비 노드 확보 후 새 연산 번호 부여 */
+static bool begin_write(ConcurrentBST *tree, const CNode *root)
+{
+  // 경로 복사 h개 + 새 리프 1개 + 경로마다 회전용 복사 최대 2개
+  size_t needed = 3 * (size_t)node_height(root) + 4;
+  if (!reserve(tree, needed))
+  {
+    return false;
+  }
+  tree->write_version++;
+  return true;
+}
+
+/* ---------- 공개 API ---------- */
+
+/**
+ * 빈 동시성 BST 생성
+ * @return: 트리 (할당 실패 시 NULL)
+ */
+ConcurrentBST *create_concurrent_bst(void)
+{
+  ConcurrentBST *tree = (ConcurrentBST *)calloc(1, sizeof(ConcurrentBST));
+  if (tree == NULL)
+  {
+    return NULL;
+  }
+
+  atomic_init(&tree->root, NULL);
+  atomic_init(&tree->global_epoch, 1);
+  for (int i = 0; i < CBST_MAX_READERS; i++)
+  {
+    atomic_init(&tree->readers[i].epoch, 0);
+    atomic_init(&tree->readers[i].in_use, false);
+  }
+  if (pthread_mutex_init(&tree->writer_lock, NULL) != 0)
+  {
+    free(tree);
+    return NULL;
+  }
+  return tree;
+}
+
+/* 후위 순회로 서브트리 해제 (높이 O(log n)) */
+static void free_nodes(const CNode *node)
+{
+  if (node != NULL)
+  {
+    free_nodes(node->left);
+    free_nodes(node->right);
+    free((CNode *)node);
+  }
+}
+
+/**
+ * 트리 전체 해제 (현재 트리, 회수 대기 노드, 예비 노드)
+ * 읽는 중인 스레드가 없어야 한다.
+ */
+void free_concurrent_bst(ConcurrentBST *tree)
+{
+  if (tree == NULL)
+  {
+    return;
+  }
+
+  free_nodes(atomic_load(&tree->root));
+
+  while (tree->oldest != NULL)
+  {
+    RetiredBatch *batch = tree->oldest;
+    tree->oldest = batch->next;
+    CNode *node = batch->nodes;
+    while (node != NULL)
+    {
+      CNode *next = node->link;
+      free(node);
+      node = next;
+    }
+    free(batch);
+  }
+
+  while (tree->spare != NULL)
+  {
+    CNode *next = tree->spare->link;
+    free(tree->spare);
+    tree->spare = next;
+  }
+  free(tree->spare_batch);
+
+  pthread_mutex_destroy(&tree->writer_lock);
+  free(tree);
+}
+
+/**
+ * 읽기 스레드 등록
+ * @return: 슬롯 번호 (CBST_MAX_READERS개가 모두 쓰이고 있으면 -1)
+ */
+int cbst_register_reader(ConcurrentBST *tree)
+{
+  for (int i = 0; i < CBST_MAX_READERS; i++)
+  {
+    bool expected = false;
+    if (atomic_compare_exchange_strong(&tree->readers[i].in_use, &expected, true))
+    {
+      atomic_store(&tree->readers[i].epoch, 0);
+      return i;
+    }
+  }
+  return -1;
+}
+
+/* 읽기 스레드 등록 해제 (읽기 구간 밖에서 호출) */
+void cbst_unregister_reader(ConcurrentBST *tree, int reader)
+{
+  atomic_store(&tree->readers[reader].epoch, 0);
+  atomic_store(&tree->readers[reader].in_use, false);
+}
+
+/**
+ * 읽기 구간 시작: 현재 에포크를 알린 뒤 루트 스냅샷을 얻음
+ * @return: 스냅샷 루트 (cbst_read_end 전까지 해제되지 않음)
+ */
+const CNode *cbst_read_begin(ConcurrentBST *tree, int reader)
+{
+  atomic_store(&tree->readers[reader].epoch, atomic_load(&tree->global_epoch));
+  return atomic_load(&tree->root);
+}
+
+/* 읽기 구간 끝: 이후 writer가 이 스레드를 기다리지 않음 */
+void cbst_read_end(ConcurrentBST *tree, int reader)
+{
+  atomic_store_explicit(&tree->readers[reader].epoch, 0, memory_order_release);
+}
+
+/**
+ * 스냅샷에서 키 탐색 (반복, 락 없음)
+ * 시간 복잡도: O(log n)
+ */
+const CNode *cbst_find(const CNode *root, int key)
+{
+  while (root != NULL && root->data != key)
+  {
+    root = key < root->data ? root->left : root->right;
+  }
+  return root;
+}
+
+/* 스냅샷 높이 (빈 트리 = 0) */
+int cbst_height(const CNode *root)
+{
+  return node_height(root);
+}
+
+/* 읽기 구간을 열고 닫으며 키 존재 여부 확인 */
+bool cbst_contains(ConcurrentBST *tree, int reader, int key)
+{
+  const CNode *root = cbst_read_begin(tree, reader);
+  bool found = cbst_find(root, key) != NULL;
+  cbst_read_end(tree, reader);
+  return found;
+}
+
+/**
+ * 키 삽입
+ * 루트에서 삽입 위치까지의 경로(와 회전에 쓰인 노드)만 복사해 새 버전을 공개한다.
+ * 시간 복잡도: O(log n), 새 노드 O(log n)개
+ * @return: 삽입했으면 true (중복 키 또는 할당 실패 시 false)
+ */
+bool cbst_insert(ConcurrentBST *tree, int key)
+{
+  pthread_mutex_lock(&tree->writer_lock);
+
+  const CNode *root = atomic_load(&tree->root);
+  bool inserted = false;
+  if (begin_write(tree, root))
+  {
+    const CNode *new_root = insert_path(tree, root, key, &inserted);
+    if (inserted)
+    {
+      tree->count++;
+      publish(tree, new_root);
+    }
+  }
+
+  pthread_mutex_unlock(&tree->writer_lock);
+  return inserted;
+}
+
+/**
+ * 키 삭제 (경로 복사, cbst_insert와 같은 방식)
+ * @return: 삭제했으면 true (없는 키 또는 할당 실패 시 false)
+ */
+bool cbst_delete(ConcurrentBST *tree, int key)
+{
+  pthread_mutex_lock(&tree->writer_lock);
+
+  const CNode *root = atomic_load(&tree->root);
+  bool deleted = false;
+  if (begin_write(tree, root))
+  {
+    const CNode *new_root = delete_path(tree, root, key, &deleted);
+    if (deleted)
+    {
+      tree->count--;
+      publish(tree, new_root);
+    }
+  }
+
+  pthread_mutex_unlock(&tree->writer_lock);
+  return deleted;
+}
+
+/**
+ * 회수 가능한 옛 노드 해제
+ * 쓰기마다 자동으로 시도하지만, 쓰기가 멈춘 뒤 읽기 스레드가 빠져나가면
+ * 남은 노드는 이 함수를 불러야 해제된다.
+ * @return: 해제한 노드 수
+ */
+size_t cbst_reclaim(ConcurrentBST *tree)
+{
+  pthread_mutex_lock(&tree->writer_lock);
+  size_t freed = reclaim_locked(tree);
+  pthread_mutex_unlock(&tree->writer_lock);
+  return freed;
+}
@@ -0,0 +1,108 @@
+#ifndef CONCURRENT_BST_H
+#define CONCURRENT_BST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+/*
+ * 읽기 최적화 동시성 BST (경로 복사 AVL + RCU 방식 스냅샷)
+ *
+ * - 공개된 노드는 절대 수정하지 않는다 (불변).
+ *   쓰기는 루트에서 바뀐 위치까지의 경로만 복사해 새 버전을 만들고,
+ *   새 루트를 원자적으로 교체(publish)한다.
+ * - 읽기 스레드는 락 없이 루트 스냅샷을 얻어 끝까지 탐색한다.
+ *   탐색 도중 쓰기가 일어나도 스냅샷은 그대로다.
+ * - 교체된 옛 노드는 바로 해제하지 않고 에포크 기반으로 회수한다.
+ *   옛 루트를 보고 있을 수 있는 읽기 스레드가 모두 빠져나간 뒤에 해제한다.
+ *
+ * 쓰기는 내부 뮤텍스로 직렬화된다 (단일 writer 가정, 여러 writer도 안전).
+ */
+
+/* 등록 가능한 읽기 스레드 수 */
+#define CBST_MAX_READERS 64
+
+/* 트리 노드 (공개된 뒤에는 data/height/left/right 불변) */
+typedef struct CNode
+{
+  int data;
+  int height;                /* 서브트리 높이 (리프 = 1) */
+  const struct CNode *left;
+  const struct CNode *right;
+  uint64_t version;          /* 이 노드를 만든 쓰기 연산 번호 (writer 전용) */
+  struct CNode *link;        /* 예비 노드 / 회수 대기 목록 연결 (writer 전용) */
+} CNode;
+
+/* 읽기 스레드 슬롯 (거짓 공유를 피하려고 캐시 라인 하나씩 차지) */
+typedef struct ReaderSlot
+{
+  _Atomic uint64_t epoch; /* 읽는 중이면 진입 시점의 전역 에포크, 아니면 0 */
+  atomic_bool in_use;     /* 등록 여부 */
+  char padding[64 - sizeof(uint64_t) - sizeof(atomic_bool)];
+} ReaderSlot;
+
+/* 같은 에포크에 교체된 노드 묶음 */
+typedef struct RetiredBatch
+{
+  uint64_t epoch;             /* 교체 시점의 전역 에포크 */
+  CNode *nodes;               /* link로 연결된 옛 노드들 */
+  size_t count;
+  struct RetiredBatch *next;
+} RetiredBatch;
+
+/* 동시성 BST */
+typedef struct ConcurrentBST
+{
+  _Atomic(const CNode *) root;    /* 현재 공개된 루트 */
+  _Atomic uint64_t global_epoch;  /* 1부터 시작, 쓰기마다 증가 */
+  ReaderSlot readers[CBST_MAX_READERS];
+
+  /* 이하 writer 전용 (writer_lock으로 보호) */
+  pthread_mutex_t writer_lock;
+  uint64_t write_version;         /* 진행 중인 쓰기 연산 번호 */
+  CNode *spare;                   /* 미리 할당해 둔 노드 (link로 연결) */
+  size_t spare_count;
+  RetiredBatch *spare_batch;      /* 다음 쓰기에서 쓸 회수 묶음 */
+  CNode *replaced;                /* 이번 연산에서 교체된 옛 노드 */
+  size_t replaced_count;
+  RetiredBatch *oldest;           /* 회수 대기 묶음 (오래된 순) */
+  RetiredBatch *newest;
+  size_t pending;                 /* 회수 대기 중인 노드 수 */
+  size_t reclaimed;               /* 지금까지 해제한 노드 수 */
+  int count;                      /* 키 개수 */
+} ConcurrentBST;
+
+/* 생성 / 해제 (해제 시점에는 읽는 중인 스레드가 없어야 함) */
+ConcurrentBST *create_concurrent_bst(void);
+void free_concurrent_bst(ConcurrentBST *tree);
+
+/* 읽기 스레드 등록 (슬롯 번호, 가득 차면 -1) / 해제 */
+int cbst_register_reader(ConcurrentBST *tree);
+void cbst_unregister_reader(ConcurrentBST *tree, int reader);
+
+/*
+ * 읽기 구간
+ * cbst_read_begin이 돌려준 스냅샷은 cbst_read_end 전까지 유효하다.
+ * 한 슬롯에서 구간을 중첩하면 안 된다.
+ */
+const CNode *cbst_read_begin(ConcurrentBST *tree, int reader);
+void cbst_read_end(ConcurrentBST *tree, int reader);
+
+/* 스냅샷 안에서의 탐색 (락 없음) */
+const CNode *cbst_find(const CNode *root, int key);
+int cbst_height(const CNode *root);
+
+/* 읽기 구간 + 탐색을 한 번에 */
+bool cbst_contains(ConcurrentBST *tree, int reader, int key);
+
+/* 쓰기 (성공 시 새 루트 공개, 중복 삽입/없는 키 삭제/할당 실패 시 false) */
+bool cbst_insert(ConcurrentBST *tree, int key);
+bool cbst_delete(ConcurrentBST *tree, int key);
+
+/* 회수 가능한 옛 노드 해제, 해제한 노드 수 반환 */
+size_t cbst_reclaim(ConcurrentBST *tree);
+
+#endif // CONCURRENT_BST_H
@@ -0,0 +1,316 @@
+#include "concurrent_bst.h"
+#include <limits.h>
+#include <string.h>
+
+static int failures = 0;
+
+/* 조건 확인 헬퍼: ✓/✗ 출력 후 실패 횟수 누적 */
+static void check(bool condition, const char *message)
+{
+  printf("%s %s\n", condition ? "✓" : "✗", message);
+  if (!condition)
+  {
+    failures++;
+  }
+}
+
+/**
+ * 스냅샷의 AVL 불변식 검사 (BST 순서, 저장된 높이, 균형 인수)
+ * @param count: 노드 수를 누적할 변수
+ * @return: 서브트리 높이, 불변식이 깨졌으면 -1
+ */
+static int verify_avl(const CNode *root, long lo, long hi, int *count)
+{
+  if (root == NULL)
+  {
+    return 0;
+  }
+  if (root->data <= lo || root->data >= hi)
+  {
+    return -1;
+  }
+
+  int lh = verify_avl(root->left, lo, root->data, count);
+  int rh = verify_avl(root->right, root->data, hi, count);
+  if (lh < 0 || rh < 0 || lh - rh > 1 || rh - lh > 1)
+  {
+    return -1;
+  }
+
+  (*count)++;
+  int height = (lh > rh ? lh : rh) + 1;
+  return root->height == height ? height : -1;
+}
+
+/* 유효한 AVL이면 노드 수, 아니면 -1 */
+static int valid_size(const CNode *root)
+{
+  int count = 0;
+  return verify_avl(root, (long)INT_MIN - 1, (long)INT_MAX + 1, &count) >= 0 ? count : -1;
+}
+
+/* 결정적인 랜덤 키 (LCG) */
+static unsigned int next_random(unsigned int *seed)
+{
+  *seed = *seed * 1103515245u + 12345u;
+  return *seed >> 8;
+}
+
+/**
+ * 테스트 1: 단일 스레드 삽입/삭제를 참조 집합과 비교
+ */
+void test_single_thread()
+{
+  printf("\n[테스트 1] 단일 스레드 삽입/삭제\n");
+
+  ConcurrentBST *tree = create_concurrent_bst();
+  int reader = cbst_register_reader(tree);
+  check(tree != NULL && reader >= 0, "트리 생성, 읽기 스레드 등록");
+  check(!cbst_contains(tree, reader, 5) && !cbst_delete(tree, 5), "빈 트리 탐색/삭제");
+
+  bool present[2000] = {false};
+  int expected = 0;
+  bool agree = true;
+  unsigned int seed = 7;
+  for (int i = 0; i < 20000; i++)
+  {
+    int key = (int)(next_random(&seed) % 2000);
+    if (next_random(&seed) % 3 != 0)
+    {
+      agree = agree && cbst_insert(tree, key) == !present[key];
+      expected += !present[key];
+      present[key] = true;
+    }
+    else
+    {
+      agree = agree && cbst_delete(tree, key) == present[key];
+      expected -= present[key];
+      present[key] = false;
+    }
+  }
+  check(agree, "삽입/삭제 반환값이 참조 집합과 일치 (연산 2만 회)");
+
+  const CNode *root = cbst_read_begin(tree, reader);
+  bool found = true;
+  for (int key = 0; key < 2000; key++)
+  {
+    found = found && (cbst_find(root, key) != NULL) == present[key];
+  }
+  check(valid_size(root) == expected && tree->count == expected, "AVL 불변식 유지, 노드 수 일치");
+  check(found, "모든 키의 존재 여부가 참조 집합과 일치");
+  cbst_read_end(tree, reader);
+
+  // 읽는 스레드가 없으면 쓰기마다 옛 노드가 바로 회수됨
+  check(tree->pending == 0 && tree->reclaimed > 0, "읽기 구간 밖에서는 옛 노드가 즉시 회수됨");
+
+  free_concurrent_bst(tree);
+}
+
+/**
+ * 테스트 2: 스냅샷 격리 - 읽는 동안 쓰기가 일어나도 스냅샷은 그대로
+ */
+void test_snapshot_isolation()
+{
+  printf("\n[테스트 2] 스냅샷 격리와 지연 회수\n");
+
+  ConcurrentBST *tree = create_concurrent_bst();
+  int reader = cbst_register_reader(tree);
+  for (int i = 0; i < 1000; i++)
+  {
+    cbst_insert(tree, i);
+  }
+
+  const CNode *snapshot = cbst_read_begin(tree, reader);
+
+  for (int i = 0; i < 1000; i += 2)
+  {
+    cbst_delete(tree, i);
+  }
+  for (int i = 1000; i < 2000; i++)
+  {
+    cbst_insert(tree, i);
+  }
+
+  bool intact = valid_size(snapshot) == 1000;
+  for (int i = 0; i < 1000 && intact; i++)
+  {
+    intact = cbst_find(snapshot, i) != NULL;
+  }
+  intact = intact && cbst_find(snapshot, 1500) == NULL;
+  check(intact, "옛 스냅샷은 여전히 0..999 전체 (짝수 삭제, 1000..1999 삽입 이후)");
+
+  size_t pending = tree->pending;
+  check(pending > 0 && cbst_reclaim(tree) == 0, "읽는 중에는 옛 노드를 해제하지 않음");
+
+  cbst_read_end(tree, reader);
+  check(cbst_reclaim(tree) == pending && tree->pending == 0, "읽기가 끝나면 대기 노드 전부 회수");
+
+  const CNode *current = cbst_read_begin(tree, reader);
+  check(valid_size(current) == 1500 && cbst_find(current, 0) == NULL && cbst_find(current, 1999) != NULL,
+        "새 스냅샷에는 쓰기가 모두 반영됨 (1500개)");
+  cbst_read_end(tree, reader);
+
+  free_concurrent_bst(tree);
+}
+
+/**
+ * 테스트 3: 경로 복사 - 삽입 한 번에 바뀌는 노드는 O(log n)개
+ */
+void test_path_copying()
+{
+  printf("\n[테스트 3] 경로 복사\n");
+
+  ConcurrentBST *tree = create_concurrent_bst();
+  int reader = cbst_register_reader(tree);
+  for (int i = 0; i < 1023; i++)
+  {
+    cbst_insert(tree, i * 2);
+  }
+
+  const CNode *before = cbst_read_begin(tree, reader);
+  int height = cbst_height(before);
+  cbst_insert(tree, 1);
+  size_t replaced = tree->pending;
+  const CNode *after = atomic_load(&tree->root);
+
+  char message[128];
+  snprintf(message, sizeof(message), "1023개 트리(높이 %d)에 삽입 1회: 교체된 노드 %zu개", height,
+           replaced);
+  check(replaced > 0 && replaced <= (size_t)height + 2, message);
+  check(after != before && after->right == before->right, "새 루트가 바뀌지 않은 오른쪽 서브트리를 공유");
+
+  cbst_read_end(tree, reader);
+  cbst_reclaim(tree);
+  free_concurrent_bst(tree);
+}
+
+/**
+ * 테스트 4: 읽기 스레드 슬롯 등록/해제
+ */
+void test_reader_slots()
+{
+  printf("\n[테스트 4] 읽기 스레드 슬롯\n");
+
+  ConcurrentBST *tree = create_concurrent_bst();
+  bool distinct = true;
+  for (int i = 0; i < CBST_MAX_READERS; i++)
+  {
+    distinct = distinct && cbst_register_reader(tree) == i;
+  }
+  check(distinct && cbst_register_reader(tree) == -1, "슬롯 64개 모두 등록 후에는 -1");
+
+  cbst_unregister_reader(tree, 17);
+  check(cbst_register_reader(tree) == 17, "해제한 슬롯 재사용");
+
+  free_concurrent_bst(tree);
+}
+
+/* ---------- 테스트 5: 여러 읽기 스레드 + 쓰기 스레드 ---------- */
+
+#define STRESS_READERS 3
+#define STABLE_KEYS 2000
+
+typedef struct StressContext
+{
+  ConcurrentBST *tree;
+  atomic_bool done;
+  atomic_int errors;
+  atomic_long snapshots;
+} StressContext;
+
+/*
+ * 짝수 키는 처음부터 끝까지 있고, 쓰기 스레드는 홀수 키만 넣고 뺀다.
+ * 어느 스냅샷이든 유효한 AVL이고 짝수 키를 모두 가져야 한다.
+ */
+static void *stress_reader(void *arg)
+{
+  StressContext *ctx = (StressContext *)arg;
+  int reader = cbst_register_reader(ctx->tree);
+  unsigned int seed = (unsigned int)reader + 1;
+
+  while (!atomic_load(&ctx->done))
+  {
+    const CNode *root = cbst_read_begin(ctx->tree, reader);
+    bool ok = valid_size(root) >= STABLE_KEYS;
+    for (int i = 0; i < 200 && ok; i++)
+    {
+      ok = cbst_find(root, (int)(next_random(&seed) % STABLE_KEYS) * 2) != NULL;
+    }
+    cbst_read_end(ctx->tree, reader);
+
+    if (!ok)
+    {
+      atomic_fetch_add(&ctx->errors, 1);
+    }
+    atomic_fetch_add(&ctx->snapshots, 1);
+  }
+
+  cbst_unregister_reader(ctx->tree, reader);
+  return NULL;
+}
+
+void test_concurrent_readers()
+{
+  printf("\n[테스트 5] 읽기 스레드 %d개 + 쓰기 스레드\n", STRESS_READERS);
+
+  StressContext ctx;
+  ctx.tree = create_concurrent_bst();
+  atomic_init(&ctx.done, false);
+  atomic_init(&ctx.errors, 0);
+  atomic_init(&ctx.snapshots, 0);
+
+  for (int i = 0; i < STABLE_KEYS; i++)
+  {
+    cbst_insert(ctx.tree, i * 2);
+  }
+
+  pthread_t threads[STRESS_READERS];
+  for (int i = 0; i < STRESS_READERS; i++)
+  {
+    pthread_create(&threads[i], NULL, stress_reader, &ctx);
+  }
+
+  // 쓰기: 홀수 키를 무작위로 넣고 빼기
+  unsigned int seed = 99;
+  int writes = 0;
+  for (int i = 0; i < 30000; i++)
+  {
+    int key = (int)(next_random(&seed) % STABLE_KEYS) * 2 + 1;
+    writes += next_random(&seed) % 2 == 0 ? cbst_insert(ctx.tree, key) : cbst_delete(ctx.tree, key);
+  }
+  atomic_store(&ctx.done, true);
+
+  for (int i = 0; i < STRESS_READERS; i++)
+  {
+    pthread_join(threads[i], NULL);
+  }
+
+  char message[128];
+  snprintf(message, sizeof(message), "스냅샷 %ld개 검사, 모두 유효한 AVL + 짝수 키 전부 존재",
+           atomic_load(&ctx.snapshots));
+  check(atomic_load(&ctx.errors) == 0, message);
+
+  cbst_reclaim(ctx.tree);
+  int reader = cbst_register_reader(ctx.tree);
+  const CNode *root = cbst_read_begin(ctx.tree, reader);
+  check(valid_size(root) == ctx.tree->count, "쓰기 후 최종 트리 유효, 노드 수 일치");
+  cbst_read_end(ctx.tree, reader);
+  snprintf(message, sizeof(message), "쓰기 %d회 성공, 읽기 종료 후 회수 대기 노드 0개", writes);
+  check(ctx.tree->pending == 0, message);
+
+  free_concurrent_bst(ctx.tree);
+}
+
+int main()
+{
+  printf("=== 동시성 BST (경로 복사 AVL + 에포크 회수) 테스트 ===\n");
+
+  test_single_thread();
+  test_snapshot_isolation();
+  test_path_copying();
+  test_reader_slots();
+  test_concurrent_readers();
+
+  printf("\n%s\n", failures == 0 ? "✓ 모든 테스트 통과" : "✗ 실패한 테스트가 있습니다");
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,145 @@
+#include "eytzinger.h"
+#include "bst.h"
+#include <time.h>
+
+/*
+ * 벤치마크: 읽기 전용 키 집합 탐색
+ * BST(search_node) vs 정렬 배열 이진 탐색 vs Eytzinger 단건 / 배치
+ */
+
+#define QUERIES 4000000
+
+static double now_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int seed = 77;
+
+static unsigned int next_random(void)
+{
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 1;
+}
+
+/* 정렬 배열 이진 탐색 (분기 있는 일반 구현) */
+static bool binary_search(const int *sorted, int n, int key)
+{
+  int lo = 0, hi = n - 1;
+  while (lo <= hi)
+  {
+    int mid = lo + (hi - lo) / 2;
+    if (sorted[mid] == key)
+    {
+      return true;
+    }
+    if (sorted[mid] < key)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid - 1;
+    }
+  }
+  return false;
+}
+
+static void report(const char *name, double seconds, long found)
+{
+  printf("  %-22s %7.1f ns/쿼리  (찾음 %ld)\n", name, seconds * 1e9 / QUERIES, found);
+}
+
+static void run(int n)
+{
+  // 짝수 키만 저장, 쿼리는 0..2n 범위라 절반은 실패
+  int *sorted = (int *)malloc(n * sizeof(int));
+  for (int i = 0; i < n; i++)
+  {
+    sorted[i] = i * 2;
+  }
+  int *queries = (int *)malloc(QUERIES * sizeof(int));
+  for (int i = 0; i < QUERIES; i++)
+  {
+    queries[i] = (int)(next_random() % (unsigned int)(2 * n));
+  }
+
+  printf("키 %d개, 랜덤 쿼리 %d개\n", n, QUERIES);
+
+  // BST: 랜덤 순서로 삽입해서 높이를 O(log n)으로
+  int *order = (int *)malloc(n * sizeof(int));
+  for (int i = 0; i < n; i++)
+  {
+    order[i] = sorted[i];
+  }
+  for (int i = n - 1; i > 0; i--)
+  {
+    int j = (int)(next_random() % (unsigned int)(i + 1));
+    int temp = order[i];
+    order[i] = order[j];
+    order[j] = temp;
+  }
+  Node *root = NULL;
+  for (int i = 0; i < n; i++)
+  {
+    root = insert_node(root, order[i]);
+  }
+  free(order);
+
+  double t0 = now_seconds();
+  long found = 0;
+  for (int i = 0; i < QUERIES; i++)
+  {
+    found += search_node(root, queries[i]) != NULL;
+  }
+  report("BST search_node", now_seconds() - t0, found);
+  free_tree(root);
+
+  t0 = now_seconds();
+  found = 0;
+  for (int i = 0; i < QUERIES; i++)
+  {
+    found += binary_search(sorted, n, queries[i]);
+  }
+  report("정렬 배열 이진 탐색", now_seconds() - t0, found);
+
+  t0 = now_seconds();
+  EytzingerIndex *index = build_eytzinger_index(sorted, n);
+  double build_time = now_seconds() - t0;
+
+  t0 = now_seconds();
+  found = 0;
+  for (int i = 0; i < QUERIES; i++)
+  {
+    found += eytzinger_contains(index, queries[i]);
+  }
+  report("Eytzinger 단건", now_seconds() - t0, found);
+
+  int *positions = (int *)malloc(QUERIES * sizeof(int));
+  t0 = now_seconds();
+  eytzinger_search_batch(index, queries, QUERIES, positions);
+  found = 0;
+  for (int i = 0; i < QUERIES; i++)
+  {
+    found += positions[i] != 0 && index->keys[positions[i]] == queries[i];
+  }
+  report("Eytzinger 배치", now_seconds() - t0, found);
+  printf("  (인덱스 생성 %.3f 초)\n\n", build_time);
+
+  free(positions);
+  free_eytzinger_index(index);
+  free(queries);
+  free(sorted);
+}
+
+int main()
+{
+  printf("=== 정적 탐색 인덱스 벤치마크 ===\n\n");
+
+  run(1000000);
+  run(10000000);
+
+  return 0;
+}
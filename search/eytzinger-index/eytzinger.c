@@ -0,0 +1,187 @@
+#include "eytzinger.h"
+#include <string.h>
+
+/* 캐시 라인 하나에 들어가는 키 개수 (64바이트 / 4바이트) */
+#define KEYS_PER_LINE 16
+
+static int compare_int(const void *a, const void *b)
+{
+  int x = *(const int *)a;
+  int y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+/* 중위 순회 순서로 정렬된 키를 채움 (재귀 깊이 = log n) */
+static int fill(int *layout, int n, const int *sorted, int next, int k)
+{
+  if (k <= n)
+  {
+    next = fill(layout, n, sorted, next, 2 * k);
+    layout[k] = sorted[next++];
+    next = fill(layout, n, sorted, next, 2 * k + 1);
+  }
+  return next;
+}
+
+/**
+ * 인덱스 생성
+ *
+ * 1. 입력이 정렬되어 있지 않으면 복사본을 qsort (O(n log n))
+ * 2. 중복 제거
+ * 3. 중위 순회 위치에 정렬된 키를 차례로 배치 (O(n))
+ */
+EytzingerIndex *build_eytzinger_index(const int *keys, int n)
+{
+  if (n < 0 || (n > 0 && keys == NULL))
+  {
+    return NULL;
+  }
+
+  EytzingerIndex *index = (EytzingerIndex *)malloc(sizeof(EytzingerIndex));
+  int *sorted = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+  if (index == NULL || sorted == NULL)
+  {
+    free(index);
+    free(sorted);
+    return NULL;
+  }
+
+  bool is_sorted = true;
+  for (int i = 1; i < n && is_sorted; i++)
+  {
+    is_sorted = keys[i - 1] <= keys[i];
+  }
+  // n == 0이면 keys가 NULL일 수 있으므로 복사와 정렬을 건너뜀
+  if (n > 0)
+  {
+    memcpy(sorted, keys, (size_t)n * sizeof(int));
+    if (!is_sorted)
+    {
+      qsort(sorted, n, sizeof(int), compare_int);
+    }
+  }
+
+  int unique = 0;
+  for (int i = 0; i < n; i++)
+  {
+    if (unique == 0 || sorted[unique - 1] != sorted[i])
+    {
+      sorted[unique++] = sorted[i];
+    }
+  }
+
+  // 캐시 라인 단위로 할당해서 keys[1..16]이 같은 라인 두 개 안에 들어가게 함
+  size_t bytes = (size_t)(unique + 1) * sizeof(int);
+  bytes = (bytes + 63) / 64 * 64;
+  void *memory = NULL;
+  if (posix_memalign(&memory, 64, bytes) != 0)
+  {
+    free(index);
+    free(sorted);
+    return NULL;
+  }
+
+  index->keys = (int *)memory;
+  index->size = unique;
+  memset(index->keys, 0, bytes);
+  fill(index->keys, unique, sorted, 0, 1);
+
+  free(sorted);
+  return index;
+}
+
+/**
+ * 인덱스 해제
+ */
+void free_eytzinger_index(EytzingerIndex *index)
+{
+  if (index == NULL)
+  {
+    return;
+  }
+  free(index->keys);
+  free(index);
+}
+
+/**
+ * 분기 없는 하강
+ *
+ * k = 2k + (keys[k] < key) 로 내려가며 비교 결과를 비트로 쌓는다.
+ * 마지막으로 오른쪽으로 간 뒤의 왼쪽 이동들(끝의 1 비트들 + 한 칸)을
+ * 지우면 key 이상인 첫 키의 위치가 된다.
+ *
+ * 4레벨 아래 노드들(16개 = 캐시 라인 하나)을 미리 읽어 두므로
+ * 메모리 지연이 비교 4번에 걸쳐 가려진다.
+ * (마지막 레벨 근처에서는 배열 밖 주소를 미리 읽지만 prefetch는 무시될 뿐 오류가 나지 않는다.)
+ */
+int eytzinger_search(const EytzingerIndex *index, int key)
+{
+  const int *keys = index->keys;
+  int n = index->size;
+  unsigned int k = 1;
+
+  while (k <= (unsigned int)n)
+  {
+    __builtin_prefetch(keys + (size_t)k * KEYS_PER_LINE);
+    k = 2 * k + (keys[k] < key);
+  }
+
+  return (int)(k >> __builtin_ffs(~k));
+}
+
+/**
+ * 키 존재 여부
+ */
+bool eytzinger_contains(const EytzingerIndex *index, int key)
+{
+  int position = eytzinger_search(index, key);
+  return position != 0 && index->keys[position] == key;
+}
+
+/**
+ * 배치 탐색
+ *
+ * 완전한 레벨 수(floor(log2(n + 1)))만큼은 모든 쿼리가 반드시 내려가므로
+ * EYTZINGER_BATCH개 쿼리를 한 레벨씩 번갈아 진행한다.
+ * 서로 독립인 메모리 접근이 동시에 여러 개 진행되어 대기 시간이 겹친다.
+ * 마지막(일부만 찬) 레벨은 쿼리마다 한 번 더 확인한다.
+ */
+void eytzinger_search_batch(const EytzingerIndex *index, const int *queries, int count,
+                            int *positions)
+{
+  const int *keys = index->keys;
+  unsigned int n = (unsigned int)index->size;
+  int full_levels = 0;
+  while ((2u << full_levels) - 1 <= n)
+  {
+    full_levels++;
+  }
+
+  for (int base = 0; base < count; base += EYTZINGER_BATCH)
+  {
+    int batch = count - base < EYTZINGER_BATCH ? count - base : EYTZINGER_BATCH;
+    unsigned int k[EYTZINGER_BATCH];
+    for (int i = 0; i < batch; i++)
+    {
+      k[i] = 1;
+    }
+
+    for (int level = 0; level < full_levels; level++)
+    {
+      for (int i = 0; i < batch; i++)
+      {
+        __builtin_prefetch(keys + (size_t)k[i] * KEYS_PER_LINE);
+        k[i] = 2 * k[i] + (keys[k[i]] < queries[base + i]);
+      }
+    }
+
+    for (int i = 0; i < batch; i++)
+    {
+      if (k[i] <= n)
+      {
+        k[i] = 2 * k[i] + (keys[k[i]] < queries[base + i]);
+      }
+      positions[base + i] = (int)(k[i] >> __builtin_ffs(~k[i]));
+    }
+  }
+}
@@ -0,0 +1,57 @@
+#ifndef EYTZINGER_H
+#define EYTZINGER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+/* 한 번에 함께 내려가는 배치 탐색 쿼리 수 */
+#define EYTZINGER_BATCH 16
+
+/*
+ * Eytzinger(BFS) 배치 정적 탐색 인덱스
+ *
+ * 정렬된 키를 완전 이진 트리의 BFS 순서로 배열에 저장한다.
+ * 노드 k의 자식은 2k, 2k + 1 이므로 포인터가 필요 없고,
+ * 위쪽 레벨들이 배열 앞부분에 모여 있어 캐시에 잘 남는다.
+ *
+ *   정렬: 1 2 3 4 5 6 7   ->   keys[1..7] = 4 2 6 1 3 5 7
+ *
+ *            4 (k=1)
+ *          /   \
+ *        2       6
+ *       / \     / \
+ *      1   3   5   7
+ */
+typedef struct EytzingerIndex
+{
+  int *keys; /* keys[1..size] 사용 (keys[0]은 비움), 64바이트 정렬 */
+  int size;  /* 키 개수 (중복 제거 후) */
+} EytzingerIndex;
+
+/*
+ * 인덱스 생성
+ * @param keys: 키 배열 (정렬되어 있지 않으면 복사본을 정렬, 중복은 하나로)
+ * @param n: 키 개수
+ * @return: 생성된 인덱스 (실패 시 NULL)
+ */
+EytzingerIndex *build_eytzinger_index(const int *keys, int n);
+void free_eytzinger_index(EytzingerIndex *index);
+
+/*
+ * key 이상인 첫 키의 위치 (keys[] 인덱스, 1..size)
+ * 모든 키가 key보다 작으면 0
+ */
+int eytzinger_search(const EytzingerIndex *index, int key);
+
+/* key가 있으면 true */
+bool eytzinger_contains(const EytzingerIndex *index, int key);
+
+/*
+ * 배치 탐색: queries[i]에 대한 eytzinger_search 결과를 positions[i]에 저장
+ * EYTZINGER_BATCH개 쿼리가 한 레벨씩 함께 내려가므로 캐시 미스가 겹친다.
+ */
+void eytzinger_search_batch(const EytzingerIndex *index, const int *queries, int count,
+                            int *positions);
+
+#endif // EYTZINGER_H
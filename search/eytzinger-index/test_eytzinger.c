@@ -0,0 +1,197 @@
+#include "eytzinger.h"
+#include <limits.h>
+
+static int failures = 0;
+
+/* 조건 확인 헬퍼: ✓/✗ 출력 후 실패 횟수 누적 */
+static void check(bool condition, const char *message)
+{
+  printf("%s %s\n", condition ? "✓" : "✗", message);
+  if (!condition)
+  {
+    failures++;
+  }
+}
+
+/* 정렬 배열에서 key 이상인 첫 위치 (기준값) */
+static int lower_bound(const int *sorted, int n, int key)
+{
+  int lo = 0, hi = n;
+  while (lo < hi)
+  {
+    int mid = lo + (hi - lo) / 2;
+    if (sorted[mid] < key)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+/**
+ * 테스트 1: BFS 배치 확인
+ */
+void test_layout()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 1] Eytzinger 배치            ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  int keys[] = {1, 2, 3, 4, 5, 6, 7};
+  EytzingerIndex *index = build_eytzinger_index(keys, 7);
+  int expected[] = {4, 2, 6, 1, 3, 5, 7};
+
+  bool same = index->size == 7;
+  printf("keys[1..7]: ");
+  for (int k = 1; k <= 7; k++)
+  {
+    printf("%d ", index->keys[k]);
+    same = same && index->keys[k] == expected[k - 1];
+  }
+  printf("\n");
+  check(same, "정렬된 1..7 → 4 2 6 1 3 5 7");
+  check(((size_t)index->keys % 64) == 0, "배열이 캐시 라인(64바이트)에 정렬");
+
+  free_eytzinger_index(index);
+  printf("\n");
+}
+
+/**
+ * 테스트 2: 모든 크기에서 lower bound가 정렬 배열과 일치
+ */
+void test_search_all_sizes()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 2] 크기 0~300 전수 검사       ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  int sorted[300] = {0};
+  bool correct = true;
+
+  for (int n = 0; n <= 300 && correct; n++)
+  {
+    for (int i = 0; i < n; i++)
+    {
+      sorted[i] = i * 2 + 1; // 홀수만: 짝수 쿼리는 항상 실패
+    }
+    EytzingerIndex *index = build_eytzinger_index(sorted, n);
+
+    for (int q = -1; q <= 2 * n + 1 && correct; q++)
+    {
+      int rank = lower_bound(sorted, n, q);
+      int position = eytzinger_search(index, q);
+      // 위치 → 키로 비교 (없으면 0)
+      correct = rank == n ? position == 0 : (position != 0 && index->keys[position] == sorted[rank]);
+      correct = correct && eytzinger_contains(index, q) == (q % 2 != 0 && q > 0 && q < 2 * n);
+    }
+    free_eytzinger_index(index);
+  }
+
+  check(correct, "존재/부재 키 모두 정렬 배열의 lower bound와 일치");
+  printf("\n");
+}
+
+/**
+ * 테스트 3: 배치 탐색 = 단건 탐색
+ */
+void test_batch()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 3] 배치 탐색                 ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  int sizes[] = {0, 1, 2, 15, 16, 17, 1000, 65535, 65536, 100000};
+  unsigned int seed = 17;
+  bool same = true;
+
+  for (int s = 0; s < 10 && same; s++)
+  {
+    int n = sizes[s];
+    int *keys = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    for (int i = 0; i < n; i++)
+    {
+      keys[i] = i * 3;
+    }
+    EytzingerIndex *index = build_eytzinger_index(keys, n);
+
+    int count = 1003; // EYTZINGER_BATCH의 배수가 아닌 개수
+    int queries[1003];
+    int positions[1003];
+    for (int i = 0; i < count; i++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      queries[i] = (int)((seed >> 8) % (unsigned int)(3 * n + 10)) - 5;
+    }
+    queries[0] = INT_MIN;
+    queries[1] = INT_MAX;
+
+    eytzinger_search_batch(index, queries, count, positions);
+    for (int i = 0; i < count && same; i++)
+    {
+      same = positions[i] == eytzinger_search(index, queries[i]);
+    }
+
+    free_eytzinger_index(index);
+    free(keys);
+  }
+
+  check(same, "크기 10종, 쿼리 1003개(배치 단위로 나누어떨어지지 않음)에서 단건 결과와 일치");
+  printf("\n");
+}
+
+/**
+ * 테스트 4: 정렬되지 않은 입력, 중복, 극단값
+ */
+void test_unsorted_and_duplicates()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 4] 비정렬/중복/극단값          ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  int keys[] = {50, 30, INT_MAX, 70, 30, INT_MIN, 50, 0};
+  EytzingerIndex *index = build_eytzinger_index(keys, 8);
+
+  check(index->size == 6, "중복 제거 후 키 6개");
+  check(eytzinger_contains(index, INT_MIN) && eytzinger_contains(index, INT_MAX) &&
+            eytzinger_contains(index, 0) && eytzinger_contains(index, 70),
+        "INT_MIN, INT_MAX, 0, 70 있음");
+  check(!eytzinger_contains(index, 40) && !eytzinger_contains(index, INT_MAX - 1),
+        "40, INT_MAX - 1 없음");
+  check(index->keys[eytzinger_search(index, 31)] == 50, "31 이상인 첫 키는 50");
+  free_eytzinger_index(index);
+
+  EytzingerIndex *empty = build_eytzinger_index(NULL, 0);
+  check(empty != NULL && eytzinger_search(empty, 5) == 0 && !eytzinger_contains(empty, 5),
+        "빈 인덱스");
+  free_eytzinger_index(empty);
+  check(build_eytzinger_index(NULL, 3) == NULL, "키 배열 없이 n > 0이면 NULL");
+  printf("\n");
+}
+
+int main()
+{
+  printf("╔═══════════════════════════════════════════════╗\n");
+  printf("║      Eytzinger Index (BFS 배치 정적 인덱스) 테스트  ║\n");
+  printf("║                                               ║\n");
+  printf("║  생성: O(n log n) (정렬된 입력은 O(n))             ║\n");
+  printf("║  탐색: O(log n), 포인터 없음                      ║\n");
+  printf("╚═══════════════════════════════════════════════╝\n\n");
+
+  test_layout();
+  test_search_all_sizes();
+  test_batch();
+  test_unsorted_and_duplicates();
+
+  if (failures > 0)
+  {
+    printf("✗ 실패한 검사: %d개\n", failures);
+    return 1;
+  }
+
+  printf("✓ 모든 테스트가 완료되었습니다.\n");
+  return 0;
+}
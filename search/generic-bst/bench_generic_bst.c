@@ -0,0 +1,186 @@
+#include "bst_maps.h"
+#include "bst.h"
+#include <string.h>
+#include <time.h>
+
+/*
+ * 벤치마크: 같은 int 키 작업을 세 가지 구현으로 측정
+ * 1. int      - binary-search-tree (int 전용)
+ * 2. generic  - BST_DEFINE(int_map, int, int, ...) 인스턴스
+ * 3. callback - void * 키 + 비교 함수 포인터 (아래 비교용 구현)
+ * 힙 배치 영향을 없애려고 구현마다 프로세스를 따로 띄운다: ./bench_generic_bst int|generic|callback
+ */
+
+/* ---------- 비교용: void * + 콜백 BST ---------- */
+
+typedef int (*CompareFunc)(const void *, const void *);
+
+typedef struct VoidNode
+{
+  const void *key; /* 호출자 소유 */
+  void *value;
+  struct VoidNode *left;
+  struct VoidNode *right;
+} VoidNode;
+
+static int compare_int(const void *a, const void *b)
+{
+  int x = *(const int *)a;
+  int y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+static bool void_insert(VoidNode **root, const void *key, void *value, CompareFunc compare)
+{
+  VoidNode **link = root;
+  while (*link != NULL)
+  {
+    int cmp = compare(key, (*link)->key);
+    if (cmp == 0)
+    {
+      (*link)->value = value;
+      return true;
+    }
+    link = cmp < 0 ? &(*link)->left : &(*link)->right;
+  }
+  VoidNode *node = (VoidNode *)malloc(sizeof(VoidNode));
+  node->key = key;
+  node->value = value;
+  node->left = NULL;
+  node->right = NULL;
+  *link = node;
+  return true;
+}
+
+static void *void_find(VoidNode *node, const void *key, CompareFunc compare)
+{
+  while (node != NULL)
+  {
+    int cmp = compare(key, node->key);
+    if (cmp == 0)
+    {
+      return node;
+    }
+    node = cmp < 0 ? node->left : node->right;
+  }
+  return NULL;
+}
+
+static void void_free(VoidNode *root)
+{
+  while (root != NULL)
+  {
+    if (root->left != NULL)
+    {
+      VoidNode *left = root->left;
+      root->left = left->right;
+      left->right = root;
+      root = left;
+    }
+    else
+    {
+      VoidNode *right = root->right;
+      free(root);
+      root = right;
+    }
+  }
+}
+
+/* ---------- 측정 ---------- */
+
+static double now_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* 0..n-1을 섞은 배열 (Fisher-Yates) */
+static int *shuffled_keys(int n, unsigned int seed)
+{
+  int *keys = (int *)malloc(n * sizeof(int));
+  for (int i = 0; i < n; i++)
+  {
+    keys[i] = i;
+  }
+  for (int i = n - 1; i > 0; i--)
+  {
+    seed = seed * 1103515245u + 12345u;
+    int j = (int)((seed >> 8) % (unsigned int)(i + 1));
+    int temp = keys[i];
+    keys[i] = keys[j];
+    keys[j] = temp;
+  }
+  return keys;
+}
+
+int main(int argc, char *argv[])
+{
+  const char *mode = argc > 1 ? argv[1] : "generic";
+  int n = 1000000;
+  int *order = shuffled_keys(n, 1);
+  int *lookups = shuffled_keys(n, 2);
+  long found = 0;
+  double t0, t1, t2, t3;
+
+  if (strcmp(mode, "int") == 0)
+  {
+    t0 = now_seconds();
+    Node *root = NULL;
+    for (int i = 0; i < n; i++)
+    {
+      root = insert_node(root, order[i]);
+    }
+    t1 = now_seconds();
+    for (int i = 0; i < n; i++)
+    {
+      found += search_node(root, lookups[i]) != NULL;
+    }
+    t2 = now_seconds();
+    free_tree(root);
+    t3 = now_seconds();
+  }
+  else if (strcmp(mode, "callback") == 0)
+  {
+    t0 = now_seconds();
+    VoidNode *root = NULL;
+    for (int i = 0; i < n; i++)
+    {
+      void_insert(&root, &order[i], NULL, compare_int);
+    }
+    t1 = now_seconds();
+    for (int i = 0; i < n; i++)
+    {
+      found += void_find(root, &lookups[i], compare_int) != NULL;
+    }
+    t2 = now_seconds();
+    void_free(root);
+    t3 = now_seconds();
+  }
+  else
+  {
+    mode = "generic";
+    t0 = now_seconds();
+    int_map tree;
+    int_map_init(&tree);
+    for (int i = 0; i < n; i++)
+    {
+      int_map_insert(&tree, order[i], i);
+    }
+    t1 = now_seconds();
+    for (int i = 0; i < n; i++)
+    {
+      found += int_map_find(&tree, lookups[i]) != NULL;
+    }
+    t2 = now_seconds();
+    int_map_clear(&tree);
+    t3 = now_seconds();
+  }
+
+  printf("  %-8s 키 %d개  삽입 %7.3f  탐색 %7.3f  해제 %7.3f  (초)%s\n", mode, n, t1 - t0,
+         t2 - t1, t3 - t2, found == n ? "" : "  [탐색 누락]");
+
+  free(order);
+  free(lookups);
+  return 0;
+}
@@ -0,0 +1,6 @@
+#include "bst_maps.h"
+#include <string.h>
+
+BST_DEFINE(int_map, int, int, BST_COMPARE_NUMBER)
+BST_DEFINE(i64_map, int64_t, double, BST_COMPARE_NUMBER)
+BST_DEFINE(string_map, const char *, int, BST_COMPARE_STRING)
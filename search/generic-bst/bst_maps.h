@@ -0,0 +1,17 @@
+#ifndef BST_MAPS_H
+#define BST_MAPS_H
+
+#include <stdint.h>
+#include "generic_bst.h"
+
+/*
+ * 자주 쓰는 타입 조합 (정의는 bst_maps.c)
+ * int_map:    int -> int      (binary-search-tree와 같은 키, 값 추가)
+ * i64_map:    int64_t -> double
+ * string_map: const char * -> int (문자열은 호출자가 관리)
+ */
+BST_DECLARE(int_map, int, int)
+BST_DECLARE(i64_map, int64_t, double)
+BST_DECLARE(string_map, const char *, int)
+
+#endif // BST_MAPS_H
@@ -0,0 +1,225 @@
+#include "bst_maps.h"
+#include <string.h>
+
+static int failures = 0;
+
+/* 조건 확인 헬퍼: ✓/✗ 출력 후 실패 횟수 누적 */
+static void check(bool condition, const char *message)
+{
+  printf("%s %s\n", condition ? "✓" : "✗", message);
+  if (!condition)
+  {
+    failures++;
+  }
+}
+
+/* 테스트 안에서 직접 만드는 인스턴스: 구조체 키 (x, y 사전순) */
+typedef struct Point
+{
+  int x;
+  int y;
+} Point;
+
+#define POINT_COMPARE(a, b) \
+  ((a).x != (b).x ? BST_COMPARE_NUMBER((a).x, (b).x) : BST_COMPARE_NUMBER((a).y, (b).y))
+
+BST_DECLARE(point_map, Point, const char *)
+BST_DEFINE(point_map, Point, const char *, POINT_COMPARE)
+
+/**
+ * 테스트 1: int -> int, 참조 배열과 비교
+ */
+void test_int_map()
+{
+  printf("\n[테스트 1] int -> int\n");
+
+  int_map tree;
+  int_map_init(&tree);
+  check(int_map_find(&tree, 1) == NULL && !int_map_remove(&tree, 1, NULL) &&
+            int_map_min(&tree) == NULL,
+        "빈 트리 탐색/삭제/최솟값");
+
+  int reference[1000];
+  bool present[1000] = {false};
+  unsigned int seed = 11;
+  bool agree = true;
+  for (int i = 0; i < 20000; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    int key = (int)((seed >> 8) % 1000);
+    if ((seed >> 20) % 3 != 0)
+    {
+      agree = agree && int_map_insert(&tree, key, i);
+      reference[key] = i;
+      present[key] = true;
+    }
+    else
+    {
+      int value = -1;
+      bool removed = int_map_remove(&tree, key, &value);
+      agree = agree && removed == present[key] && (!removed || value == reference[key]);
+      present[key] = false;
+    }
+  }
+
+  size_t expected = 0;
+  for (int key = 0; key < 1000; key++)
+  {
+    int *value = int_map_find(&tree, key);
+    agree = agree && (value != NULL) == present[key] && (value == NULL || *value == reference[key]);
+    expected += present[key];
+  }
+  check(agree && tree.size == expected, "삽입/값 갱신/삭제 2만 회 후 모든 키와 값이 참조와 일치");
+
+  int keys[1000];
+  size_t count = int_map_keys(&tree, keys, 1000);
+  bool sorted = count == expected;
+  for (size_t i = 1; i < count && sorted; i++)
+  {
+    sorted = keys[i - 1] < keys[i];
+  }
+  check(sorted && int_map_min(&tree)->key == keys[0] && int_map_max(&tree)->key == keys[count - 1],
+        "keys는 오름차순, min/max 일치");
+  check(int_map_keys(&tree, keys, 3) == 3 && int_map_keys(&tree, keys, count) == count,
+        "max_out에서 멈추고, 순회 후에도 트리 모양 그대로");
+
+  int_map_clear(&tree);
+  check(tree.root == NULL && tree.size == 0, "clear 후 빈 트리");
+}
+
+/**
+ * 테스트 2: int64_t -> double (32비트를 넘는 키, 음수 키)
+ */
+void test_i64_map()
+{
+  printf("\n[테스트 2] int64_t -> double\n");
+
+  i64_map tree;
+  i64_map_init(&tree);
+  int64_t base = (int64_t)1 << 40;
+  for (int64_t i = -500; i < 500; i++)
+  {
+    i64_map_insert(&tree, base * i, (double)i / 4);
+  }
+
+  bool ok = tree.size == 1000;
+  for (int64_t i = -500; i < 500 && ok; i++)
+  {
+    double *value = i64_map_find(&tree, base * i);
+    ok = value != NULL && *value == (double)i / 4 && i64_map_find(&tree, base * i + 1) == NULL;
+  }
+  check(ok, "2^40 간격 키 1000개 (음수 포함): 값 일치, 사이 값은 없음");
+  check(i64_map_min(&tree)->key == -500 * base && i64_map_max(&tree)->key == 499 * base,
+        "min = -500 * 2^40, max = 499 * 2^40");
+
+  i64_map_clear(&tree);
+}
+
+/**
+ * 테스트 3: 문자열 키
+ */
+void test_string_map()
+{
+  printf("\n[테스트 3] const char * -> int\n");
+
+  const char *words[] = {"pear", "apple", "fig", "banana", "cherry", "grape", "date", "apple"};
+  string_map tree;
+  string_map_init(&tree);
+  for (int i = 0; i < 8; i++)
+  {
+    string_map_insert(&tree, words[i], i);
+  }
+
+  // 다른 주소의 같은 문자열로 탐색 (포인터가 아니라 내용 비교)
+  char lookup[16];
+  strcpy(lookup, "apple");
+  int *apple = string_map_find(&tree, lookup);
+  check(tree.size == 7 && apple != NULL && *apple == 7, "중복 \"apple\"은 값만 갱신 (7개, apple -> 7)");
+
+  const char *keys[8];
+  size_t count = string_map_keys(&tree, keys, 8);
+  const char *expected[] = {"apple", "banana", "cherry", "date", "fig", "grape", "pear"};
+  bool sorted = count == 7;
+  for (size_t i = 0; i < count && sorted; i++)
+  {
+    sorted = strcmp(keys[i], expected[i]) == 0;
+  }
+  check(sorted, "사전순: apple banana cherry date fig grape pear");
+
+  int value;
+  check(string_map_remove(&tree, "pear", &value) && value == 0 && string_map_find(&tree, "pear") == NULL &&
+            !string_map_remove(&tree, "kiwi", NULL),
+        "루트(pear) 삭제, 없는 키 삭제는 false");
+
+  string_map_clear(&tree);
+}
+
+/**
+ * 테스트 4: 구조체 키 + 사용자 비교식
+ */
+void test_struct_key()
+{
+  printf("\n[테스트 4] 구조체 키 (Point -> const char *)\n");
+
+  point_map tree;
+  point_map_init(&tree);
+  point_map_insert(&tree, (Point){1, 2}, "a");
+  point_map_insert(&tree, (Point){0, 9}, "b");
+  point_map_insert(&tree, (Point){1, -1}, "c");
+  point_map_insert(&tree, (Point){2, 0}, "d");
+
+  Point keys[4];
+  point_map_keys(&tree, keys, 4);
+  const char **found = point_map_find(&tree, (Point){1, -1});
+  check(keys[0].x == 0 && keys[1].y == -1 && keys[2].y == 2 && keys[3].x == 2 && found != NULL &&
+            strcmp(*found, "c") == 0,
+        "(x, y) 사전순 정렬: (0,9) (1,-1) (1,2) (2,0)");
+
+  point_map_clear(&tree);
+}
+
+/**
+ * 테스트 5: 정렬된 순서 삽입 (깊이 n 편향 트리)
+ */
+void test_degenerate()
+{
+  printf("\n[테스트 5] 편향 트리\n");
+
+  int n = 10000;
+  int_map tree;
+  int_map_init(&tree);
+  for (int i = 0; i < n; i++)
+  {
+    int_map_insert(&tree, i, -i);
+  }
+
+  int *keys = (int *)malloc(n * sizeof(int));
+  bool ok = int_map_keys(&tree, keys, n) == (size_t)n && keys[n - 1] == n - 1 &&
+            *int_map_find(&tree, n - 1) == -(n - 1);
+  free(keys);
+  check(ok, "깊이 10000 사슬: 재귀 없이 탐색/순회");
+
+  // 루트부터 삭제 (자식 하나인 경우 반복)
+  for (int i = 0; i < n / 2; i++)
+  {
+    int_map_remove(&tree, i, NULL);
+  }
+  check(tree.size == (size_t)n / 2 && tree.root->key == n / 2, "앞쪽 절반 삭제 후 루트 = 5000");
+
+  int_map_clear(&tree);
+  check(tree.size == 0, "깊이 5000 사슬 해제");
+}
+
+int main()
+{
+  printf("=== 제네릭 BST (매크로 생성) 테스트 ===\n");
+
+  test_int_map();
+  test_i64_map();
+  test_string_map();
+  test_struct_key();
+  test_degenerate();
+
+  printf("\n%s\n", failures == 0 ? "✓ 모든 테스트 통과" : "✗ 실패한 테스트가 있습니다");
+  return failures == 0 ? 0 : 1;
+}
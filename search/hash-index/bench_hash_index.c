@@ -0,0 +1,90 @@
+#include "hash_index.h"
+#include "sequential_search.h"
+#include <time.h>
+
+/*
+ * 벤치마크: 반복 조회 (ns/쿼리)
+ * 정렬하지 않은 배열 크기 4KB ~ 16MB, 쿼리 절반은 없는 값
+ * - 순차 탐색 (SIMD): 조회마다 O(n)
+ * - 해시 인덱스: 생성 O(n) 한 번 + 조회 O(1)
+ * 생성 시간을 몇 번의 조회로 회수하는지(손익분기 쿼리 수)도 출력한다.
+ */
+
+#define QUERIES 4000000
+#define LINEAR_BYTES (1L << 30) /* 순차 탐색은 총 읽는 양으로 쿼리 수를 정함 */
+
+static double now_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int seed = 77;
+
+static unsigned int next_random(void)
+{
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 1;
+}
+
+static void run(int size)
+{
+  // 값은 0..2^30 랜덤 (짝수만: 홀수 쿼리는 항상 없음)
+  int *arr = (int *)malloc((size_t)size * sizeof(int));
+  int *queries = (int *)malloc(QUERIES * sizeof(int));
+  for (int i = 0; i < size; i++)
+  {
+    arr[i] = (int)(next_random() & 0x3FFFFFFE);
+  }
+  for (int i = 0; i < QUERIES; i++)
+  {
+    int value = arr[next_random() % (unsigned int)size];
+    queries[i] = (i & 1) ? value + 1 : value;
+  }
+
+  long linear_count = LINEAR_BYTES / ((long)size * sizeof(int));
+  linear_count = linear_count < 16 ? 16 : linear_count > QUERIES ? QUERIES : linear_count;
+  long found = 0;
+  double start = now_seconds();
+  for (long i = 0; i < linear_count; i++)
+  {
+    found += sequential_search(arr, size, queries[i]) >= 0;
+  }
+  double linear_ns = (now_seconds() - start) * 1e9 / linear_count;
+
+  start = now_seconds();
+  HashIndex *index = build_hash_index(arr, size);
+  double build_ms = (now_seconds() - start) * 1e3;
+
+  long hash_found = 0;
+  start = now_seconds();
+  for (int i = 0; i < QUERIES; i++)
+  {
+    hash_found += hash_index_lookup(index, queries[i]) >= 0;
+  }
+  double hash_ns = (now_seconds() - start) * 1e9 / QUERIES;
+
+  double break_even = build_ms * 1e6 / (linear_ns - hash_ns);
+  printf("%9d  %12.1f  %10.1f  %10.2f  %10.0f  %5.1f%%%s\n", size, linear_ns, hash_ns, build_ms, break_even,
+         100.0 * index->count / index->capacity,
+         found * 2 == linear_count && hash_found * 2 == QUERIES ? "" : "  [오류]");
+
+  free_hash_index(index);
+  free(arr);
+  free(queries);
+}
+
+int main()
+{
+  printf("=== 반복 조회: 순차 탐색 vs 해시 인덱스 (쿼리 절반은 없는 값) ===\n");
+  printf("순차 탐색 커널: %s\n\n", search_kernel_name(sequential_search_kernel()));
+  printf("%9s  %12s  %10s  %10s  %10s  %6s\n", "원소 수", "순차 ns", "해시 ns", "생성 ms", "손익분기",
+         "채움률");
+
+  for (int size = 1024; size <= 16 * 1024 * 1024; size *= 8)
+  {
+    run(size);
+  }
+  return 0;
+}
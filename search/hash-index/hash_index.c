@@ -0,0 +1,183 @@
+#include "hash_index.h"
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define CTRL_EMPTY 0x80
+
+/*
+ * 32비트 정수 해시 (MurmurHash3 fmix32)
+ * 연속된 정수도 모든 비트가 고르게 섞이므로 하위 비트는 그룹 번호, 상위 7비트는 h2로 쓴다.
+ */
+static uint32_t hash_int(int key)
+{
+  uint32_t h = (uint32_t)key;
+  h ^= h >> 16;
+  h *= 0x85EBCA6Bu;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35u;
+  h ^= h >> 16;
+  return h;
+}
+
+/*
+ * 그룹 안에서 제어 바이트가 value와 같은 슬롯의 비트 마스크 (비트 i = 슬롯 i)
+ * SSE2가 있으면 16바이트를 한 번에 비교한다.
+ */
+static unsigned int match_byte(const uint8_t *group, uint8_t value)
+{
+#ifdef __SSE2__
+  __m128i ctrl = _mm_load_si128((const __m128i *)group);
+  return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)value)));
+#else
+  unsigned int mask = 0;
+  for (int i = 0; i < HASH_INDEX_GROUP; i++)
+  {
+    mask |= (unsigned int)(group[i] == value) << i;
+  }
+  return mask;
+#endif
+}
+
+/* 빈 슬롯의 마스크 (빈 칸만 최상위 비트가 1) */
+static unsigned int match_empty(const uint8_t *group)
+{
+#ifdef __SSE2__
+  return (unsigned int)_mm_movemask_epi8(_mm_load_si128((const __m128i *)group));
+#else
+  return match_byte(group, CTRL_EMPTY);
+#endif
+}
+
+/**
+ * 인덱스 생성
+ *
+ * 배열을 앞에서부터 넣고, 이미 있는 값은 건너뛴다 (처음 인덱스 유지).
+ * 그룹 탐사 순서: g, g + 1, g + 3, g + 6, ... (삼각수 간격, 그룹 수가 2의 거듭제곱이면
+ * 모든 그룹을 한 번씩 방문한다)
+ */
+HashIndex *build_hash_index(const int *arr, int size)
+{
+  if (size < 0 || (size > 0 && arr == NULL))
+  {
+    return NULL;
+  }
+
+  // 용량: size * 8/7 이상인 2의 거듭제곱 (최소 그룹 하나)
+  long needed = (long)size + size / 7 + 1;
+  long capacity = HASH_INDEX_GROUP;
+  while (capacity < needed)
+  {
+    capacity *= 2;
+  }
+  if (capacity > (1L << 30))
+  {
+    return NULL;
+  }
+
+  HashIndex *index = (HashIndex *)malloc(sizeof(HashIndex));
+  uint8_t *ctrl = NULL;
+  HashSlot *slots = (HashSlot *)malloc((size_t)capacity * sizeof(HashSlot));
+  if (index == NULL || slots == NULL || posix_memalign((void **)&ctrl, HASH_INDEX_GROUP, (size_t)capacity) != 0)
+  {
+    free(index);
+    free(slots);
+    return NULL;
+  }
+  memset(ctrl, CTRL_EMPTY, (size_t)capacity);
+
+  index->ctrl = ctrl;
+  index->slots = slots;
+  index->capacity = (int)capacity;
+  index->count = 0;
+
+  unsigned int group_mask = (unsigned int)(capacity / HASH_INDEX_GROUP) - 1;
+  for (int i = 0; i < size; i++)
+  {
+    int key = arr[i];
+    uint32_t h = hash_int(key);
+    uint8_t h2 = (uint8_t)(h >> 25);
+    unsigned int group = h & group_mask;
+
+    for (unsigned int step = 1;; step++)
+    {
+      const uint8_t *ctrl_group = ctrl + (size_t)group * HASH_INDEX_GROUP;
+      HashSlot *slot_group = slots + (size_t)group * HASH_INDEX_GROUP;
+
+      bool duplicate = false;
+      for (unsigned int match = match_byte(ctrl_group, h2); match != 0 && !duplicate; match &= match - 1)
+      {
+        duplicate = slot_group[__builtin_ctz(match)].key == key;
+      }
+      if (duplicate)
+      {
+        break;
+      }
+
+      unsigned int empty = match_empty(ctrl_group);
+      if (empty != 0)
+      {
+        int offset = __builtin_ctz(empty);
+        ctrl[(size_t)group * HASH_INDEX_GROUP + offset] = h2;
+        slot_group[offset].key = key;
+        slot_group[offset].position = i;
+        index->count++;
+        break;
+      }
+      group = (group + step) & group_mask;
+    }
+  }
+  return index;
+}
+
+void free_hash_index(HashIndex *index)
+{
+  if (index == NULL)
+  {
+    return;
+  }
+  free(index->ctrl);
+  free(index->slots);
+  free(index);
+}
+
+/**
+ * 조회
+ * 1. 해시로 시작 그룹과 h2를 구함
+ * 2. 그룹의 제어 바이트 중 h2와 같은 슬롯만 키 비교
+ * 3. 그룹에 빈 칸이 있으면 없는 값, 아니면 다음 그룹
+ */
+int hash_index_lookup(const HashIndex *index, int target)
+{
+  if (index == NULL)
+  {
+    return -1;
+  }
+
+  uint32_t h = hash_int(target);
+  uint8_t h2 = (uint8_t)(h >> 25);
+  unsigned int group_mask = (unsigned int)(index->capacity / HASH_INDEX_GROUP) - 1;
+  unsigned int group = h & group_mask;
+
+  for (unsigned int step = 1;; step++)
+  {
+    const uint8_t *ctrl_group = index->ctrl + (size_t)group * HASH_INDEX_GROUP;
+    const HashSlot *slot_group = index->slots + (size_t)group * HASH_INDEX_GROUP;
+
+    for (unsigned int match = match_byte(ctrl_group, h2); match != 0; match &= match - 1)
+    {
+      const HashSlot *slot = &slot_group[__builtin_ctz(match)];
+      if (slot->key == target)
+      {
+        return slot->position;
+      }
+    }
+    if (match_empty(ctrl_group) != 0)
+    {
+      return -1;
+    }
+    group = (group + step) & group_mask;
+  }
+}
@@ -0,0 +1,54 @@
+#ifndef HASH_INDEX_H
+#define HASH_INDEX_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * 값 -> 첫 인덱스 해시 인덱스 (Swiss table 방식, 읽기 전용)
+ *
+ * 같은 배열을 여러 번 조회할 때 한 번 O(n)으로 만들어 두고 조회마다 O(1)로 찾는다.
+ * 정렬하지 않은 배열 그대로 만들 수 있고, 결과는 sequential_search와 같다
+ * (값이 처음 나오는 인덱스, 없으면 -1).
+ *
+ * 슬롯 HASH_INDEX_GROUP(16)개를 한 그룹으로 묶고, 슬롯마다 제어 바이트 1개를 둔다.
+ *   제어 바이트: 빈 칸이면 0x80, 차 있으면 해시의 상위 7비트 (h2)
+ * 조회는 그룹의 제어 바이트 16개를 SSE2 비교 한 번으로 h2와 맞춰 보고,
+ * 일치한 슬롯만 키를 비교한다. h2가 우연히 같을 확률은 1/128이라 키 비교는 거의 한 번이다.
+ * 그룹에 빈 칸이 있으면 그 뒤로는 없다는 뜻이므로 멈춘다 (삭제가 없어 묘비가 필요 없음).
+ */
+
+#define HASH_INDEX_GROUP 16
+
+/* 키와 위치를 붙여 두어 한 번에 읽음 */
+typedef struct HashSlot
+{
+  int key;
+  int position; /* 배열에서 key가 처음 나오는 인덱스 */
+} HashSlot;
+
+typedef struct HashIndex
+{
+  uint8_t *ctrl;   /* 제어 바이트 capacity개 (16바이트 정렬) */
+  HashSlot *slots; /* 슬롯 capacity개 */
+  int capacity;    /* 슬롯 수 (16의 배수인 2의 거듭제곱) */
+  int count;       /* 서로 다른 값의 개수 */
+} HashIndex;
+
+/*
+ * 인덱스 생성 (O(n))
+ * 채움률이 7/8을 넘지 않도록 배열 크기 기준으로 용량을 잡는다.
+ * @return: 생성된 인덱스 (메모리 부족이면 NULL)
+ */
+HashIndex *build_hash_index(const int *arr, int size);
+void free_hash_index(HashIndex *index);
+
+/*
+ * target이 처음 나오는 인덱스, 없으면 -1
+ * 평균 O(1): 그룹 하나(제어 바이트 16개 + 슬롯 1개)를 읽는다.
+ */
+int hash_index_lookup(const HashIndex *index, int target);
+
+#endif // HASH_INDEX_H
@@ -0,0 +1,171 @@
+#include "hash_index.h"
+#include <limits.h>
+
+static int failures = 0;
+
+/* 조건 확인 헬퍼: ✓/✗ 출력 후 실패 횟수 누적 */
+static void check(bool condition, const char *message)
+{
+  printf("%s %s\n", condition ? "✓" : "✗", message);
+  if (!condition)
+  {
+    failures++;
+  }
+}
+
+/* 기준값: 처음부터 훑어 처음 나오는 인덱스 */
+static int linear_first(const int *arr, int size, int target)
+{
+  for (int i = 0; i < size; i++)
+  {
+    if (arr[i] == target)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/**
+ * 테스트 1: 작은 배열, 모든 값
+ */
+void test_small()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 1] 작은 배열                 ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  int arr[] = {42, 7, -3, 7, 100, 42, INT_MIN, INT_MAX, 0};
+  int size = 9;
+  HashIndex *index = build_hash_index(arr, size);
+  check(index != NULL && index->count == 7, "서로 다른 값 7개");
+
+  bool ok = index != NULL;
+  for (int i = 0; i < size && ok; i++)
+  {
+    ok = hash_index_lookup(index, arr[i]) == linear_first(arr, size, arr[i]);
+  }
+  check(ok, "중복 값은 처음 인덱스 (42 -> 0, 7 -> 1), INT_MIN/INT_MAX 포함");
+  check(hash_index_lookup(index, 8) == -1 && hash_index_lookup(index, -1) == -1, "없는 값은 -1");
+  free_hash_index(index);
+
+  HashIndex *empty = build_hash_index(NULL, 0);
+  check(empty != NULL && empty->count == 0 && hash_index_lookup(empty, 0) == -1, "빈 배열");
+  check(hash_index_lookup(NULL, 0) == -1 && build_hash_index(NULL, 5) == NULL, "NULL 처리");
+  free_hash_index(empty);
+  printf("\n");
+}
+
+/**
+ * 테스트 2: 크기 0~300 모든 경우
+ */
+void test_all_sizes()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 2] 크기 0~300, 중복 많음      ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  int arr[300];
+  bool ok = true;
+  unsigned int seed = 3;
+  for (int size = 0; size <= 300 && ok; size++)
+  {
+    for (int i = 0; i < size; i++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      arr[i] = (int)((seed >> 16) % 97) - 48;
+    }
+    HashIndex *index = build_hash_index(arr, size);
+    ok = index != NULL;
+    for (int target = -50; target <= 50 && ok; target++)
+    {
+      ok = hash_index_lookup(index, target) == linear_first(arr, size, target);
+    }
+    free_hash_index(index);
+  }
+  check(ok, "모든 크기에서 -50~50 조회가 순차 탐색과 일치");
+  printf("\n");
+}
+
+/**
+ * 테스트 3: 큰 배열, 채움률 높은 경우와 충돌이 몰리는 키
+ */
+void test_large()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 3] 큰 배열 / 탐사 길이        ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  // 용량 2^17 = 131072에서 채움률 7/8에 가까운 크기
+  int size = 114000;
+  int *arr = (int *)malloc(size * sizeof(int));
+  unsigned int seed = 11;
+  for (int i = 0; i < size; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    arr[i] = (int)(seed ^ (seed >> 13)); // 넓은 범위 (가끔 중복)
+  }
+  HashIndex *index = build_hash_index(arr, size);
+  bool ok = index != NULL && index->capacity == 131072;
+
+  for (int i = 0; i < size && ok; i++)
+  {
+    int position = hash_index_lookup(index, arr[i]);
+    ok = position >= 0 && position <= i && arr[position] == arr[i];
+  }
+  // 처음 인덱스인지는 일부만 순차 탐색으로 확인
+  for (int i = 0; i < size && ok; i += 997)
+  {
+    ok = hash_index_lookup(index, arr[i]) == linear_first(arr, size, arr[i]);
+  }
+  int misses = 0;
+  for (int k = 0; k < 10000; k++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    int target = (int)seed;
+    misses += hash_index_lookup(index, target) != linear_first(arr, size, target);
+  }
+  ok = ok && misses == 0;
+  printf("용량 %d, 서로 다른 값 %d개 (채움률 %.1f%%)\n", index ? index->capacity : 0, index ? index->count : 0,
+         index ? 100.0 * index->count / index->capacity : 0.0);
+  check(ok, "채움률 ~87%에서 모든 값 / 랜덤 쿼리 1만 개 일치");
+  free_hash_index(index);
+
+  // 등차수열 키 (곱셈 해시만 쓰면 같은 그룹에 몰리기 쉬운 패턴)
+  for (int i = 0; i < size; i++)
+  {
+    arr[i] = i << 12;
+  }
+  index = build_hash_index(arr, size);
+  ok = index != NULL;
+  for (int i = 0; i < size && ok; i++)
+  {
+    ok = hash_index_lookup(index, i << 12) == i && hash_index_lookup(index, (i << 12) + 1) == -1;
+  }
+  check(ok, "간격 4096 등차수열 키");
+  free_hash_index(index);
+  free(arr);
+  printf("\n");
+}
+
+int main()
+{
+  printf("╔═══════════════════════════════════════════════╗\n");
+  printf("║      해시 인덱스 (Swiss table, 값 -> 첫 인덱스) 테스트 ║\n");
+  printf("║                                               ║\n");
+  printf("║  생성: O(n), 조회: 평균 O(1)                     ║\n");
+  printf("╚═══════════════════════════════════════════════╝\n\n");
+
+  test_small();
+  test_all_sizes();
+  test_large();
+
+  if (failures > 0)
+  {
+    printf("✗ 실패한 검사: %d개\n", failures);
+    return 1;
+  }
+
+  printf("✓ 모든 테스트가 완료되었습니다.\n");
+  return 0;
+}
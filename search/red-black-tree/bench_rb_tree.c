@@ -0,0 +1,65 @@
+#include "rb_tree.h"
+#include <math.h>
+#include <time.h>
+
+/*
+ * 벤치마크: 거의 정렬된 키 스트림을 삽입한 뒤 랜덤 탐색 지연 측정
+ * 키 수가 10배씩 늘어도 탐색 시간은 log n에 비례해서만 증가해야 한다.
+ */
+
+#define LOOKUPS 1000000
+
+static double elapsed_seconds(struct timespec start, struct timespec end)
+{
+  return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+static void run(int n)
+{
+  struct timespec start, end;
+
+  // 거의 정렬된 순서: 인접한 두 키씩 자리를 바꿔서 삽입
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  Node *root = NULL;
+  for (int i = 0; i + 1 < n; i += 2)
+  {
+    root = insert_node(root, i + 1);
+    root = insert_node(root, i);
+  }
+  if (n % 2 == 1)
+  {
+    root = insert_node(root, n - 1);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double insert_time = elapsed_seconds(start, end);
+
+  unsigned int seed = 12345;
+  long found = 0;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int i = 0; i < LOOKUPS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    found += search_node(root, (int)(seed % (unsigned int)n)) != NULL;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double lookup_ns = elapsed_seconds(start, end) * 1e9 / LOOKUPS;
+
+  printf("%10d  %6d  %8.1f  %10.3f  %10.1f  %s\n",
+         n, tree_height(root), log2(n), insert_time, lookup_ns,
+         found == LOOKUPS ? "OK" : "MISSING");
+
+  free_tree(root);
+}
+
+int main()
+{
+  printf("=== 레드-블랙 트리 벤치마크 (거의 정렬된 키 삽입 + 랜덤 탐색 %d회) ===\n\n", LOOKUPS);
+  printf("%10s  %6s  %8s  %10s  %10s\n", "키 개수", "높이", "log2 n", "삽입(초)", "탐색(ns)");
+
+  for (int n = 10000; n <= 10000000; n *= 10)
+  {
+    run(n);
+  }
+
+  return 0;
+}
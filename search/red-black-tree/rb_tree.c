@@ -0,0 +1,321 @@
+#include "rb_tree.h"
+
+/**
+ * 새로운 노드 생성 (새 노드는 항상 빨간색)
+ * @param data: 노드에 저장할 값
+ * @return: 생성된 노드 포인터
+ */
+Node *create_node(int data)
+{
+  Node *node = (Node *)malloc(sizeof(Node));
+  node->data = data;
+  node->red = true;
+  node->left = NULL;
+  node->right = NULL;
+  return node;
+}
+
+/* NULL 링크는 검은색으로 취급 */
+static bool is_red(Node *node)
+{
+  return node != NULL && node->red;
+}
+
+/* 오른쪽으로 기운 빨간 링크를 왼쪽으로 */
+static Node *rotate_left(Node *h)
+{
+  Node *x = h->right;
+  h->right = x->left;
+  x->left = h;
+  x->red = h->red;
+  h->red = true;
+  return x;
+}
+
+/* 왼쪽으로 기운 빨간 링크를 오른쪽으로 */
+static Node *rotate_right(Node *h)
+{
+  Node *x = h->left;
+  h->left = x->right;
+  x->right = h;
+  x->red = h->red;
+  h->red = true;
+  return x;
+}
+
+/* 노드와 두 자식의 색을 뒤집음 (2-3-4 트리에서 4-노드 분할/병합) */
+static void flip_colors(Node *h)
+{
+  h->red = !h->red;
+  h->left->red = !h->left->red;
+  h->right->red = !h->right->red;
+}
+
+/**
+ * 돌아오는 경로에서 LLRB 불변식 복구
+ * 1. 오른쪽만 빨간 링크 -> 왼쪽 회전
+ * 2. 왼쪽 빨간 링크가 연속 -> 오른쪽 회전
+ * 3. 양쪽 모두 빨간 링크 -> 색 뒤집기
+ */
+static Node *fix_up(Node *h)
+{
+  if (is_red(h->right) && !is_red(h->left))
+  {
+    h = rotate_left(h);
+  }
+  if (is_red(h->left) && is_red(h->left->left))
+  {
+    h = rotate_right(h);
+  }
+  if (is_red(h->left) && is_red(h->right))
+  {
+    flip_colors(h);
+  }
+  return h;
+}
+
+static Node *insert_recursive(Node *h, int data)
+{
+  if (h == NULL)
+  {
+    return create_node(data);
+  }
+
+  if (data < h->data)
+  {
+    h->left = insert_recursive(h->left, data);
+  }
+  else if (data > h->data)
+  {
+    h->right = insert_recursive(h->right, data);
+  }
+  // 같은 값은 무시 (중복 허용 안 함)
+
+  return fix_up(h);
+}
+
+/**
+ * 레드-블랙 트리에 값 삽입
+ * @param root: 트리의 루트 노드
+ * @param data: 삽입할 값
+ * @return: 삽입 후 루트 노드
+ *
+ * 시간 복잡도: 최악 O(log n) (높이 ≤ 2 log n)
+ */
+Node *insert_node(Node *root, int data)
+{
+  root = insert_recursive(root, data);
+  root->red = false;
+  return root;
+}
+
+/**
+ * 레드-블랙 트리에서 값 탐색 (일반 BST 탐색과 동일)
+ * @param root: 트리의 루트 노드
+ * @param data: 찾을 값
+ * @return: 찾은 노드, 없으면 NULL
+ */
+Node *search_node(Node *root, int data)
+{
+  while (root != NULL && root->data != data)
+  {
+    root = data < root->data ? root->left : root->right;
+  }
+  return root;
+}
+
+/**
+ * 서브트리에서 최솟값 노드 찾기 (가장 왼쪽 노드)
+ */
+Node *find_min(Node *root)
+{
+  while (root != NULL && root->left != NULL)
+  {
+    root = root->left;
+  }
+  return root;
+}
+
+/* h가 빨갛고 h->left, h->left->left가 검을 때, h->left 쪽을 빨갛게 만듦 */
+static Node *move_red_left(Node *h)
+{
+  flip_colors(h);
+  if (is_red(h->right->left))
+  {
+    h->right = rotate_right(h->right);
+    h = rotate_left(h);
+    flip_colors(h);
+  }
+  return h;
+}
+
+/* h가 빨갛고 h->right, h->right->left가 검을 때, h->right 쪽을 빨갛게 만듦 */
+static Node *move_red_right(Node *h)
+{
+  flip_colors(h);
+  if (is_red(h->left->left))
+  {
+    h = rotate_right(h);
+    flip_colors(h);
+  }
+  return h;
+}
+
+/* 서브트리의 최솟값 노드 삭제 */
+static Node *delete_min(Node *h)
+{
+  if (h->left == NULL)
+  {
+    free(h);
+    return NULL;
+  }
+
+  if (!is_red(h->left) && !is_red(h->left->left))
+  {
+    h = move_red_left(h);
+  }
+  h->left = delete_min(h->left);
+
+  return fix_up(h);
+}
+
+/* data가 트리에 있다는 전제로 삭제 */
+static Node *delete_recursive(Node *h, int data)
+{
+  if (data < h->data)
+  {
+    if (!is_red(h->left) && !is_red(h->left->left))
+    {
+      h = move_red_left(h);
+    }
+    h->left = delete_recursive(h->left, data);
+  }
+  else
+  {
+    if (is_red(h->left))
+    {
+      h = rotate_right(h);
+    }
+
+    // 찾은 노드가 맨 아래에 있으면 바로 삭제
+    if (data == h->data && h->right == NULL)
+    {
+      free(h);
+      return NULL;
+    }
+
+    if (!is_red(h->right) && !is_red(h->right->left))
+    {
+      h = move_red_right(h);
+    }
+
+    if (data == h->data)
+    {
+      // 오른쪽 서브트리의 최솟값으로 대체 후 그 노드 삭제
+      h->data = find_min(h->right)->data;
+      h->right = delete_min(h->right);
+    }
+    else
+    {
+      h->right = delete_recursive(h->right, data);
+    }
+  }
+
+  return fix_up(h);
+}
+
+/**
+ * 레드-블랙 트리에서 값 삭제
+ * @param root: 트리의 루트 노드
+ * @param data: 삭제할 값
+ * @return: 삭제 후 루트 노드
+ *
+ * 내려가는 경로에서 현재 노드가 2-노드가 되지 않도록
+ * 빨간 링크를 끌고 내려간 뒤, 돌아오면서 fix_up으로 정리한다.
+ */
+Node *delete_node(Node *root, int data)
+{
+  // 없는 값이면 트리를 건드리지 않음
+  if (search_node(root, data) == NULL)
+  {
+    return root;
+  }
+
+  if (!is_red(root->left) && !is_red(root->right))
+  {
+    root->red = true;
+  }
+
+  root = delete_recursive(root, data);
+  if (root != NULL)
+  {
+    root->red = false;
+  }
+  return root;
+}
+
+/**
+ * 높이 계산
+ */
+int tree_height(Node *root)
+{
+  if (root == NULL)
+  {
+    return 0;
+  }
+  int lh = tree_height(root->left);
+  int rh = tree_height(root->right);
+  return (lh > rh ? lh : rh) + 1;
+}
+
+/**
+ * 중위 순회 (Inorder: Left -> Root -> Right)
+ */
+void inorder_traversal(Node *root)
+{
+  if (root != NULL)
+  {
+    inorder_traversal(root->left);
+    printf("%d ", root->data);
+    inorder_traversal(root->right);
+  }
+}
+
+/**
+ * 전위 순회 (Preorder: Root -> Left -> Right)
+ */
+void preorder_traversal(Node *root)
+{
+  if (root != NULL)
+  {
+    printf("%d ", root->data);
+    preorder_traversal(root->left);
+    preorder_traversal(root->right);
+  }
+}
+
+/**
+ * 후위 순회 (Postorder: Left -> Right -> Root)
+ */
+void postorder_traversal(Node *root)
+{
+  if (root != NULL)
+  {
+    postorder_traversal(root->left);
+    postorder_traversal(root->right);
+    printf("%d ", root->data);
+  }
+}
+
+/**
+ * 트리 전체 메모리 해제 (후위 순회 방식)
+ */
+void free_tree(Node *root)
+{
+  if (root != NULL)
+  {
+    free_tree(root->left);
+    free_tree(root->right);
+    free(root);
+  }
+}
@@ -0,0 +1,40 @@
+#ifndef RB_TREE_H
+#define RB_TREE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+/*
+ * 레드-블랙 트리 노드 구조체 (Left-Leaning Red-Black, Sedgewick)
+ * 이진 탐색 트리(binary-search-tree)와 같은 API를 제공한다.
+ * 빨간 링크는 항상 왼쪽으로만 기울어지므로 부모 포인터 없이
+ * 재귀 삽입/삭제만으로 균형을 유지할 수 있다.
+ */
+typedef struct Node
+{
+  int data;
+  bool red; /* 부모에서 이 노드로 오는 링크가 빨간색인지 */
+  struct Node *left;
+  struct Node *right;
+} Node;
+
+/* 레드-블랙 트리 함수 선언 (binary-search-tree와 동일한 시그니처) */
+Node *create_node(int data);
+Node *insert_node(Node *root, int data);
+Node *search_node(Node *root, int data);
+Node *delete_node(Node *root, int data);
+Node *find_min(Node *root);
+
+/* 높이 계산 (빈 트리 = 0, O(n)) */
+int tree_height(Node *root);
+
+/* 순회 함수 */
+void inorder_traversal(Node *root);
+void preorder_traversal(Node *root);
+void postorder_traversal(Node *root);
+
+/* 메모리 해제 */
+void free_tree(Node *root);
+
+#endif // RB_TREE_H
@@ -0,0 +1,322 @@
+#include "rb_tree.h"
+#include <limits.h>
+#include <math.h>
+
+static int failures = 0;
+
+/* 조건 확인 헬퍼: ✓/✗ 출력 후 실패 횟수 누적 */
+static void check(bool condition, const char *message)
+{
+  printf("%s %s\n", condition ? "✓" : "✗", message);
+  if (!condition)
+  {
+    failures++;
+  }
+}
+
+/**
+ * LLRB 불변식 검사
+ * - BST 순서 (lo < data < hi)
+ * - 빨간 링크는 왼쪽에만 있음
+ * - 빨간 링크가 연속으로 나오지 않음
+ * - 루트에서 모든 NULL 링크까지 검은 링크 수가 같음
+ * @return: 검은 높이, 불변식이 깨졌으면 -1
+ */
+static int verify_rb(Node *root, long lo, long hi)
+{
+  if (root == NULL)
+  {
+    return 0;
+  }
+  if (root->data <= lo || root->data >= hi)
+  {
+    return -1;
+  }
+  if (root->right != NULL && root->right->red)
+  {
+    return -1;
+  }
+  if (root->red && root->left != NULL && root->left->red)
+  {
+    return -1;
+  }
+
+  int lb = verify_rb(root->left, lo, root->data);
+  int rb = verify_rb(root->right, root->data, hi);
+  if (lb < 0 || rb < 0 || lb != rb)
+  {
+    return -1;
+  }
+  return lb + (root->red ? 0 : 1);
+}
+
+static bool is_valid_rb(Node *root)
+{
+  if (root != NULL && root->red)
+  {
+    return false;
+  }
+  return verify_rb(root, (long)INT_MIN - 1, (long)INT_MAX + 1) >= 0;
+}
+
+/* 레드-블랙 트리 높이 상한: 2 log2(n + 1) */
+static bool within_rb_bound(Node *root, int n)
+{
+  return tree_height(root) <= 2 * log2(n + 1.0);
+}
+
+/**
+ * 테스트 1: 빈 트리에서 탐색
+ */
+void test_empty_tree()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 1] 빈 트리에서 탐색           ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  Node *root = NULL;
+  check(search_node(root, 10) == NULL, "빈 트리에서 탐색 결과: NULL");
+  check(tree_height(root) == 0, "빈 트리 높이: 0");
+  check(delete_node(root, 10) == NULL, "빈 트리에서 삭제: NULL");
+  printf("\n");
+}
+
+/**
+ * 테스트 2: 작은 트리의 회전과 색 뒤집기
+ */
+void test_small_tree()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 2] 회전과 색 뒤집기           ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  // 10, 20, 30 순서 삽입: 왼쪽 회전 -> 오른쪽 회전 -> 색 뒤집기
+  Node *root = NULL;
+  root = insert_node(root, 10);
+  root = insert_node(root, 20);
+  check(root->data == 20 && root->left->red, "10, 20: 오른쪽 빨간 링크가 왼쪽으로 회전");
+  root = insert_node(root, 30);
+  check(root->data == 20 && !root->left->red && !root->right->red,
+        "10, 20, 30: 4-노드 분할 후 모두 검은색");
+  check(is_valid_rb(root), "LLRB 불변식 유지");
+  free_tree(root);
+
+  printf("\n       20\n");
+  printf("      /  \\\n");
+  printf("    10    30\n\n");
+}
+
+/**
+ * 테스트 3: 정렬된 순서로 삽입 (일반 BST라면 연결 리스트가 됨)
+ */
+void test_sorted_insertion()
+{
+  printf("╔══════════════════════════════════╗\n");
+  printf("║  [테스트 3] 정렬된 순서로 삽입          ║\n");
+  printf("╚══════════════════════════════════╝\n");
+
+  int n = 100000;
+  Node *ascending = NULL;
+  Node *descending = NULL;
+  for (int i = 0; i < n; i++)
+  {
+    ascending = insert_node(ascending, i);
+    descending = insert_node(descending, n - 1 - i);
+  }
+
+  printf("키 %d개, 오름차순 높이: %d, 내림차순 높이: %d (일반 BST라면 %d)\n",
+         n, tree_height(ascending), tree_height(descending), n);
+  check(is_valid_rb(ascending) && is_valid_rb(descending), "LLRB 불변식 유지");
+  check(within_rb_bound(ascending, n) && within_rb_bound(descending, n),
+        "높이 ≤ 2 log2(n + 1)");
+
+  bool all_found = true;
+  for (int i = 0; i < n; i++)
+  {
+    Node *found = search_node(ascending, i);
+    if (found == NULL || found->data != i)
+    {
+      all_found = false;
+      break;
+    }
+  }
+  check(all_found, "모든 키 탐색 성공");
+  check(search_node(ascending, n) == NULL && search_node(ascending, -1) == NULL,
+        "범위 밖 키는 NULL");
+
+  // 거의 정렬된 순서: 인접한 두 키씩 자리를 바꿈
+  Node *nearly = NULL;
+  for (int i = 0; i < n; i += 2)
+  {
+    nearly = insert_node(nearly, i + 1);
+    nearly = insert_node(nearly, i);
+  }
+  check(is_valid_rb(nearly) && within_rb_bound(nearly, n), "거의 정렬된 순서도 균형 유지");
+
+  free_tree(ascending);
+  free_tree(descending);
+  free_tree(nearly);
+  printf("\n");
+}
+
+/**
+ * 테스트 4: 노드 삭제 (자식 없음/한 개/두 개) + 삭제 후 재균형
+ */
+void test_delete()
+{
+  printf("╔═══════════════════════════════════╗\n");
+  printf("║  [테스트 4] 노드 삭제                 ║\n");
+  printf("╚═══════════════════════════════════╝\n");
+
+  Node *root = NULL;
+  int keys[] = {50, 30, 70, 20, 40, 60, 80};
+  for (int i = 0; i < 7; i++)
+  {
+    root = insert_node(root, keys[i]);
+  }
+
+  root = delete_node(root, 20);
+  check(search_node(root, 20) == NULL && is_valid_rb(root), "리프 노드 삭제 (20)");
+  root = delete_node(root, 30);
+  check(search_node(root, 30) == NULL && is_valid_rb(root), "내부 노드 삭제 (30)");
+  root = delete_node(root, root->data);
+  check(tree_height(root) <= 3 && is_valid_rb(root), "루트 삭제");
+  root = delete_node(root, 999);
+  check(is_valid_rb(root) && search_node(root, 40) != NULL, "없는 값 삭제는 무시");
+
+  printf("   결과: ");
+  inorder_traversal(root);
+  printf("\n");
+  free_tree(root);
+
+  // 한쪽만 계속 삭제
+  int n = 4096;
+  root = NULL;
+  for (int i = 0; i < n; i++)
+  {
+    root = insert_node(root, i);
+  }
+  bool valid = true;
+  for (int i = 0; i < n / 2 && valid; i++)
+  {
+    root = delete_node(root, i);
+    valid = is_valid_rb(root) && within_rb_bound(root, n - 1 - i);
+  }
+  check(valid, "왼쪽 절반 연속 삭제 중 매번 균형 유지");
+  check(search_node(root, n / 2 - 1) == NULL && search_node(root, n / 2) != NULL,
+        "남은 키 범위 확인");
+
+  // 전부 삭제하면 빈 트리
+  for (int i = n / 2; i < n; i++)
+  {
+    root = delete_node(root, i);
+  }
+  check(root == NULL, "모든 키 삭제 후 빈 트리");
+  printf("\n");
+}
+
+/**
+ * 테스트 5: 랜덤 삽입/삭제 혼합
+ */
+void test_random_operations()
+{
+  printf("╔═══════════════════════════════════╗\n");
+  printf("║  [테스트 5] 랜덤 삽입/삭제             ║\n");
+  printf("╚═══════════════════════════════════╝\n");
+
+  enum
+  {
+    RANGE = 2000,
+    OPERATIONS = 20000
+  };
+  bool present[RANGE] = {false};
+  int count = 0;
+  unsigned int seed = 7;
+  Node *root = NULL;
+  bool consistent = true;
+
+  for (int op = 0; op < OPERATIONS && consistent; op++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    int key = (int)((seed >> 8) % RANGE);
+
+    if ((seed >> 4) & 1)
+    {
+      root = insert_node(root, key);
+      count += !present[key];
+      present[key] = true;
+    }
+    else
+    {
+      root = delete_node(root, key);
+      count -= present[key];
+      present[key] = false;
+    }
+
+    consistent = (search_node(root, key) != NULL) == present[key];
+    if (op % 500 == 0)
+    {
+      consistent = consistent && is_valid_rb(root) && within_rb_bound(root, count);
+    }
+  }
+
+  check(consistent && is_valid_rb(root), "연산 20000회 동안 탐색 결과와 불변식 일치");
+  free_tree(root);
+  printf("\n");
+}
+
+/**
+ * 테스트 6: 중복 삽입과 순회
+ */
+void test_duplicates_and_traversals()
+{
+  printf("╔═══════════════════════════════════╗\n");
+  printf("║  [테스트 6] 중복 삽입과 순회            ║\n");
+  printf("╚═══════════════════════════════════╝\n");
+
+  Node *root = NULL;
+  for (int i = 1; i <= 7; i++)
+  {
+    root = insert_node(root, i * 10);
+    root = insert_node(root, i * 10);
+  }
+
+  check(is_valid_rb(root) && tree_height(root) <= 4, "중복 삽입은 무시되고 균형 유지");
+
+  printf("전위 순회: ");
+  preorder_traversal(root);
+  printf("\n중위 순회: ");
+  inorder_traversal(root);
+  printf("\n후위 순회: ");
+  postorder_traversal(root);
+  printf("\n");
+
+  free_tree(root);
+  printf("✓ 모든 노드 메모리 해제 완료\n\n");
+}
+
+int main()
+{
+  printf("╔═══════════════════════════════════════════════╗\n");
+  printf("║      Red-Black Tree (레드-블랙 트리) 테스트        ║\n");
+  printf("║                                               ║\n");
+  printf("║  시간 복잡도: 삽입/탐색/삭제 최악 O(log n)          ║\n");
+  printf("║  공간 복잡도: O(n)                               ║\n");
+  printf("╚═══════════════════════════════════════════════╝\n\n");
+
+  test_empty_tree();
+  test_small_tree();
+  test_sorted_insertion();
+  test_delete();
+  test_random_operations();
+  test_duplicates_and_traversals();
+
+  if (failures > 0)
+  {
+    printf("✗ 실패한 검사: %d개\n", failures);
+    return 1;
+  }
+
+  printf("✓ 모든 테스트가 완료되었습니다.\n");
+  return 0;
+}
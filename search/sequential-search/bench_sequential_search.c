@@ -0,0 +1,484 @@
+#include "sequential_search.h"
+#include "parallel_search.h"
+#include "sequential_scan.h"
+#include "file_search.h"
+#include "bloom_filter.h"
+#include "typed_search.h"
+#include "self_organizing.h"
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * 벤치마크: 커널별 순차 탐색 처리량 (GB/s)
+ * 배열 크기를 L1(4KB)부터 DRAM(128MB)까지 8배씩 늘려가며, 없는 값을 찾게 해서
+ * 매번 배열 전체를 훑도록 한다. 한 크기당 총 약 1GB를 읽도록 반복 횟수를 정한다.
+ * L1/L2에서는 비교 폭이 그대로 속도로 나오고, DRAM에서는 메모리 대역폭에 묶인다.
+ * 이어서 128MB 배열을 스레드 수를 늘려가며 병렬 탐색하고,
+ * 16MB 배열에서 k개 값을 k번 따로 찾을 때와 sequential_search_many를 비교한다.
+ * 같은 크기에서 개수/위치 스캔을 커널별로 재고, if로 골라 쓰는 루프와 비교한다.
+ * 256MB 파일을 전부 읽은 뒤 탐색 / mmap / 이중 버퍼 읽기로 탐색한다.
+ * 없는 값이 90%인 쿼리에서 블룸 필터를 먼저 확인할 때를 비교하고,
+ * 타입별(int8 ~ double) 함수의 원소 처리량을 커널별로 재고,
+ * 마지막으로 Zipf 분포 쿼리에서 자기 조직화 리스트의 평균 비교 수와 지연을 비교한다.
+ */
+
+#define BYTES_PER_RUN (1L << 30)
+
+static double now_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void print_size(long bytes)
+{
+  if (bytes >= 1L << 20)
+  {
+    printf("%6ldMB", bytes >> 20);
+  }
+  else
+  {
+    printf("%6ldKB", bytes >> 10);
+  }
+}
+
+/*
+ * 타입별 처리량 (G원소/s): L1에 들어가는 16KB 배열에서 없는 값을 반복 탐색
+ * 바이트 수가 같으므로 원소 폭이 좁을수록 원소 수가 많다.
+ */
+#define TYPED_BENCH_BYTES (16 * 1024)
+
+#define TYPED_BENCH_DEFINE(suffix, T)                                   \
+  static double typed_rate_##suffix(void)                               \
+  {                                                                     \
+    size_t count = TYPED_BENCH_BYTES / sizeof(T);                       \
+    T *values = (T *)calloc(count, sizeof(T));                          \
+    long repeat = BYTES_PER_RUN / TYPED_BENCH_BYTES;                    \
+    ptrdiff_t found = 0;                                                \
+    double start = now_seconds();                                       \
+    for (long r = 0; r < repeat; r++)                                   \
+    {                                                                   \
+      found += sequential_search_##suffix(values, count, (T)1);         \
+    }                                                                   \
+    double elapsed = now_seconds() - start;                             \
+    free(values);                                                       \
+    return found == -repeat ? (double)count * repeat / elapsed / 1e9 : 0.0; \
+  }
+
+TYPED_SEARCH_TYPES(TYPED_BENCH_DEFINE)
+
+/*
+ * Zipf 쿼리: 순위 r(0부터)을 확률 1/(r+1)^s로 뽑는다 (누적 분포에서 이진 탐색)
+ * 값 0..n-1을 섞은 배열을 탐색하므로 자주 찾는 값의 위치는 랜덤이다.
+ * shift가 참이면 쿼리 후반부에 자주 찾는 값 집합이 n/2만큼 밀린다 (분포 변화).
+ */
+static void bench_self_organizing(int n, double s, int queries, bool shift)
+{
+  int *values = (int *)malloc(n * sizeof(int));
+  int *targets = (int *)malloc(queries * sizeof(int));
+  double *cdf = (double *)malloc(n * sizeof(double));
+  unsigned int seed = 4242;
+
+  for (int i = 0; i < n; i++)
+  {
+    values[i] = i;
+  }
+  for (int i = n - 1; i > 0; i--)
+  {
+    seed = seed * 1103515245u + 12345u;
+    int j = (int)((seed >> 8) % (unsigned int)(i + 1));
+    int tmp = values[i];
+    values[i] = values[j];
+    values[j] = tmp;
+  }
+
+  double total = 0.0;
+  for (int r = 0; r < n; r++)
+  {
+    total += 1.0 / pow(r + 1, s);
+    cdf[r] = total;
+  }
+  // 빈도순으로 고정 배치했을 때의 기대 비교 수 (정적 배치의 하한)
+  double ideal = 0.0;
+  for (int r = 0; r < n; r++)
+  {
+    ideal += (r + 1) / pow(r + 1, s) / total;
+  }
+  for (int q = 0; q < queries; q++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    double u = (seed >> 8) / 16777216.0 * total;
+    int lo = 0, hi = n - 1;
+    while (lo < hi)
+    {
+      int mid = (lo + hi) / 2;
+      if (cdf[mid] < u)
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+    targets[q] = shift && q >= queries / 2 ? (lo + n / 2) % n : lo;
+  }
+
+  printf("  n = %d, s = %.1f%s (빈도순 정적 배치 기대값 %.1f)\n", n, s, shift ? ", 절반 지점에서 분포 변화" : "",
+         ideal);
+  ReorderPolicy policies[] = {REORDER_NONE, REORDER_MOVE_TO_FRONT, REORDER_TRANSPOSE, REORDER_COUNT};
+  long long static_found = 0;
+  for (int p = 0; p < 4; p++)
+  {
+    SelfOrganizingList *list = build_self_organizing_list(values, n, policies[p]);
+    long long found = 0;
+    double start = now_seconds();
+    for (int q = 0; q < queries; q++)
+    {
+      found += self_organizing_search(list, targets[q]);
+    }
+    double elapsed = now_seconds() - start;
+    if (p == 0)
+    {
+      static_found = found;
+    }
+    printf("    %-14s 평균 비교 %8.1f   %8.1f ns/쿼리%s\n", reorder_policy_name(policies[p]),
+           (double)list->comparisons / queries, elapsed * 1e9 / queries, found == static_found ? "" : "  [오류]");
+    free_self_organizing_list(list);
+  }
+
+  free(values);
+  free(targets);
+  free(cdf);
+}
+
+int main()
+{
+  SearchKernel kernels[] = {SEARCH_KERNEL_SCALAR, SEARCH_KERNEL_SSE2, SEARCH_KERNEL_AVX2,
+                            SEARCH_KERNEL_AVX512};
+  int max_size = 32 * 1024 * 1024; // 128MB
+  int *arr = (int *)malloc((size_t)max_size * sizeof(int));
+  if (arr == NULL)
+  {
+    fprintf(stderr, "메모리 할당 실패\n");
+    return 1;
+  }
+  for (int i = 0; i < max_size; i++)
+  {
+    arr[i] = i;
+  }
+
+  printf("=== 순차 탐색 커널별 처리량 (GB/s, 없는 값 탐색) ===\n");
+  printf("자동 선택: %s\n\n", search_kernel_name(sequential_search_kernel()));
+  printf("%8s", "배열");
+  for (int k = 0; k < 4; k++)
+  {
+    printf("  %9s", search_kernel_name(kernels[k]));
+  }
+  printf("\n");
+
+  for (int size = 1024; size <= max_size; size *= 8)
+  {
+    long bytes = (long)size * sizeof(int);
+    long repeats = BYTES_PER_RUN / bytes;
+    print_size(bytes);
+
+    for (int k = 0; k < 4; k++)
+    {
+      if (!sequential_search_set_kernel(kernels[k]))
+      {
+        printf("  %9s", "-");
+        continue;
+      }
+
+      long misses = 0;
+      double start = now_seconds();
+      for (long r = 0; r < repeats; r++)
+      {
+        // target을 매번 바꿔서 컴파일러가 반복을 합치지 못하게 함 (항상 없는 값)
+        misses += sequential_search(arr, size, -1 - (int)(r & 7)) == -1;
+      }
+      double elapsed = now_seconds() - start;
+      printf("  %9.2f", misses == repeats ? (double)bytes * repeats / elapsed / 1e9 : -1.0);
+    }
+    printf("\n");
+  }
+
+  // 병렬 탐색: DRAM 크기 배열, 지원하는 가장 넓은 커널로 되돌림
+  for (int k = 3; k > 0 && !sequential_search_set_kernel(kernels[k]); k--)
+  {
+  }
+  long online = sysconf(_SC_NPROCESSORS_ONLN);
+  printf("\n=== 병렬 탐색: %dMB 배열, %s 커널, 온라인 CPU %ld개 ===\n", max_size >> 18,
+         search_kernel_name(sequential_search_kernel()), online);
+  int thread_counts[] = {1, 2, 4, 8, 16};
+  for (int t = 0; t < 5; t++)
+  {
+    int repeats = 8;
+    long misses = 0;
+    double start = now_seconds();
+    for (int r = 0; r < repeats; r++)
+    {
+      misses += parallel_sequential_search(arr, max_size, -1 - r, thread_counts[t]) == -1;
+    }
+    double elapsed = now_seconds() - start;
+    printf("  스레드 %2d  %6.2f GB/s%s\n", thread_counts[t],
+           (double)max_size * sizeof(int) * repeats / elapsed / 1e9, misses == repeats ? "" : "  [오류]");
+  }
+
+  // 여러 값 탐색: 절반은 없는 값이라 둘 다 배열 끝까지 읽음
+  int many_size = 4 * 1024 * 1024; // 16MB
+  int counts[] = {1, 4, 8, 16, 32, 64, 256, 1024};
+  int *targets = (int *)malloc(1024 * sizeof(int));
+  int *out = (int *)malloc(1024 * sizeof(int));
+  printf("\n=== 여러 값 탐색: %dMB 배열, 절반은 없는 값 (ms) ===\n", many_size >> 18);
+  printf("%6s  %10s  %10s\n", "k", "k번 호출", "many");
+  for (int c = 0; c < 8; c++)
+  {
+    int k = counts[c];
+    for (int j = 0; j < k; j++)
+    {
+      targets[j] = j % 2 == 0 ? (int)((unsigned int)j * 2654435761u % (unsigned int)many_size) : -1 - j;
+    }
+
+    double start = now_seconds();
+    long checksum = 0;
+    for (int j = 0; j < k; j++)
+    {
+      checksum += sequential_search(arr, many_size, targets[j]);
+    }
+    double separate = now_seconds() - start;
+
+    start = now_seconds();
+    sequential_search_many(arr, many_size, targets, k, out);
+    double batched = now_seconds() - start;
+    for (int j = 0; j < k; j++)
+    {
+      checksum -= out[j];
+    }
+    printf("%6d  %10.2f  %10.2f%s\n", k, separate * 1e3, batched * 1e3, checksum == 0 ? "" : "  [오류]");
+  }
+  free(targets);
+  free(out);
+
+  // 개수/위치 스캔: 값 0~99 랜덤, 일치 비율 1% (같은 값) / 50% (범위)
+  int scan_size = many_size;
+  int *values = (int *)malloc((size_t)scan_size * sizeof(int));
+  int *positions = (int *)malloc((size_t)scan_size * sizeof(int));
+  unsigned int seed = 1;
+  for (int i = 0; i < scan_size; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    values[i] = (int)((seed >> 16) % 100);
+  }
+
+  printf("\n=== 개수/위치 스캔: %dMB 배열 (GB/s) ===\n", scan_size >> 18);
+  printf("%-22s", "");
+  for (int k = 0; k < 4; k++)
+  {
+    printf("  %9s", search_kernel_name(kernels[k]));
+  }
+  printf("\n");
+
+  const char *names[] = {"count (1%)", "find_all (1%)", "count_range (50%)", "find_range (50%)"};
+  long bytes = (long)scan_size * sizeof(int);
+  for (int op = 0; op < 4; op++)
+  {
+    printf("%-22s", names[op]);
+    for (int k = 0; k < 4; k++)
+    {
+      if (!sequential_search_set_kernel(kernels[k]))
+      {
+        printf("  %9s", "-");
+        continue;
+      }
+      int repeats = 8;
+      long total = 0;
+      double start = now_seconds();
+      for (int r = 0; r < repeats; r++)
+      {
+        switch (op)
+        {
+        case 0:
+          total += sequential_count(values, scan_size, r);
+          break;
+        case 1:
+          total += sequential_find_all(values, scan_size, r, positions, scan_size);
+          break;
+        case 2:
+          total += sequential_count_range(values, scan_size, r, r + 50);
+          break;
+        default:
+          total += sequential_find_range(values, scan_size, r, r + 50, positions, scan_size);
+          break;
+        }
+      }
+      double elapsed = now_seconds() - start;
+      printf("  %9.2f", total > 0 ? (double)bytes * repeats / elapsed / 1e9 : -1.0);
+    }
+    printf("\n");
+  }
+
+  // 비교: 원소마다 if로 골라 쓰는 루프 (50%면 분기 예측이 절반쯤 빗나감)
+  int repeats = 8;
+  long total = 0;
+  double start = now_seconds();
+  for (int r = 0; r < repeats; r++)
+  {
+    int n = 0;
+    for (int i = 0; i < scan_size; i++)
+    {
+      if (values[i] >= r && values[i] < r + 50)
+      {
+        positions[n++] = i;
+      }
+    }
+    total += n;
+  }
+  double elapsed = now_seconds() - start;
+  printf("%-22s  %9.2f\n", "if 루프 (50%)", total > 0 ? (double)bytes * repeats / elapsed / 1e9 : -1.0);
+  free(values);
+  free(positions);
+
+  // 파일 탐색: 없는 값이라 파일 끝까지 읽음 (바로 전에 쓴 파일이라 페이지 캐시에 있음)
+  const char *path = "bench_sequential_search.bin";
+  int file_count = 64 * 1024 * 1024; // 256MB
+  FILE *fp = fopen(path, "wb");
+  bool written = fp != NULL;
+  for (int start = 0; written && start < file_count; start += max_size)
+  {
+    int length = file_count - start < max_size ? file_count - start : max_size;
+    written = fwrite(arr, sizeof(int), length, fp) == (size_t)length;
+  }
+  if (fp != NULL)
+  {
+    written = fclose(fp) == 0 && written;
+  }
+  if (!written)
+  {
+    fprintf(stderr, "벤치마크 파일 쓰기 실패\n");
+    remove(path);
+    free(arr);
+    return 1;
+  }
+
+  double file_bytes = (double)file_count * sizeof(int);
+  printf("\n=== 파일 탐색: %dMB 파일, 없는 값 (GB/s, 페이지 캐시에 있는 상태) ===\n", file_count >> 18);
+
+  start = now_seconds();
+  int *loaded = (int *)malloc((size_t)file_count * sizeof(int));
+  fp = fopen(path, "rb");
+  bool load_ok = loaded != NULL && fp != NULL && fread(loaded, sizeof(int), file_count, fp) == (size_t)file_count;
+  load_ok = load_ok && sequential_search(loaded, file_count, -1) == -1;
+  elapsed = now_seconds() - start;
+  if (fp != NULL)
+  {
+    fclose(fp);
+  }
+  free(loaded);
+  printf("  %-20s %6.2f GB/s%s\n", "전부 읽고 탐색", file_bytes / elapsed / 1e9, load_ok ? "" : "  [오류]");
+
+  FileSearchMode modes[] = {FILE_SEARCH_MMAP, FILE_SEARCH_READ};
+  const char *mode_names[] = {"mmap", "이중 버퍼 읽기"};
+  for (int m = 0; m < 2; m++)
+  {
+    long long index = 0;
+    start = now_seconds();
+    bool ok = sequential_search_file(path, -1, modes[m], &index) && index == -1;
+    elapsed = now_seconds() - start;
+    printf("  %-20s %6.2f GB/s%s\n", mode_names[m], file_bytes / elapsed / 1e9, ok ? "" : "  [오류]");
+  }
+  remove(path);
+
+  // 블룸 필터: 4MB 배열, 쿼리 90%는 없는 값
+  int bloom_size = 1024 * 1024;
+  int bloom_queries = 2000;
+  int *bloom_targets = (int *)malloc(bloom_queries * sizeof(int));
+  for (int i = 0; i < bloom_queries; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    bloom_targets[i] = i % 10 == 0 ? (int)(seed % (unsigned int)bloom_size) : bloom_size + (int)(seed >> 4);
+  }
+  printf("\n=== 블룸 필터: %dMB 배열, 쿼리 %d개 중 90%%는 없는 값 (us/쿼리) ===\n", bloom_size >> 18,
+         bloom_queries);
+
+  long expected = 0;
+  start = now_seconds();
+  for (int i = 0; i < bloom_queries; i++)
+  {
+    expected += sequential_search(arr, bloom_size, bloom_targets[i]);
+  }
+  elapsed = now_seconds() - start;
+  printf("  %-24s %8.2f\n", "필터 없음", elapsed * 1e6 / bloom_queries);
+
+  double bloom_rates[] = {0.1, 0.01, 0.001};
+  for (int r = 0; r < 3; r++)
+  {
+    start = now_seconds();
+    BloomFilter *filter = build_bloom_filter(arr, bloom_size, bloom_rates[r]);
+    double build_ms = (now_seconds() - start) * 1e3;
+
+    long got = 0;
+    start = now_seconds();
+    for (int i = 0; i < bloom_queries; i++)
+    {
+      got += sequential_search_filtered(filter, arr, bloom_size, bloom_targets[i]);
+    }
+    elapsed = now_seconds() - start;
+
+    // 필터 확인만 (없는 값 쿼리)
+    int probes = 4000000;
+    int passed = 0;
+    double probe_start = now_seconds();
+    for (int i = 0; i < probes; i++)
+    {
+      passed += bloom_filter_may_contain(filter, bloom_size + i);
+    }
+    double probe_ns = (now_seconds() - probe_start) * 1e9 / probes;
+
+    printf("  필터 %5.1f%% (%5.2f비트) %8.2f   [확인 %.1f ns, 실제 오탐 %.2f%%, 생성 %.1f ms]%s\n",
+           bloom_rates[r] * 100, filter->bits_per_key, elapsed * 1e6 / bloom_queries, probe_ns,
+           100.0 * passed / probes, build_ms, got == expected ? "" : "  [오류]");
+    free_bloom_filter(filter);
+  }
+  free(bloom_targets);
+
+  // 타입별 처리량
+  printf("\n=== 타입별 탐색: %dKB 배열, 없는 값 (G원소/s, 0.00은 결과 오류) ===\n", TYPED_BENCH_BYTES >> 10);
+  printf("%8s", "타입");
+  for (int k = 0; k < 3; k++)
+  {
+    printf("%10s", search_kernel_name(kernels[k]));
+  }
+  printf("\n");
+  SearchKernel typed_selected = sequential_search_kernel();
+#define TYPED_BENCH_ROW(suffix, T)                                \
+  printf("%8s", #suffix);                                         \
+  for (int k = 0; k < 3; k++)                                     \
+  {                                                               \
+    if (sequential_search_set_kernel(kernels[k]))                 \
+    {                                                             \
+      printf("%10.2f", typed_rate_##suffix());                    \
+    }                                                             \
+    else                                                          \
+    {                                                             \
+      printf("%10s", "-");                                        \
+    }                                                             \
+  }                                                               \
+  printf("\n");
+  TYPED_SEARCH_TYPES(TYPED_BENCH_ROW)
+#undef TYPED_BENCH_ROW
+  sequential_search_set_kernel(typed_selected);
+
+  // 자기 조직화 리스트: Zipf 쿼리
+  printf("\n=== 자기 조직화 리스트: Zipf 쿼리 (%s 커널) ===\n", search_kernel_name(sequential_search_kernel()));
+  bench_self_organizing(1024, 1.0, 1000000, false);
+  bench_self_organizing(1024, 1.2, 1000000, false);
+  bench_self_organizing(16384, 1.0, 200000, false);
+  bench_self_organizing(16384, 1.0, 200000, true);
+
+  free(arr);
+  return 0;
+}
@@ -0,0 +1,213 @@
+#include "bloom_filter.h"
+#include <math.h>
+#include <string.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define BLOOM_HAVE_AVX2 1
+#include <immintrin.h>
+#endif
+
+/* 워드별 비트 위치를 정하는 홀수 상수 (Parquet 블룸 필터와 같은 값) */
+static const uint32_t salts[BLOOM_BLOCK_WORDS] = {0x47B6137Bu, 0x44974D91u, 0x8824AD5Bu, 0xA2B7289Du,
+                                                  0x705495C7u, 0x2DF1424Bu, 0x9EFC4947u, 0x5C6BFB31u};
+
+/*
+ * 64비트 해시 (MurmurHash3 fmix64)
+ * 상위 32비트로 블록을 고르고, 하위 32비트로 블록 안의 비트를 고른다.
+ */
+static uint64_t hash_key(int key)
+{
+  uint64_t h = (uint32_t)key;
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDULL;
+  h ^= h >> 33;
+  h *= 0xC4CEB9FE1A85EC53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+/* 블록 번호: (상위 32비트 x 블록 수) >> 32 (나머지 연산 없이 [0, num_blocks)) */
+static uint32_t *block_of(const BloomFilter *filter, uint64_t h)
+{
+  uint32_t block = (uint32_t)(((h >> 32) * filter->num_blocks) >> 32);
+  return filter->blocks + (size_t)block * BLOOM_BLOCK_WORDS;
+}
+
+/* ---------- 스칼라 ---------- */
+
+static void add_scalar(uint32_t *block, uint32_t bits)
+{
+  for (int j = 0; j < BLOOM_BLOCK_WORDS; j++)
+  {
+    block[j] |= 1u << ((bits * salts[j]) >> 27);
+  }
+}
+
+static bool check_scalar(const uint32_t *block, uint32_t bits)
+{
+  uint32_t missing = 0;
+  for (int j = 0; j < BLOOM_BLOCK_WORDS; j++)
+  {
+    missing |= ~block[j] & (1u << ((bits * salts[j]) >> 27));
+  }
+  return missing == 0;
+}
+
+#ifdef BLOOM_HAVE_AVX2
+
+/* 워드 8개의 비트 마스크를 한 번에: 1 << ((bits * salt) >> 27) */
+__attribute__((target("avx2"))) static inline __m256i block_mask(uint32_t bits)
+{
+  __m256i salt = _mm256_loadu_si256((const __m256i *)salts);
+  __m256i product = _mm256_mullo_epi32(_mm256_set1_epi32((int)bits), salt);
+  return _mm256_sllv_epi32(_mm256_set1_epi32(1), _mm256_srli_epi32(product, 27));
+}
+
+__attribute__((target("avx2"))) static void add_avx2(uint32_t *block, uint32_t bits)
+{
+  __m256i words = _mm256_load_si256((const __m256i *)block);
+  _mm256_store_si256((__m256i *)block, _mm256_or_si256(words, block_mask(bits)));
+}
+
+/* 필요한 비트가 모두 켜져 있으면 (~block & mask) == 0 */
+__attribute__((target("avx2"))) static bool check_avx2(const uint32_t *block, uint32_t bits)
+{
+  __m256i words = _mm256_load_si256((const __m256i *)block);
+  return _mm256_testc_si256(words, block_mask(bits));
+}
+
+#endif // BLOOM_HAVE_AVX2
+
+/**
+ * 키당 비트 수에서 오탐률 계산
+ * 블록당 키 수는 평균 λ = 256 / bits_per_key인 포아송 분포를 따른다.
+ * 키 i개가 들어간 블록에서 한 워드의 어떤 비트가 켜져 있을 확률은 1 - (31/32)^i이고,
+ * 없는 키는 워드 8개에서 모두 켜진 비트를 만나야 통과한다.
+ */
+static double estimate_false_positive(double bits_per_key)
+{
+  double lambda = 256.0 / bits_per_key;
+  double probability = exp(-lambda); // P(블록에 키 i개), i = 0부터
+  double rate = 0.0;
+  int limit = (int)(lambda * 4) + 64;
+  for (int i = 0; i < limit; i++)
+  {
+    double bit_set = 1.0 - pow(31.0 / 32.0, i);
+    rate += probability * pow(bit_set, BLOOM_BLOCK_WORDS);
+    probability *= lambda / (i + 1);
+  }
+  return rate;
+}
+
+/**
+ * 필터 생성
+ * 목표 오탐률을 만족하는 가장 작은 키당 비트 수(0.25 단위)를 찾고,
+ * 블록 수 = ceil(size x 비트 수 / 256)으로 잡은 뒤 모든 원소를 넣는다.
+ */
+BloomFilter *build_bloom_filter(const int *arr, int size, double false_positive_rate)
+{
+  if (size < 0 || (size > 0 && arr == NULL))
+  {
+    return NULL;
+  }
+  if (false_positive_rate < 0.0001)
+  {
+    false_positive_rate = 0.0001;
+  }
+  if (false_positive_rate > 0.5)
+  {
+    false_positive_rate = 0.5;
+  }
+
+  double bits_per_key = 1.0;
+  while (bits_per_key < 64.0 && estimate_false_positive(bits_per_key) > false_positive_rate)
+  {
+    bits_per_key += 0.25;
+  }
+
+  double blocks = ceil((double)size * bits_per_key / (BLOOM_BLOCK_WORDS * 32));
+  if (blocks > (double)UINT32_MAX / 2)
+  {
+    return NULL;
+  }
+  uint32_t num_blocks = blocks < 1.0 ? 1 : (uint32_t)blocks;
+
+  BloomFilter *filter = (BloomFilter *)malloc(sizeof(BloomFilter));
+  uint32_t *words = NULL;
+  size_t bytes = (size_t)num_blocks * BLOOM_BLOCK_WORDS * sizeof(uint32_t);
+  if (filter == NULL || posix_memalign((void **)&words, 64, bytes) != 0)
+  {
+    free(filter);
+    return NULL;
+  }
+  memset(words, 0, bytes);
+
+  filter->blocks = words;
+  filter->num_blocks = num_blocks;
+  filter->bits_per_key = bits_per_key;
+#ifdef BLOOM_HAVE_AVX2
+  filter->use_avx2 = __builtin_cpu_supports("avx2");
+#else
+  filter->use_avx2 = false;
+#endif
+
+  for (int i = 0; i < size; i++)
+  {
+    bloom_filter_add(filter, arr[i]);
+  }
+  return filter;
+}
+
+void free_bloom_filter(BloomFilter *filter)
+{
+  if (filter == NULL)
+  {
+    return;
+  }
+  free(filter->blocks);
+  free(filter);
+}
+
+void bloom_filter_add(BloomFilter *filter, int key)
+{
+  uint64_t h = hash_key(key);
+  uint32_t *block = block_of(filter, h);
+#ifdef BLOOM_HAVE_AVX2
+  if (filter->use_avx2)
+  {
+    add_avx2(block, (uint32_t)h);
+    return;
+  }
+#endif
+  add_scalar(block, (uint32_t)h);
+}
+
+/**
+ * 포함 여부
+ * 블록 하나(32바이트, 캐시 라인 하나 안)만 읽으므로 캐시 미스는 최대 한 번이다.
+ */
+bool bloom_filter_may_contain(const BloomFilter *filter, int key)
+{
+  uint64_t h = hash_key(key);
+  const uint32_t *block = block_of(filter, h);
+#ifdef BLOOM_HAVE_AVX2
+  if (filter->use_avx2)
+  {
+    return check_avx2(block, (uint32_t)h);
+  }
+#endif
+  return check_scalar(block, (uint32_t)h);
+}
+
+/**
+ * 필터를 먼저 확인하는 순차 탐색
+ * 시간 복잡도: 없는 값은 (1 - 오탐률) 확률로 O(1), 나머지는 O(n)
+ */
+int sequential_search_filtered(const BloomFilter *filter, int *arr, int size, int target)
+{
+  if (filter != NULL && !bloom_filter_may_contain(filter, target))
+  {
+    return -1;
+  }
+  return sequential_search(arr, size, target);
+}
@@ -0,0 +1,54 @@
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include <stdint.h>
+#include "sequential_search.h"
+
+/*
+ * 블록 블룸 필터 (split block Bloom filter)
+ *
+ * 없는 값을 찾는 sequential_search는 항상 배열 전체를 읽는다.
+ * 배열과 함께 필터를 만들어 두면 없는 값 대부분을 메모리 접근 한 번으로 걸러 낼 수 있다.
+ *
+ * 필터는 256비트(32비트 워드 8개) 블록의 배열이고, 블록은 캐시 라인을 넘지 않게 정렬한다.
+ * 키 하나는 해시로 고른 블록 하나의 워드 8개에 비트를 하나씩 켠다.
+ * 워드마다 비트 위치는 (해시 x 홀수 상수[j]) >> 27 로 정하므로
+ * AVX2에서는 곱셈 8개, 시프트, 비트 검사를 벡터 연산 한 번씩으로 끝낸다.
+ *
+ * 블룸 필터는 "없다"만 확실하다. "있을 수 있다"면 배열을 실제로 탐색해야 한다.
+ */
+
+#define BLOOM_BLOCK_WORDS 8
+
+typedef struct BloomFilter
+{
+  uint32_t *blocks;    /* num_blocks x BLOOM_BLOCK_WORDS 워드, 64바이트 정렬 */
+  uint32_t num_blocks;
+  double bits_per_key; /* 목표 오탐률에서 정한 키당 비트 수 */
+  bool use_avx2;       /* 만들 때 CPU를 확인해서 정함 */
+} BloomFilter;
+
+/*
+ * 필터 생성 (O(n))
+ * @param false_positive_rate: 목표 오탐률 (0.0001 ~ 0.5로 제한)
+ * @return: 생성된 필터 (메모리 부족이면 NULL)
+ *
+ * 키당 비트 수는 블록마다 들어가는 키 수의 포아송 분포로 오탐률을 계산해서 정한다.
+ * 예) 10% -> 6비트, 1% -> 10.75비트, 0.1% -> 17비트, 0.01% -> 26.5비트
+ */
+BloomFilter *build_bloom_filter(const int *arr, int size, double false_positive_rate);
+void free_bloom_filter(BloomFilter *filter);
+
+/* 키 추가 (배열에 원소를 덧붙였을 때, 개수가 크게 늘면 다시 만드는 것이 좋음) */
+void bloom_filter_add(BloomFilter *filter, int key);
+
+/* false면 확실히 없음, true면 있을 수 있음 */
+bool bloom_filter_may_contain(const BloomFilter *filter, int key);
+
+/*
+ * 필터를 먼저 확인하는 순차 탐색 (결과는 sequential_search와 같음)
+ * filter는 arr의 모든 원소로 만든 것이어야 한다 (배열을 바꾸면 다시 만들어야 함).
+ */
+int sequential_search_filtered(const BloomFilter *filter, int *arr, int size, int target);
+
+#endif // BLOOM_FILTER_H
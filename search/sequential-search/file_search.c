@@ -0,0 +1,238 @@
+#include "file_search.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* 청크 단위로 탐색, 찾으면 파일 안의 원소 번호 */
+static long long search_chunks(const int *values, long long count, int target)
+{
+  for (long long start = 0; start < count; start += FILE_SEARCH_CHUNK)
+  {
+    int length = count - start < FILE_SEARCH_CHUNK ? (int)(count - start) : FILE_SEARCH_CHUNK;
+    int found = sequential_search((int *)values + start, length, target);
+    if (found >= 0)
+    {
+      return start + found;
+    }
+  }
+  return -1;
+}
+
+/**
+ * mmap 탐색
+ * 커널이 순차 접근 힌트를 보고 앞쪽 페이지를 크게 미리 읽으므로
+ * 탐색이 페이지 폴트를 기다리는 시간이 줄어든다.
+ * 매핑한 페이지를 읽지 못하면(파일이 줄었거나 I/O 오류) SIGBUS가 나므로
+ * 탐색 중에 바뀌지 않는 파일이어야 한다. SIGBUS 처리기는 프로세스 전체에 걸리고
+ * 스레드 안전하게 되돌리기 어려워서 라이브러리에서 설치하지 않는다.
+ */
+static bool search_mapped(int fd, size_t bytes, int target, long long *index)
+{
+  if (bytes == 0)
+  {
+    *index = -1;
+    return true;
+  }
+
+  void *map = mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (map == MAP_FAILED)
+  {
+    return false;
+  }
+  posix_madvise(map, bytes, POSIX_MADV_SEQUENTIAL);
+
+  *index = search_chunks((const int *)map, (long long)(bytes / sizeof(int)), target);
+  munmap(map, bytes);
+  return true;
+}
+
+/* 이중 버퍼 상태 (읽기 스레드와 탐색 스레드가 공유, lock으로 보호) */
+typedef struct ChunkQueue
+{
+  int fd;
+  long long count;      /* 파일의 원소 수 */
+  int *buffers[2];
+  int lengths[2];       /* 채운 원소 수, 읽기 실패면 -1 */
+  bool ready[2];        /* 채워져서 탐색을 기다리는 중 */
+  bool stop;            /* 찾았거나 실패: 읽기 중단 */
+  pthread_mutex_t lock;
+  pthread_cond_t changed;
+} ChunkQueue;
+
+/* 끝까지 읽음 (pread는 요청보다 적게 읽을 수 있음) */
+static bool read_fully(int fd, void *buffer, size_t bytes, off_t offset)
+{
+  char *out = (char *)buffer;
+  while (bytes > 0)
+  {
+    ssize_t got = pread(fd, out, bytes, offset);
+    if (got < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (got <= 0)
+    {
+      return false; // 오류이거나, 도중에 파일이 줄어듦
+    }
+    out += got;
+    bytes -= (size_t)got;
+    offset += got;
+  }
+  return true;
+}
+
+/**
+ * 읽기 스레드
+ * 청크 k를 버퍼 k % 2에 채운다. 그 버퍼를 탐색 스레드가 아직 쓰고 있으면 기다린다.
+ */
+static void *reader_main(void *arg)
+{
+  ChunkQueue *queue = (ChunkQueue *)arg;
+
+  for (long long k = 0; k * FILE_SEARCH_CHUNK < queue->count; k++)
+  {
+    int slot = (int)(k & 1);
+    pthread_mutex_lock(&queue->lock);
+    while (queue->ready[slot] && !queue->stop)
+    {
+      pthread_cond_wait(&queue->changed, &queue->lock);
+    }
+    bool stop = queue->stop;
+    pthread_mutex_unlock(&queue->lock);
+    if (stop)
+    {
+      break;
+    }
+
+    long long start = k * FILE_SEARCH_CHUNK;
+    int length = queue->count - start < FILE_SEARCH_CHUNK ? (int)(queue->count - start) : FILE_SEARCH_CHUNK;
+    bool ok = read_fully(queue->fd, queue->buffers[slot], (size_t)length * sizeof(int),
+                         (off_t)start * (off_t)sizeof(int));
+
+    pthread_mutex_lock(&queue->lock);
+    queue->lengths[slot] = ok ? length : -1;
+    queue->ready[slot] = true;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+    if (!ok)
+    {
+      break;
+    }
+  }
+  return NULL;
+}
+
+/**
+ * 이중 버퍼 읽기 탐색
+ * 탐색 스레드(호출한 스레드)가 청크 k를 비교하는 동안 읽기 스레드는 청크 k + 1을 읽는다.
+ * 버퍼는 페이지 경계에 맞춰 할당한다 (커널 복사가 페이지 단위로 정렬됨).
+ */
+static bool search_double_buffered(int fd, size_t bytes, int target, long long *index)
+{
+  ChunkQueue queue;
+  queue.fd = fd;
+  queue.count = (long long)(bytes / sizeof(int));
+  queue.buffers[0] = NULL;
+  queue.buffers[1] = NULL;
+  queue.ready[0] = queue.ready[1] = false;
+  queue.stop = false;
+
+  size_t buffer_bytes = (size_t)FILE_SEARCH_CHUNK * sizeof(int);
+  if (posix_memalign((void **)&queue.buffers[0], 4096, buffer_bytes) != 0 ||
+      posix_memalign((void **)&queue.buffers[1], 4096, buffer_bytes) != 0)
+  {
+    free(queue.buffers[0]);
+    return false;
+  }
+  posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+  pthread_mutex_init(&queue.lock, NULL);
+  pthread_cond_init(&queue.changed, NULL);
+
+  pthread_t reader;
+  bool started = pthread_create(&reader, NULL, reader_main, &queue) == 0;
+  bool ok = started;
+  long long found = -1;
+
+  for (long long k = 0; ok && k * FILE_SEARCH_CHUNK < queue.count; k++)
+  {
+    int slot = (int)(k & 1);
+    pthread_mutex_lock(&queue.lock);
+    while (!queue.ready[slot])
+    {
+      pthread_cond_wait(&queue.changed, &queue.lock);
+    }
+    int length = queue.lengths[slot];
+    pthread_mutex_unlock(&queue.lock);
+
+    if (length < 0)
+    {
+      ok = false;
+      break;
+    }
+
+    // 버퍼를 탐색하는 동안에는 lock을 잡지 않음 (읽기 스레드는 다른 버퍼를 채움)
+    int position = sequential_search(queue.buffers[slot], length, target);
+    if (position >= 0)
+    {
+      found = k * FILE_SEARCH_CHUNK + position;
+    }
+
+    pthread_mutex_lock(&queue.lock);
+    queue.ready[slot] = false;
+    queue.stop = found >= 0;
+    pthread_cond_broadcast(&queue.changed);
+    pthread_mutex_unlock(&queue.lock);
+    if (found >= 0)
+    {
+      break;
+    }
+  }
+
+  if (started)
+  {
+    pthread_mutex_lock(&queue.lock);
+    queue.stop = true;
+    pthread_cond_broadcast(&queue.changed);
+    pthread_mutex_unlock(&queue.lock);
+    pthread_join(reader, NULL);
+  }
+
+  pthread_cond_destroy(&queue.changed);
+  pthread_mutex_destroy(&queue.lock);
+  free(queue.buffers[0]);
+  free(queue.buffers[1]);
+  if (ok)
+  {
+    *index = found;
+  }
+  return ok;
+}
+
+/**
+ * 파일 순차 탐색
+ * 시간 복잡도: O(n), 추가 메모리: READ 모드는 청크 2개 (8MB), MMAP 모드는 없음
+ */
+bool sequential_search_file(const char *path, int target, FileSearchMode mode, long long *index)
+{
+  int fd = open(path, O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size % (off_t)sizeof(int) != 0)
+  {
+    close(fd);
+    return false;
+  }
+
+  size_t bytes = (size_t)st.st_size;
+  bool ok = mode == FILE_SEARCH_MMAP ? search_mapped(fd, bytes, target, index)
+                                     : search_double_buffered(fd, bytes, target, index);
+  close(fd);
+  return ok;
+}
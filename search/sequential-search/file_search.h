@@ -0,0 +1,43 @@
+#ifndef FILE_SEARCH_H
+#define FILE_SEARCH_H
+
+#include "sequential_search.h"
+
+/*
+ * 파일 순차 탐색
+ *
+ * int32 배열을 그대로 쓴 파일(헤더 없음, 호스트 바이트 순서)에서 target을 찾는다.
+ * 파일 전체를 메모리에 읽어 두지 않고 FILE_SEARCH_CHUNK 단위로 sequential_search를
+ * 돌리므로, 메모리보다 큰 파일도 탐색할 수 있고 찾으면 나머지는 읽지 않는다.
+ *
+ * - FILE_SEARCH_MMAP: 파일을 매핑하고 POSIX_MADV_SEQUENTIAL로 미리 읽기를 요청
+ *                     (페이지 캐시에 있으면 복사가 없어 가장 빠름)
+ *                     탐색 중에 다른 프로세스가 파일을 줄이거나 페이지를 읽다가 I/O 오류가 나면
+ *                     false가 아니라 SIGBUS로 프로세스가 죽는다. 탐색하는 동안 아무도 바꾸지 않는
+ *                     파일에만 쓴다.
+ * - FILE_SEARCH_READ: 읽기 스레드가 다음 청크를 pread하는 동안 현재 청크를 탐색
+ *                     (이중 버퍼, 디스크 읽기와 비교가 겹침. mmap을 쓸 수 없거나
+ *                     탐색 중에 바뀔 수 있는 파일용)
+ */
+
+typedef enum FileSearchMode
+{
+  FILE_SEARCH_MMAP,
+  FILE_SEARCH_READ
+} FileSearchMode;
+
+#define FILE_SEARCH_CHUNK (1024 * 1024) /* 한 번에 탐색하는 원소 수 (4MB) */
+
+/**
+ * 파일 순차 탐색
+ * @param path: int32 배열 파일
+ * @param target: 찾을 값
+ * @param mode: FILE_SEARCH_MMAP 또는 FILE_SEARCH_READ
+ * @param index: 처음 일치하는 원소 번호 (없으면 -1)
+ * @return: 파일을 열 수 없거나 크기가 4의 배수가 아니면 false,
+ *          FILE_SEARCH_READ는 읽다가 실패하거나 도중에 파일이 줄어들어도 false
+ *          (FILE_SEARCH_MMAP에서는 이 경우 SIGBUS, 위 설명 참고)
+ */
+bool sequential_search_file(const char *path, int target, FileSearchMode mode, long long *index);
+
+#endif // FILE_SEARCH_H
@@ -0,0 +1,120 @@
+#include "parallel_search.h"
+#include <limits.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/* 스레드들이 공유하는 탐색 상태 */
+typedef struct ScanShared
+{
+  const int *arr;
+  int size;
+  int target;
+  atomic_int next_block; /* 다음에 가져갈 블록 번호 */
+  atomic_int found;      /* 지금까지 찾은 최소 인덱스 (없으면 INT_MAX) */
+} ScanShared;
+
+/* found = min(found, index) (CAS 반복) */
+static void update_min(atomic_int *found, int index)
+{
+  int current = atomic_load(found);
+  while (index < current && !atomic_compare_exchange_weak(found, &current, index))
+  {
+  }
+}
+
+/**
+ * 작업 스레드: 블록을 하나씩 가져와 탐색
+ * 가져온 블록이 이미 찾은 위치보다 뒤라면 남은 블록도 모두 뒤이므로 종료한다.
+ */
+static void *scan_worker(void *arg)
+{
+  ScanShared *shared = (ScanShared *)arg;
+
+  for (;;)
+  {
+    int block = atomic_fetch_add(&shared->next_block, 1);
+    long long start = (long long)block * PARALLEL_SEARCH_BLOCK; // 마지막 블록 뒤는 2^31 이상 (32비트 long이면 넘침)
+    if (start >= shared->size || start >= atomic_load(&shared->found))
+    {
+      break;
+    }
+
+    int length = shared->size - (int)start < PARALLEL_SEARCH_BLOCK ? shared->size - (int)start
+                                                                    : PARALLEL_SEARCH_BLOCK;
+    int index = sequential_search((int *)shared->arr + start, length, shared->target);
+    if (index >= 0)
+    {
+      update_min(&shared->found, (int)start + index);
+      break;
+    }
+  }
+  return NULL;
+}
+
+/* 0 이하이면 온라인 CPU 수, 최대 PARALLEL_SEARCH_MAX_THREADS */
+static int resolve_threads(int num_threads)
+{
+  if (num_threads <= 0)
+  {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    num_threads = online > 0 ? (int)online : 1;
+  }
+  return num_threads > PARALLEL_SEARCH_MAX_THREADS ? PARALLEL_SEARCH_MAX_THREADS : num_threads;
+}
+
+/**
+ * 병렬 순차 탐색
+ * 호출한 스레드도 작업자로 참여하므로 새로 만드는 스레드는 num_threads - 1개.
+ * 스레드 생성에 실패하면 만든 만큼만으로 계속한다 (결과는 같음).
+ *
+ * 시간 복잡도: O(n / p) (p = 스레드 수, 메모리 대역폭이 허용하는 만큼)
+ */
+int parallel_sequential_search(const int *arr, int size, int target, int num_threads)
+{
+  if (arr == NULL || size <= 0)
+  {
+    return -1;
+  }
+
+  num_threads = resolve_threads(num_threads);
+  // 올림 나눗셈을 (size + BLOCK - 1)로 하면 INT_MAX 근처에서 넘침
+  int blocks = size / PARALLEL_SEARCH_BLOCK + (size % PARALLEL_SEARCH_BLOCK != 0);
+  if (num_threads > blocks)
+  {
+    num_threads = blocks;
+  }
+  if (num_threads <= 1 || size < PARALLEL_SEARCH_MIN_SIZE)
+  {
+    return sequential_search((int *)arr, size, target);
+  }
+
+  // 커널 선택을 스레드를 만들기 전에 끝내 둠
+  sequential_search_kernel();
+
+  ScanShared shared;
+  shared.arr = arr;
+  shared.size = size;
+  shared.target = target;
+  atomic_init(&shared.next_block, 0);
+  atomic_init(&shared.found, INT_MAX);
+
+  pthread_t threads[PARALLEL_SEARCH_MAX_THREADS];
+  int created = 0;
+  for (int i = 0; i < num_threads - 1; i++)
+  {
+    if (pthread_create(&threads[created], NULL, scan_worker, &shared) == 0)
+    {
+      created++;
+    }
+  }
+
+  scan_worker(&shared);
+  for (int i = 0; i < created; i++)
+  {
+    pthread_join(threads[i], NULL);
+  }
+
+  int found = atomic_load(&shared.found);
+  return found == INT_MAX ? -1 : found;
+}
@@ -0,0 +1,35 @@
+#ifndef PARALLEL_SEARCH_H
+#define PARALLEL_SEARCH_H
+
+#include "sequential_search.h"
+
+/*
+ * 멀티스레드 순차 탐색
+ *
+ * 배열을 PARALLEL_SEARCH_BLOCK개씩 블록으로 나누고, 스레드들이 공유 카운터로
+ * 다음 블록을 하나씩 가져가 SIMD 커널(sequential_search)로 훑는다.
+ * 일치를 찾으면 지금까지의 최소 인덱스를 원자적으로 갱신하고,
+ * 그보다 뒤에서 시작하는 블록은 더 이상 가져가지 않는다.
+ * 블록은 항상 앞에서부터 배정되므로 결과는 처음 일치하는 인덱스와 같다.
+ *
+ * 한 스레드의 대역폭이 메모리 대역폭보다 작은 큰 배열(수천만 개 이상)용이며,
+ * PARALLEL_SEARCH_MIN_SIZE보다 작으면 스레드를 만들지 않고 바로 sequential_search를 쓴다.
+ * 멀티 소켓에서는 배열 페이지가 처음 쓴 스레드의 노드에 놓이므로(first touch),
+ * 배열도 여러 스레드가 나눠 초기화해야 모든 소켓의 대역폭을 쓸 수 있다.
+ */
+
+#define PARALLEL_SEARCH_BLOCK (64 * 1024)          /* 블록 크기 (원소 수, 256KB) */
+#define PARALLEL_SEARCH_MIN_SIZE (1024 * 1024)     /* 이보다 작으면 단일 스레드 */
+#define PARALLEL_SEARCH_MAX_THREADS 256
+
+/**
+ * 병렬 순차 탐색
+ * @param arr: 검색할 정수 배열
+ * @param size: 배열의 크기
+ * @param target: 찾을 값
+ * @param num_threads: 사용할 스레드 수 (0 이하이면 온라인 CPU 수)
+ * @return: 처음 일치하는 인덱스, 없으면 -1 (sequential_search와 동일)
+ */
+int parallel_sequential_search(const int *arr, int size, int target, int num_threads);
+
+#endif // PARALLEL_SEARCH_H
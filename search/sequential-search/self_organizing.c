@@ -0,0 +1,206 @@
+#include "self_organizing.h"
+#include <string.h>
+
+SelfOrganizingList *build_self_organizing_list(const int *arr, int size, ReorderPolicy policy)
+{
+  if (size < 0 || (size > 0 && arr == NULL))
+  {
+    return NULL;
+  }
+
+  SelfOrganizingList *list = (SelfOrganizingList *)malloc(sizeof(SelfOrganizingList));
+  size_t count = size > 0 ? (size_t)size : 1;
+  int *keys = (int *)malloc(count * sizeof(int));
+  int *positions = (int *)malloc(count * sizeof(int));
+  uint32_t *counts = policy == REORDER_COUNT ? (uint32_t *)calloc(count, sizeof(uint32_t)) : NULL;
+  if (list == NULL || keys == NULL || positions == NULL || (policy == REORDER_COUNT && counts == NULL))
+  {
+    free(list);
+    free(keys);
+    free(positions);
+    free(counts);
+    return NULL;
+  }
+
+  for (int i = 0; i < size; i++)
+  {
+    keys[i] = arr[i];
+    positions[i] = i;
+  }
+  list->keys = keys;
+  list->positions = positions;
+  list->counts = counts;
+  list->size = size;
+  list->policy = policy;
+  list->comparisons = 0;
+  return list;
+}
+
+void free_self_organizing_list(SelfOrganizingList *list)
+{
+  if (list == NULL)
+  {
+    return;
+  }
+  free(list->keys);
+  free(list->positions);
+  free(list->counts);
+  free(list);
+}
+
+/* [to, from) 구간을 한 칸 뒤로 밀고 from의 원소를 to에 놓음 */
+static void move_forward(SelfOrganizingList *list, int from, int to)
+{
+  int key = list->keys[from];
+  int position = list->positions[from];
+  size_t shift = (size_t)(from - to);
+  memmove(list->keys + to + 1, list->keys + to, shift * sizeof(int));
+  memmove(list->positions + to + 1, list->positions + to, shift * sizeof(int));
+  list->keys[to] = key;
+  list->positions[to] = position;
+
+  if (list->counts != NULL)
+  {
+    uint32_t hits = list->counts[from];
+    memmove(list->counts + to + 1, list->counts + to, shift * sizeof(uint32_t));
+    list->counts[to] = hits;
+  }
+}
+
+/* 두 자리의 원소 교환 */
+static void swap_entries(SelfOrganizingList *list, int a, int b)
+{
+  int key = list->keys[a];
+  list->keys[a] = list->keys[b];
+  list->keys[b] = key;
+  int position = list->positions[a];
+  list->positions[a] = list->positions[b];
+  list->positions[b] = position;
+  uint32_t hits = list->counts[a];
+  list->counts[a] = list->counts[b];
+  list->counts[b] = hits;
+}
+
+/*
+ * COUNT 정책: 횟수를 올리고 순서를 유지
+ *
+ * 불변식: 창 밖 [W, size)는 횟수 내림차순이고, 창 안 원소의 횟수는 모두 counts[W] 이상
+ * (창 안끼리는 순서가 섞여도 됨, 창 안에서 찾으면 횟수만 올림).
+ * 1. 창 밖에서 찾으면 [W, index)에서 횟수가 더 적은 첫 자리로 이동 (이진 탐색)
+ * 2. 창 경계(W)까지 왔고 창 안에 횟수가 더 적은 원소가 있으면 그 원소와 자리를 바꾼다.
+ *    밀려난 원소의 횟수는 불변식에 따라 W 뒤의 모든 횟수 이상이라 W 자리가 곧 내림차순 자리다.
+ * 같은 횟수 앞으로는 가지 않는다. 같은 값의 뒤쪽 원소는 찾히지 않아 횟수가 항상 0이므로
+ * 창 안에서 횟수가 가장 적은 원소 중 가장 뒤의 것을 내보내면 같은 값의 앞뒤가 바뀌지 않는다.
+ * 횟수가 UINT32_MAX에 닿으면 모두 절반으로 줄인다 (순서는 그대로, 오래된 빈도는 약해짐).
+ */
+static void count_hit(SelfOrganizingList *list, int index)
+{
+  uint32_t *counts = list->counts;
+  if (counts[index] == UINT32_MAX)
+  {
+    for (int i = 0; i < list->size; i++)
+    {
+      counts[i] >>= 1;
+    }
+  }
+  uint32_t hits = ++counts[index];
+  if (index < SELF_ORGANIZING_WINDOW)
+  {
+    return;
+  }
+
+  int lo = SELF_ORGANIZING_WINDOW, hi = index;
+  while (lo < hi)
+  {
+    int mid = (lo + hi) / 2;
+    if (counts[mid] < hits)
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+  if (lo < index)
+  {
+    move_forward(list, index, lo);
+  }
+  if (lo > SELF_ORGANIZING_WINDOW)
+  {
+    return;
+  }
+
+  int coldest = SELF_ORGANIZING_WINDOW - 1;
+  for (int i = SELF_ORGANIZING_WINDOW - 2; i >= 0; i--)
+  {
+    if (counts[i] < counts[coldest])
+    {
+      coldest = i;
+    }
+  }
+  if (counts[coldest] >= hits)
+  {
+    return;
+  }
+  swap_entries(list, coldest, SELF_ORGANIZING_WINDOW);
+}
+
+/**
+ * 자기 조직화 탐색
+ * 시간 복잡도: 찾은 위치 p에 대해 O(p) (탐색 p + 1번 비교, 재배치 최대 p칸 이동)
+ * 창(SELF_ORGANIZING_WINDOW) 안에서 찾으면 옮기지 않는다.
+ */
+int self_organizing_search(SelfOrganizingList *list, int target)
+{
+  if (list == NULL || list->size <= 0)
+  {
+    return -1;
+  }
+
+  int index = sequential_search(list->keys, list->size, target);
+  if (index < 0)
+  {
+    list->comparisons += list->size;
+    return -1;
+  }
+  list->comparisons += index + 1;
+  int position = list->positions[index];
+
+  switch (list->policy)
+  {
+  case REORDER_MOVE_TO_FRONT:
+    if (index >= SELF_ORGANIZING_WINDOW)
+    {
+      move_forward(list, index, 0);
+    }
+    break;
+  case REORDER_TRANSPOSE:
+    if (index >= SELF_ORGANIZING_WINDOW)
+    {
+      move_forward(list, index, index - 1);
+    }
+    break;
+  case REORDER_COUNT:
+    count_hit(list, index);
+    break;
+  default:
+    break;
+  }
+  return position;
+}
+
+const char *reorder_policy_name(ReorderPolicy policy)
+{
+  switch (policy)
+  {
+  case REORDER_MOVE_TO_FRONT:
+    return "move-to-front";
+  case REORDER_TRANSPOSE:
+    return "transpose";
+  case REORDER_COUNT:
+    return "count";
+  default:
+    return "static";
+  }
+}
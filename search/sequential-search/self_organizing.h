@@ -0,0 +1,63 @@
+#ifndef SELF_ORGANIZING_H
+#define SELF_ORGANIZING_H
+
+#include <stdint.h>
+#include "sequential_search.h"
+
+/*
+ * 자기 조직화 리스트 (self-organizing list)
+ *
+ * 조회 키가 Zipf 분포처럼 몇 개에 몰리면 앞에서부터 훑는 순차 탐색은
+ * 뒤쪽에 놓인 자주 찾는 값까지 매번 차가운 원소를 지나간다.
+ * 찾을 때마다 찾은 원소를 앞쪽으로 옮겨서 자주 찾는 값이 앞에 모이게 한다.
+ *
+ * 정책
+ *   MOVE_TO_FRONT: 찾은 원소를 맨 앞으로 (분포가 바뀌어도 빨리 따라감)
+ *   TRANSPOSE:     찾은 원소를 바로 앞 원소와 교환 (천천히 수렴, 한 번의 우연에 덜 흔들림)
+ *   COUNT:         찾은 횟수를 세고, 창 밖은 횟수 내림차순으로 유지
+ *                  (창 안 원소는 창 밖 어느 원소보다 횟수가 적지 않음)
+ *
+ * 키는 int 배열에 그대로 두므로 탐색은 sequential_search의 SIMD 커널을 쓴다.
+ * SIMD 탐색은 원소당 비용이 매우 작아서, 재배치(찾은 위치까지 memmove)가 줄인 비교보다
+ * 비쌀 수 있다. 그래서 앞쪽 SELF_ORGANIZING_WINDOW개 안에서 찾으면 옮기지 않는다.
+ * 결과는 원래 배열 기준 인덱스로 돌려주므로 sequential_search와 같다
+ * (같은 값끼리는 앞뒤가 바뀌지 않아 항상 처음 나온 원소가 먼저 찾힌다).
+ */
+
+/* 재배치하지 않는 앞쪽 원소 수: int 64개 = 256바이트, AVX-512 커널의 한 반복 */
+#define SELF_ORGANIZING_WINDOW 64
+
+typedef enum ReorderPolicy
+{
+  REORDER_NONE,          /* 재배치 없음 (비교용) */
+  REORDER_MOVE_TO_FRONT, /* 맨 앞으로 */
+  REORDER_TRANSPOSE,     /* 한 칸 앞으로 */
+  REORDER_COUNT          /* 찾은 횟수 순 */
+} ReorderPolicy;
+
+typedef struct SelfOrganizingList
+{
+  int *keys;            /* 현재 순서의 키 */
+  int *positions;       /* keys[i]의 원래 배열 인덱스 */
+  uint32_t *counts;     /* keys[i]를 찾은 횟수 (COUNT 정책에서만, 아니면 NULL) */
+  int size;
+  ReorderPolicy policy;
+  long long comparisons; /* 지금까지 비교한 원소 수 (찾으면 위치 + 1, 없으면 size) */
+} SelfOrganizingList;
+
+/*
+ * 리스트 생성 (O(n), 배열은 복사하므로 원본은 바뀌지 않음)
+ * @return: 생성된 리스트 (메모리 부족이면 NULL)
+ */
+SelfOrganizingList *build_self_organizing_list(const int *arr, int size, ReorderPolicy policy);
+void free_self_organizing_list(SelfOrganizingList *list);
+
+/*
+ * target이 원래 배열에서 처음 나오는 인덱스, 없으면 -1
+ * 찾으면 정책에 따라 리스트 순서를 바꾼다.
+ */
+int self_organizing_search(SelfOrganizingList *list, int target);
+
+const char *reorder_policy_name(ReorderPolicy policy);
+
+#endif // SELF_ORGANIZING_H
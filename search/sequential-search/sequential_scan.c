@@ -0,0 +1,302 @@
+#include "sequential_scan.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SCAN_HAVE_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+/*
+ * 조건은 모두 (unsigned)(x - lo) < width 형태
+ * 뺄셈이 넘쳐도 부호 없는 산술이라 정의된 동작이고, 범위 밖 값은 width 이상으로 감싸진다.
+ */
+
+/* [lo, hi)의 폭 (빈 범위면 0) */
+static unsigned int range_width(int lo, int hi)
+{
+  return hi > lo ? (unsigned int)hi - (unsigned int)lo : 0;
+}
+
+/* ---------- 스칼라 ---------- */
+
+static int count_scalar(const int *arr, int size, unsigned int lo, unsigned int width)
+{
+  int count = 0;
+  for (int i = 0; i < size; i++)
+  {
+    count += (unsigned int)arr[i] - lo < width;
+  }
+  return count;
+}
+
+/*
+ * 분기 없는 압축: 일단 out[n]에 쓰고 조건이 참일 때만 n을 전진
+ * 한 번에 남은 버퍼 크기만큼만 돌기 때문에 버퍼 밖에 쓰지 않는다.
+ * SIMD 커널의 나머지 부분도 여기서 처리한다 (i부터, 이미 n개 저장).
+ */
+static int find_scalar(const int *arr, int i, int size, unsigned int lo, unsigned int width, int *out,
+                       int n, int max_out)
+{
+  while (i < size && n < max_out)
+  {
+    int chunk = size - i < max_out - n ? size - i : max_out - n;
+    for (int end = i + chunk; i < end; i++)
+    {
+      out[n] = i;
+      n += (unsigned int)arr[i] - lo < width;
+    }
+  }
+  return n;
+}
+
+#ifdef SCAN_HAVE_X86_KERNELS
+
+/*
+ * SSE2/AVX2에는 부호 없는 비교가 없으므로 양쪽의 부호 비트를 뒤집어 부호 있는 비교로 바꾼다.
+ * (x - lo) <u width  <=>  (width ^ 0x80000000) >s ((x - lo) ^ 0x80000000)
+ */
+#define SIGN_BIT ((int)0x80000000u)
+
+/* SSE2 압축용 표: 4비트 마스크 -> 일치한 레인 번호를 앞으로 모은 것, 일치 개수 */
+static const int compact4[16][4] = {
+    {0, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0},
+    {2, 0, 0, 0}, {0, 2, 0, 0}, {1, 2, 0, 0}, {0, 1, 2, 0},
+    {3, 0, 0, 0}, {0, 3, 0, 0}, {1, 3, 0, 0}, {0, 1, 3, 0},
+    {2, 3, 0, 0}, {0, 2, 3, 0}, {1, 2, 3, 0}, {0, 1, 2, 3}};
+static const int popcount4[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+__attribute__((target("sse2"))) static int count_sse2(const int *arr, int size, unsigned int lo,
+                                                      unsigned int width)
+{
+  const __m128i base = _mm_set1_epi32((int)lo);
+  const __m128i bias = _mm_set1_epi32(SIGN_BIT);
+  const __m128i limit = _mm_set1_epi32((int)(width ^ 0x80000000u));
+  __m128i acc_a = _mm_setzero_si128();
+  __m128i acc_b = _mm_setzero_si128();
+  int i = 0;
+
+  // 일치한 레인은 -1이므로 빼서 레인별 개수를 누적 (누적기 2개로 의존 사슬 분리)
+  for (; i + 8 <= size; i += 8)
+  {
+    __m128i a = _mm_xor_si128(_mm_sub_epi32(_mm_loadu_si128((const __m128i *)(arr + i)), base), bias);
+    __m128i b = _mm_xor_si128(_mm_sub_epi32(_mm_loadu_si128((const __m128i *)(arr + i + 4)), base), bias);
+    acc_a = _mm_sub_epi32(acc_a, _mm_cmpgt_epi32(limit, a));
+    acc_b = _mm_sub_epi32(acc_b, _mm_cmpgt_epi32(limit, b));
+  }
+
+  int lanes[4];
+  _mm_storeu_si128((__m128i *)lanes, _mm_add_epi32(acc_a, acc_b));
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] + count_scalar(arr + i, size - i, lo, width);
+}
+
+__attribute__((target("sse2"))) static int find_sse2(const int *arr, int size, unsigned int lo,
+                                                     unsigned int width, int *out, int max_out)
+{
+  const __m128i base = _mm_set1_epi32((int)lo);
+  const __m128i bias = _mm_set1_epi32(SIGN_BIT);
+  const __m128i limit = _mm_set1_epi32((int)(width ^ 0x80000000u));
+  int i = 0;
+  int n = 0;
+
+  // 4개를 통째로 저장하므로 버퍼에 4칸 이상 남아 있을 때만
+  for (; i + 4 <= size && n + 4 <= max_out; i += 4)
+  {
+    __m128i x = _mm_xor_si128(_mm_sub_epi32(_mm_loadu_si128((const __m128i *)(arr + i)), base), bias);
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(limit, x)));
+    __m128i lanes = _mm_loadu_si128((const __m128i *)compact4[mask]);
+    _mm_storeu_si128((__m128i *)(out + n), _mm_add_epi32(_mm_set1_epi32(i), lanes));
+    n += popcount4[mask];
+  }
+  return find_scalar(arr, i, size, lo, width, out, n, max_out);
+}
+
+__attribute__((target("avx2"))) static int count_avx2(const int *arr, int size, unsigned int lo,
+                                                      unsigned int width)
+{
+  const __m256i base = _mm256_set1_epi32((int)lo);
+  const __m256i bias = _mm256_set1_epi32(SIGN_BIT);
+  const __m256i limit = _mm256_set1_epi32((int)(width ^ 0x80000000u));
+  __m256i acc_a = _mm256_setzero_si256();
+  __m256i acc_b = _mm256_setzero_si256();
+  int i = 0;
+
+  for (; i + 16 <= size; i += 16)
+  {
+    __m256i a = _mm256_xor_si256(_mm256_sub_epi32(_mm256_loadu_si256((const __m256i *)(arr + i)), base), bias);
+    __m256i b =
+        _mm256_xor_si256(_mm256_sub_epi32(_mm256_loadu_si256((const __m256i *)(arr + i + 8)), base), bias);
+    acc_a = _mm256_sub_epi32(acc_a, _mm256_cmpgt_epi32(limit, a));
+    acc_b = _mm256_sub_epi32(acc_b, _mm256_cmpgt_epi32(limit, b));
+  }
+
+  int lanes[8];
+  _mm256_storeu_si256((__m256i *)lanes, _mm256_add_epi32(acc_a, acc_b));
+  int count = 0;
+  for (int lane = 0; lane < 8; lane++)
+  {
+    count += lanes[lane];
+  }
+  return count + count_scalar(arr + i, size - i, lo, width);
+}
+
+#ifdef __x86_64__ /* 64비트 pdep/pext는 x86-64에만 있음 */
+
+/*
+ * 8비트 마스크로 순열 만들기 (표 없이)
+ * pdep로 마스크 비트를 바이트 단위로 펼친 뒤, pext로 레인 번호 0~7 중 일치한 것만 모은다.
+ * 모은 바이트를 32비트로 늘려 permutevar8x32의 인덱스로 쓴다.
+ */
+__attribute__((target("avx2,bmi2,popcnt"))) static int find_avx2(const int *arr, int size, unsigned int lo,
+                                                                  unsigned int width, int *out, int max_out)
+{
+  const __m256i base = _mm256_set1_epi32((int)lo);
+  const __m256i bias = _mm256_set1_epi32(SIGN_BIT);
+  const __m256i limit = _mm256_set1_epi32((int)(width ^ 0x80000000u));
+  const __m256i step = _mm256_set1_epi32(8);
+  __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  int i = 0;
+  int n = 0;
+
+  for (; i + 8 <= size && n + 8 <= max_out; i += 8)
+  {
+    __m256i x = _mm256_xor_si256(_mm256_sub_epi32(_mm256_loadu_si256((const __m256i *)(arr + i)), base), bias);
+    unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(limit, x)));
+    unsigned long long spread = _pdep_u64(mask, 0x0101010101010101ULL) * 0xFF;
+    unsigned long long wanted = _pext_u64(0x0706050403020100ULL, spread);
+    __m256i order = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((long long)wanted));
+    _mm256_storeu_si256((__m256i *)(out + n), _mm256_permutevar8x32_epi32(index, order));
+    n += __builtin_popcount(mask);
+    index = _mm256_add_epi32(index, step);
+  }
+  return find_scalar(arr, i, size, lo, width, out, n, max_out);
+}
+
+#endif // __x86_64__
+
+/* AVX-512F: 부호 없는 비교가 있고, 비교 결과가 바로 마스크 레지스터 */
+__attribute__((target("avx512f,popcnt"))) static int count_avx512(const int *arr, int size, unsigned int lo,
+                                                                  unsigned int width)
+{
+  const __m512i base = _mm512_set1_epi32((int)lo);
+  const __m512i limit = _mm512_set1_epi32((int)width);
+  int count = 0;
+  int i = 0;
+
+  for (; i + 32 <= size; i += 32)
+  {
+    __mmask16 a = _mm512_cmplt_epu32_mask(_mm512_sub_epi32(_mm512_loadu_si512(arr + i), base), limit);
+    __mmask16 b = _mm512_cmplt_epu32_mask(_mm512_sub_epi32(_mm512_loadu_si512(arr + i + 16), base), limit);
+    count += __builtin_popcount(a) + __builtin_popcount(b);
+  }
+  return count + count_scalar(arr + i, size - i, lo, width);
+}
+
+/*
+ * compress로 일치한 레인만 앞으로 모은 뒤 16개를 통째로 저장
+ * compressstoreu(메모리로 바로 압축)는 일부 CPU(Zen 4)에서 마이크로코드라 매우 느려서
+ * 레지스터에서 압축하고 일반 저장을 쓴다.
+ */
+__attribute__((target("avx512f,popcnt"))) static int find_avx512(const int *arr, int size, unsigned int lo,
+                                                                 unsigned int width, int *out, int max_out)
+{
+  const __m512i base = _mm512_set1_epi32((int)lo);
+  const __m512i limit = _mm512_set1_epi32((int)width);
+  const __m512i step = _mm512_set1_epi32(16);
+  __m512i index = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  int i = 0;
+  int n = 0;
+
+  for (; i + 16 <= size && n + 16 <= max_out; i += 16)
+  {
+    __mmask16 mask = _mm512_cmplt_epu32_mask(_mm512_sub_epi32(_mm512_loadu_si512(arr + i), base), limit);
+    _mm512_storeu_si512(out + n, _mm512_maskz_compress_epi32(mask, index));
+    n += __builtin_popcount(mask);
+    index = _mm512_add_epi32(index, step);
+  }
+  return find_scalar(arr, i, size, lo, width, out, n, max_out);
+}
+
+#endif // SCAN_HAVE_X86_KERNELS
+
+/* ---------- 커널 선택 (sequential_search와 같은 커널) ---------- */
+
+static int count_in_range(const int *arr, int size, unsigned int lo, unsigned int width)
+{
+  if (arr == NULL || size <= 0 || width == 0)
+  {
+    return 0;
+  }
+
+  switch (sequential_search_kernel())
+  {
+#ifdef SCAN_HAVE_X86_KERNELS
+  case SEARCH_KERNEL_AVX512:
+    return count_avx512(arr, size, lo, width);
+  case SEARCH_KERNEL_AVX2:
+    return count_avx2(arr, size, lo, width);
+  case SEARCH_KERNEL_SSE2:
+    return count_sse2(arr, size, lo, width);
+#endif
+  default:
+    return count_scalar(arr, size, lo, width);
+  }
+}
+
+static int find_in_range(const int *arr, int size, unsigned int lo, unsigned int width, int *out, int max_out)
+{
+  if (arr == NULL || size <= 0 || width == 0 || out == NULL || max_out <= 0)
+  {
+    return 0;
+  }
+
+  switch (sequential_search_kernel())
+  {
+#ifdef SCAN_HAVE_X86_KERNELS
+  case SEARCH_KERNEL_AVX512:
+    return find_avx512(arr, size, lo, width, out, max_out);
+  case SEARCH_KERNEL_AVX2:
+#ifdef __x86_64__
+    // BMI2(pdep/pext)가 없으면 SSE2 압축으로
+    if (__builtin_cpu_supports("bmi2"))
+    {
+      return find_avx2(arr, size, lo, width, out, max_out);
+    }
+#endif
+    return find_sse2(arr, size, lo, width, out, max_out);
+  case SEARCH_KERNEL_SSE2:
+    return find_sse2(arr, size, lo, width, out, max_out);
+#endif
+  default:
+    return find_scalar(arr, 0, size, lo, width, out, 0, max_out);
+  }
+}
+
+/**
+ * 같은 값 개수
+ * 시간 복잡도: O(n), 처음 일치에서 멈추지 않으므로 항상 배열 전체를 읽는다.
+ */
+int sequential_count(const int *arr, int size, int target)
+{
+  return count_in_range(arr, size, (unsigned int)target, 1);
+}
+
+/* 범위 안의 원소 개수 */
+int sequential_count_range(const int *arr, int size, int lo, int hi)
+{
+  return count_in_range(arr, size, (unsigned int)lo, range_width(lo, hi));
+}
+
+/**
+ * 같은 값의 모든 위치
+ * 시간 복잡도: O(n), 일치 개수와 상관없이 분기 예측 실패가 없다.
+ * (if로 골라 쓰면 일치 비율이 50% 근처일 때 원소마다 예측이 빗나간다)
+ */
+int sequential_find_all(const int *arr, int size, int target, int *out_idx, int max_out)
+{
+  return find_in_range(arr, size, (unsigned int)target, 1, out_idx, max_out);
+}
+
+/* 범위 안의 원소 위치 */
+int sequential_find_range(const int *arr, int size, int lo, int hi, int *out_idx, int max_out)
+{
+  return find_in_range(arr, size, (unsigned int)lo, range_width(lo, hi), out_idx, max_out);
+}
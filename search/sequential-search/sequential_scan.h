@@ -0,0 +1,47 @@
+#ifndef SEQUENTIAL_SCAN_H
+#define SEQUENTIAL_SCAN_H
+
+#include "sequential_search.h"
+
+/*
+ * 처음 일치 외의 순차 스캔: 개수 세기, 모든 위치 찾기, 범위 조건 (lo <= x < hi)
+ *
+ * 모든 조건을 (unsigned)(x - lo) < (unsigned)(hi - lo) 하나로 바꿔서 검사한다.
+ * 같은 값 찾기는 [target, target + 1) 범위이고, hi <= lo면 빈 범위가 된다.
+ * 커널은 sequential_search와 같은 것을 쓴다 (sequential_search_set_kernel로 바꾸면 같이 바뀜).
+ *
+ * 위치 찾기는 원소마다 분기하지 않고 스트림 압축(compaction)으로 쓴다.
+ * 비교 마스크로 일치한 레인의 인덱스만 앞으로 모아 한 번에 저장하고
+ * 쓰기 위치는 popcount만큼 전진한다.
+ * - SSE2: 4비트 마스크 -> 16개짜리 인덱스 표
+ * - AVX2: 8비트 마스크 -> pdep/pext로 순열을 만들어 permutevar8x32 (BMI2 필요)
+ * - AVX-512: compress로 일치한 레인만 모아 저장
+ */
+
+/**
+ * 같은 값 개수
+ * @return: arr에서 target과 같은 원소 수
+ */
+int sequential_count(const int *arr, int size, int target);
+
+/**
+ * 범위 안의 원소 개수
+ * @return: lo <= arr[i] < hi인 원소 수 (hi <= lo면 0)
+ */
+int sequential_count_range(const int *arr, int size, int lo, int hi);
+
+/**
+ * 같은 값의 모든 위치
+ * @param out_idx: 인덱스를 오름차순으로 저장할 버퍼
+ * @param max_out: 버퍼 크기 (가득 차면 거기서 멈춤)
+ * @return: 저장한 인덱스 수
+ */
+int sequential_find_all(const int *arr, int size, int target, int *out_idx, int max_out);
+
+/**
+ * 범위 안의 원소 위치 (lo <= arr[i] < hi)
+ * @return: 저장한 인덱스 수 (sequential_find_all과 같은 규칙)
+ */
+int sequential_find_range(const int *arr, int size, int lo, int hi, int *out_idx, int max_out);
+
+#endif // SEQUENTIAL_SCAN_H
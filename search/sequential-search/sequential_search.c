@@ -1,7 +1,23 @@
 #include "sequential_search.h"
+#include <stdatomic.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SEARCH_HAVE_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+typedef int (*SearchFunc)(const int *arr, int size, int target);
+
+/*
+ * 현재 커널 (KERNEL_UNSELECTED면 아직 고르지 않음)
+ * 커널 값 하나만 원자적으로 저장하고 함수 포인터는 여기서 정하므로 둘이 어긋나지 않는다.
+ * 다른 데이터를 넘겨주는 값이 아니라서 relaxed로 충분하다.
+ */
+#define KERNEL_UNSELECTED (-1)
+static _Atomic int active_kernel = KERNEL_UNSELECTED;
 
 /**
- * 순차 탐색 알고리즘 구현
+ * 순차 탐색 알고리즘 구현 (스칼라)
  *
  * 시간 복잡도:
  * - 최선: O(1) - 첫번째 원소가 타겟
@@ -15,7 +31,7 @@
  * @param target: 찾을 값
  * @return: 찾은 경우 인덱스, 없으면 -1
  */
-int sequential_search(int *arr, int size, int target)
+int sequential_search_scalar(const int *arr, int size, int target)
 {
   // 빈 배열 처리
   if (arr == NULL || size <= 0)
@@ -36,6 +52,432 @@ int sequential_search(int *arr, int size, int target)
   return -1;
 }
 
+#ifdef SEARCH_HAVE_X86_KERNELS
+
+/*
+ * SIMD 커널 공통 구조
+ * 1. target을 모든 레인에 복사
+ * 2. 벡터 4개(= 레인 수 x 4개 원소)를 비교하고 결과를 OR해서 한 번만 분기
+ * 3. 어딘가 일치하면 벡터별 movemask의 가장 낮은 비트(ctz)로 첫 위치 계산
+ * 4. 남은 원소는 벡터 1개 단위, 마지막은 스칼라 (AVX-512는 마스크 로드)
+ * 각 함수는 target 속성으로 해당 명령어 집합만 켜서 컴파일되므로
+ * -mavx2 없이 빌드해도 되고, 지원하지 않는 CPU에서는 호출되지 않는다.
+ */
+
+__attribute__((target("sse2"))) static int search_sse2(const int *arr, int size, int target)
+{
+  const __m128i needle = _mm_set1_epi32(target);
+  int i = 0;
+
+  for (; i + 16 <= size; i += 16)
+  {
+    __m128i a = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(arr + i)), needle);
+    __m128i b = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(arr + i + 4)), needle);
+    __m128i c = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(arr + i + 8)), needle);
+    __m128i d = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(arr + i + 12)), needle);
+    __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+    if (_mm_movemask_epi8(any) != 0)
+    {
+      // 원소 4개 x 레인 4개 마스크를 16비트 하나로 합침
+      unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(a)) |
+                          (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(b)) << 4 |
+                          (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(c)) << 8 |
+                          (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(d)) << 12;
+      return i + __builtin_ctz(mask);
+    }
+  }
+
+  for (; i + 4 <= size; i += 4)
+  {
+    __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(arr + i)), needle);
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+    if (mask != 0)
+    {
+      return i + __builtin_ctz((unsigned int)mask);
+    }
+  }
+
+  for (; i < size; i++)
+  {
+    if (arr[i] == target)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+__attribute__((target("avx2"))) static int search_avx2(const int *arr, int size, int target)
+{
+  const __m256i needle = _mm256_set1_epi32(target);
+  int i = 0;
+
+  for (; i + 32 <= size; i += 32)
+  {
+    __m256i a = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(arr + i)), needle);
+    __m256i b = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(arr + i + 8)), needle);
+    __m256i c = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(arr + i + 16)), needle);
+    __m256i d = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(arr + i + 24)), needle);
+    __m256i any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+    if (!_mm256_testz_si256(any, any))
+    {
+      unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(a)) |
+                          (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(b)) << 8 |
+                          (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(c)) << 16 |
+                          (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(d)) << 24;
+      return i + __builtin_ctz(mask);
+    }
+  }
+
+  for (; i + 8 <= size; i += 8)
+  {
+    __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(arr + i)), needle);
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+    if (mask != 0)
+    {
+      return i + __builtin_ctz((unsigned int)mask);
+    }
+  }
+
+  for (; i < size; i++)
+  {
+    if (arr[i] == target)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/* AVX-512F: 비교 결과가 바로 16비트 마스크 레지스터로 나오므로 movemask가 필요 없다 */
+__attribute__((target("avx512f"))) static int search_avx512(const int *arr, int size, int target)
+{
+  const __m512i needle = _mm512_set1_epi32(target);
+  int i = 0;
+
+  for (; i + 64 <= size; i += 64)
+  {
+    __mmask16 a = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(arr + i), needle);
+    __mmask16 b = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(arr + i + 16), needle);
+    __mmask16 c = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(arr + i + 32), needle);
+    __mmask16 d = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(arr + i + 48), needle);
+    if ((a | b | c | d) != 0)
+    {
+      unsigned long long mask = (unsigned long long)a | (unsigned long long)b << 16 |
+                                (unsigned long long)c << 32 | (unsigned long long)d << 48;
+      return i + __builtin_ctzll(mask);
+    }
+  }
+
+  // 남은 원소 (최대 63개): 16개씩, 마지막은 마스크 로드로 배열 밖을 읽지 않음
+  for (; i < size; i += 16)
+  {
+    int remaining = size - i;
+    __mmask16 valid = remaining >= 16 ? (__mmask16)0xFFFF : (__mmask16)((1u << remaining) - 1);
+    __m512i values = _mm512_maskz_loadu_epi32(valid, arr + i);
+    __mmask16 eq = _mm512_mask_cmpeq_epi32_mask(valid, values, needle);
+    if (eq != 0)
+    {
+      return i + __builtin_ctz((unsigned int)eq);
+    }
+  }
+  return -1;
+}
+
+#endif // SEARCH_HAVE_X86_KERNELS
+
+/**
+ * 커널 지원 여부 (CPUID로 확인)
+ * __builtin_cpu_supports는 CPUID 비트와 함께 OS가 해당 레지스터를
+ * 저장/복원하는지(XGETBV)도 확인한다.
+ */
+bool sequential_search_supports(SearchKernel kernel)
+{
+  switch (kernel)
+  {
+  case SEARCH_KERNEL_SCALAR:
+    return true;
+#ifdef SEARCH_HAVE_X86_KERNELS
+  case SEARCH_KERNEL_SSE2:
+    return __builtin_cpu_supports("sse2");
+  case SEARCH_KERNEL_AVX2:
+    return __builtin_cpu_supports("avx2");
+  case SEARCH_KERNEL_AVX512:
+    return __builtin_cpu_supports("avx512f");
+#endif
+  default:
+    return false;
+  }
+}
+
+/**
+ * 사용할 커널 지정
+ * @return: 지원하지 않는 커널이면 false (기존 커널 유지)
+ */
+bool sequential_search_set_kernel(SearchKernel kernel)
+{
+  if (!sequential_search_supports(kernel))
+  {
+    return false;
+  }
+  atomic_store_explicit(&active_kernel, (int)kernel, memory_order_relaxed);
+  return true;
+}
+
+/* 커널에 해당하는 함수 */
+static SearchFunc kernel_function(SearchKernel kernel)
+{
+  switch (kernel)
+  {
+#ifdef SEARCH_HAVE_X86_KERNELS
+  case SEARCH_KERNEL_SSE2:
+    return search_sse2;
+  case SEARCH_KERNEL_AVX2:
+    return search_avx2;
+  case SEARCH_KERNEL_AVX512:
+    return search_avx512;
+#endif
+  default:
+    return sequential_search_scalar;
+  }
+}
+
+/* 지원하는 가장 넓은 커널 */
+static SearchKernel best_kernel(void)
+{
+  SearchKernel order[] = {SEARCH_KERNEL_AVX512, SEARCH_KERNEL_AVX2, SEARCH_KERNEL_SSE2};
+  for (int i = 0; i < 3; i++)
+  {
+    if (sequential_search_supports(order[i]))
+    {
+      return order[i];
+    }
+  }
+  return SEARCH_KERNEL_SCALAR;
+}
+
+/*
+ * 현재 커널 (아직 고르지 않았으면 지금 고름)
+ * 처음 호출이 겹치면 compare-exchange에서 이긴 한 스레드의 값만 남고,
+ * 그 사이에 sequential_search_set_kernel로 정한 값도 덮어쓰지 않는다.
+ */
+SearchKernel sequential_search_kernel(void)
+{
+  int kernel = atomic_load_explicit(&active_kernel, memory_order_relaxed);
+  if (kernel == KERNEL_UNSELECTED)
+  {
+    int expected = KERNEL_UNSELECTED;
+    kernel = (int)best_kernel();
+    if (!atomic_compare_exchange_strong_explicit(&active_kernel, &expected, kernel, memory_order_relaxed,
+                                                 memory_order_relaxed))
+    {
+      kernel = expected;
+    }
+  }
+  return (SearchKernel)kernel;
+}
+
+const char *search_kernel_name(SearchKernel kernel)
+{
+  switch (kernel)
+  {
+  case SEARCH_KERNEL_SSE2:
+    return "SSE2";
+  case SEARCH_KERNEL_AVX2:
+    return "AVX2";
+  case SEARCH_KERNEL_AVX512:
+    return "AVX-512";
+  default:
+    return "scalar";
+  }
+}
+
+/**
+ * 순차 탐색 (SIMD 커널로 분기)
+ * 반환값은 스칼라 구현과 같다: 처음 일치하는 인덱스, 없으면 -1.
+ * 커널은 처음 호출 때 한 번 고른다 (sequential_search_kernel 참고).
+ *
+ * @param arr: 검색할 정수 배열
+ * @param size: 배열의 크기
+ * @param target: 찾을 값
+ * @return: 찾은 경우 인덱스, 없으면 -1
+ */
+int sequential_search(int *arr, int size, int target)
+{
+  // 빈 배열 처리
+  if (arr == NULL || size <= 0)
+  {
+    return -1;
+  }
+
+  return kernel_function(sequential_search_kernel())(arr, size, target);
+}
+
+/* ---------- 여러 값 한 번에 탐색 ---------- */
+
+/* 블록 크기 (원소 수): 16KB라 target 수만큼 다시 읽어도 L1에서 읽힌다 */
+#define MANY_BLOCK 4096
+
+/*
+ * target이 적을 때: 블록 단위로 돌며, 아직 못 찾은 target마다 SIMD 커널로 블록을 훑음
+ * 같은 블록을 k번 읽지만 L1에 있으므로 메모리 트래픽은 배열 한 번 분량이다.
+ */
+static int search_many_blocked(const int *arr, int size, const int *targets, int k, int *out_idx)
+{
+  SearchFunc search_impl = kernel_function(sequential_search_kernel());
+  int remaining = k;
+  for (int j = 0; j < k; j++)
+  {
+    out_idx[j] = -1;
+  }
+
+  for (int start = 0; start < size && remaining > 0; start += MANY_BLOCK)
+  {
+    int length = size - start < MANY_BLOCK ? size - start : MANY_BLOCK;
+    for (int j = 0; j < k; j++)
+    {
+      if (out_idx[j] >= 0)
+      {
+        continue;
+      }
+      int index = search_impl(arr + start, length, targets[j]);
+      if (index >= 0)
+      {
+        out_idx[j] = start + index;
+        remaining--;
+      }
+    }
+  }
+  return k - remaining;
+}
+
+/* 곱셈 해시 (상위 비트 사용) */
+static unsigned int hash_target(int value, int shift)
+{
+  return ((unsigned int)value * 2654435769u) >> shift;
+}
+
+/*
+ * target이 많을 때: 서로 다른 target들로 선형 탐사 해시 집합을 만들고
+ * 배열 원소마다 한 번 조회해서 처음 나온 위치를 기록한다.
+ * 모든 target을 찾으면 순회를 멈춘다.
+ * @return: 찾은 target 수, 메모리 할당 실패 시 -1
+ */
+static int search_many_hashed(const int *arr, int size, const int *targets, int k, int *out_idx)
+{
+  // 용량: 2k 이상인 2의 거듭제곱 (채움률 50% 이하)
+  int bits = 1;
+  while ((1 << bits) < 2 * k)
+  {
+    bits++;
+  }
+  int capacity = 1 << bits;
+  int shift = 32 - bits;
+
+  int *keys = (int *)malloc(capacity * sizeof(int));
+  int *first = (int *)malloc(capacity * sizeof(int)); /* -2: 빈 칸, -1: 아직 못 찾음 */
+  if (keys == NULL || first == NULL)
+  {
+    free(keys);
+    free(first);
+    return -1;
+  }
+  for (int i = 0; i < capacity; i++)
+  {
+    first[i] = -2;
+  }
+
+  int distinct = 0;
+  for (int j = 0; j < k; j++)
+  {
+    unsigned int slot = hash_target(targets[j], shift);
+    while (first[slot] != -2 && keys[slot] != targets[j])
+    {
+      slot = (slot + 1) & (capacity - 1);
+    }
+    if (first[slot] == -2)
+    {
+      keys[slot] = targets[j];
+      first[slot] = -1;
+      distinct++;
+    }
+  }
+
+  int remaining = distinct;
+  for (int i = 0; i < size && remaining > 0; i++)
+  {
+    unsigned int slot = hash_target(arr[i], shift);
+    while (first[slot] != -2)
+    {
+      if (keys[slot] == arr[i])
+      {
+        if (first[slot] == -1)
+        {
+          first[slot] = i;
+          remaining--;
+        }
+        break;
+      }
+      slot = (slot + 1) & (capacity - 1);
+    }
+  }
+
+  int found = 0;
+  for (int j = 0; j < k; j++)
+  {
+    unsigned int slot = hash_target(targets[j], shift);
+    while (keys[slot] != targets[j])
+    {
+      slot = (slot + 1) & (capacity - 1);
+    }
+    out_idx[j] = first[slot];
+    found += first[slot] >= 0;
+  }
+
+  free(keys);
+  free(first);
+  return found;
+}
+
+/**
+ * 여러 값을 한 번의 순회로 탐색
+ * @param arr: 검색할 정수 배열
+ * @param size: 배열의 크기
+ * @param targets: 찾을 값들 (중복 가능)
+ * @param k: 찾을 값의 개수
+ * @param out_idx: 결과 (k개, 각 target의 첫 인덱스 또는 -1)
+ * @return: 찾은 target 수
+ *
+ * 시간 복잡도: O(n + k) (target이 적을 때는 O(n * k / 레인 수)지만 L1 안에서 처리)
+ * 비교: sequential_search를 k번 부르면 배열을 k번 메모리에서 읽는다.
+ */
+int sequential_search_many(const int *arr, int size, const int *targets, int k, int *out_idx)
+{
+  if (targets == NULL || out_idx == NULL || k <= 0)
+  {
+    return 0;
+  }
+  if (arr == NULL || size <= 0)
+  {
+    for (int j = 0; j < k; j++)
+    {
+      out_idx[j] = -1;
+    }
+    return 0;
+  }
+
+  if (k > SEQUENTIAL_SEARCH_MANY_BLOCKED_MAX)
+  {
+    int found = search_many_hashed(arr, size, targets, k, out_idx);
+    if (found >= 0)
+    {
+      return found;
+    }
+    // 해시 집합 할당 실패: 블록 방식으로 (느리지만 결과는 같음)
+  }
+  return search_many_blocked(arr, size, targets, k, out_idx);
+}
+
 /**
  * 배열 출력
  */
@@ -57,4 +499,4 @@ void print_array(int *arr, int size)
     }
   }
   printf("]");
-}
\ No newline at end of file
+}
@@ -3,6 +3,20 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdbool.h>
+
+/*
+ * 비교 커널 종류
+ * sequential_search는 처음 호출될 때 CPU가 지원하는 가장 넓은 커널을 고른다.
+ * (x86이 아니거나 GCC/Clang이 아니면 항상 스칼라)
+ */
+typedef enum SearchKernel
+{
+  SEARCH_KERNEL_SCALAR, /* 한 번에 1개 */
+  SEARCH_KERNEL_SSE2,   /* 128비트, 한 번에 4개 */
+  SEARCH_KERNEL_AVX2,   /* 256비트, 한 번에 8개 */
+  SEARCH_KERNEL_AVX512  /* 512비트, 한 번에 16개 */
+} SearchKernel;
 
 /**
  * 순차 탐색 함수
@@ -13,6 +27,33 @@
  */
 int sequential_search(int *arr, int size, int target);
 
+/*
+ * 여러 값을 한 번의 배열 순회로 탐색
+ * out_idx[j] = targets[j]가 처음 나오는 인덱스, 없으면 -1
+ * @return: 찾은 target 수
+ *
+ * k가 SEQUENTIAL_SEARCH_MANY_BLOCKED_MAX 이하이면 배열을 L1 크기 블록으로 나눠
+ * 블록마다 모든 target을 SIMD 커널로 비교하고, 그보다 많으면 target 해시 집합을
+ * 만들어 원소마다 한 번씩 조회한다. 어느 쪽이든 배열은 메모리에서 한 번만 읽는다.
+ * 경계값은 AVX-512에서 두 방식이 비슷해지는 k(약 64)의 절반 (좁은 커널 고려)
+ */
+#define SEQUENTIAL_SEARCH_MANY_BLOCKED_MAX 32
+int sequential_search_many(const int *arr, int size, const int *targets, int k, int *out_idx);
+
+/* 스칼라 구현 (SIMD 커널의 기준, 반환값은 sequential_search와 동일) */
+int sequential_search_scalar(const int *arr, int size, int target);
+
+/*
+ * 커널 선택
+ * sequential_search_kernel: 현재 쓰는 커널
+ * sequential_search_supports: 이 CPU에서 쓸 수 있는지
+ * sequential_search_set_kernel: 강제로 바꿈 (테스트/벤치마크용, 지원하지 않으면 false)
+ */
+SearchKernel sequential_search_kernel(void);
+bool sequential_search_supports(SearchKernel kernel);
+bool sequential_search_set_kernel(SearchKernel kernel);
+const char *search_kernel_name(SearchKernel kernel);
+
 /**
  * 배열 출력 함수
  * @param arr: 출력할 배열
@@ -20,4 +61,4 @@ int sequential_search(int *arr, int size, int target);
  */
 void print_array(int *arr, int size);
 
-#endif // SEQUENTIAL_SEARCH_H
\ No newline at end of file
+#endif // SEQUENTIAL_SEARCH_H
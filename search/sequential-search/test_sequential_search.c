@@ -1,4 +1,16 @@
 #include "sequential_search.h"
+#include "parallel_search.h"
+#include "sequential_scan.h"
+#include "file_search.h"
+#include "bloom_filter.h"
+#include "typed_search.h"
+#include "self_organizing.h"
+#include <limits.h>
+#include <math.h>
+#include <string.h>
+#include <stdbool.h>
+
+static int failures = 0;
 
 /**
  * 테스트 결과 출력 헬퍼 함수
@@ -151,6 +163,657 @@ void test_large_array()
   printf("동적 메모리 해제 완료\n\n");
 }
 
+/**
+ * 테스트 8: SIMD 커널과 스칼라 구현 비교
+ * 길이 0~300, 일치 위치를 처음/벡터 경계/꼬리/없음으로 바꿔가며 전부 비교
+ */
+void test_simd_kernels()
+{
+  printf("╔════════════════════════════════════════╗\n");
+  printf("║  [테스트 8] SIMD 커널 vs 스칼라              ║\n");
+  printf("╚════════════════════════════════════════╝\n");
+
+  printf("자동 선택된 커널: %s\n", search_kernel_name(sequential_search_kernel()));
+
+  int arr[300];
+  SearchKernel kernels[] = {SEARCH_KERNEL_SCALAR, SEARCH_KERNEL_SSE2, SEARCH_KERNEL_AVX2,
+                            SEARCH_KERNEL_AVX512};
+  SearchKernel selected = sequential_search_kernel();
+
+  for (int k = 0; k < 4; k++)
+  {
+    if (!sequential_search_set_kernel(kernels[k]))
+    {
+      printf("- %s: 이 CPU에서 지원하지 않아 건너뜀\n", search_kernel_name(kernels[k]));
+      continue;
+    }
+
+    bool ok = true;
+    for (int size = 0; size <= 300 && ok; size++)
+    {
+      // 0, 1, 2, ... 로 채우고 일부 위치에 중복 값을 심음
+      for (int i = 0; i < size; i++)
+      {
+        arr[i] = i;
+      }
+      for (int position = 0; position < size && ok; position++)
+      {
+        int saved = arr[size - 1];
+        arr[size - 1] = position; // 같은 값이 뒤에 한 번 더: 첫 위치를 반환해야 함
+        ok = sequential_search(arr, size, position) == position &&
+             sequential_search(arr, size, position) == sequential_search_scalar(arr, size, position);
+        arr[size - 1] = saved;
+      }
+      ok = ok && sequential_search(arr, size, -7) == -1 && sequential_search(arr, size, size) == -1;
+    }
+    ok = ok && sequential_search(NULL, 10, 0) == -1;
+
+    printf("%s %s: 길이 0~300, 모든 위치 + 중복 + 없는 값이 스칼라와 일치\n", ok ? "✓" : "✗",
+           search_kernel_name(kernels[k]));
+    failures += !ok;
+  }
+
+  sequential_search_set_kernel(selected);
+  printf("\n");
+}
+
+/**
+ * 테스트 9: 병렬 순차 탐색 (처음 일치 위치 보존)
+ */
+void test_parallel_search()
+{
+  printf("╔════════════════════════════════════════╗\n");
+  printf("║  [테스트 9] 병렬 순차 탐색                  ║\n");
+  printf("╚════════════════════════════════════════╝\n");
+
+  int size = 5 * 1000 * 1000 + 123; // 블록 경계에 맞지 않는 크기
+  int *arr = (int *)malloc(size * sizeof(int));
+  for (int i = 0; i < size; i++)
+  {
+    arr[i] = i % 1000003; // 1000003마다 같은 값이 반복됨 (중복)
+  }
+
+  // 찾는 값들: 첫 블록, 블록 경계 직전/직후, 중간, 마지막, 중복된 값, 없는 값
+  int targets[] = {0, 65535, 65536, 999999, 1000002, 4999999 % 1000003, -1, 2000000};
+  int threads[] = {1, 2, 4, 8, 0};
+  bool ok = true;
+  for (int t = 0; t < 5; t++)
+  {
+    for (int k = 0; k < 8; k++)
+    {
+      int expected = sequential_search_scalar(arr, size, targets[k]);
+      ok = ok && parallel_sequential_search(arr, size, targets[k], threads[t]) == expected;
+    }
+  }
+  printf("%s 500만 개, 스레드 1/2/4/8/자동: 모든 값이 스칼라 결과(첫 위치)와 일치\n", ok ? "✓" : "✗");
+  failures += !ok;
+
+  // 여러 블록에 같은 값: 뒤쪽 블록이 먼저 끝나도 앞쪽 결과가 이겨야 함
+  arr[size - 10] = -5;
+  arr[3 * 65536 + 7] = -5;
+  arr[40 * 65536 + 1] = -5;
+  ok = parallel_sequential_search(arr, size, -5, 8) == 3 * 65536 + 7;
+  printf("%s 여러 블록에 있는 값: 가장 앞 인덱스 %d 반환\n", ok ? "✓" : "✗", 3 * 65536 + 7);
+  failures += !ok;
+
+  // 작은 배열은 단일 스레드로 처리
+  ok = parallel_sequential_search(arr, 1000, 999, 8) == 999 &&
+       parallel_sequential_search(NULL, 10, 0, 4) == -1 && parallel_sequential_search(arr, 0, 0, 4) == -1;
+  printf("%s 작은 배열 / 빈 배열\n\n", ok ? "✓" : "✗");
+  failures += !ok;
+
+  free(arr);
+}
+
+void test_search_many()
+{
+  printf("╔════════════════════════════════════════╗\n");
+  printf("║  [테스트 10] 여러 값 한 번에 탐색            ║\n");
+  printf("╚════════════════════════════════════════╝\n");
+
+  int size = 20000;
+  int *arr = (int *)malloc(size * sizeof(int));
+  int targets[300];
+  int out[300];
+
+  // 값 범위를 좁혀 중복이 많게 함
+  for (int i = 0; i < size; i++)
+  {
+    arr[i] = (int)(((unsigned int)i * 2654435761u) % 5000);
+  }
+
+  bool ok = true;
+  for (int k = 1; k <= 300 && ok; k++)
+  {
+    // 있는 값, 없는 값(5000 이상, 음수), 같은 target 중복을 섞음
+    for (int j = 0; j < k; j++)
+    {
+      switch (j % 4)
+      {
+      case 0:
+        targets[j] = (j * 37 + k) % 5000;
+        break;
+      case 1:
+        targets[j] = 5000 + j;
+        break;
+      case 2:
+        targets[j] = -j;
+        break;
+      default:
+        targets[j] = targets[j / 2];
+        break;
+      }
+    }
+
+    int found = sequential_search_many(arr, size, targets, k, out);
+    int expected_found = 0;
+    for (int j = 0; j < k && ok; j++)
+    {
+      int expected = sequential_search_scalar(arr, size, targets[j]);
+      expected_found += expected >= 0;
+      ok = out[j] == expected;
+    }
+    ok = ok && found == expected_found;
+  }
+  printf("%s k = 1~300 (블록/해시 방식 모두): 각 target의 첫 위치가 스칼라와 일치\n", ok ? "✓" : "✗");
+  failures += !ok;
+
+  targets[0] = 1;
+  targets[1] = 2;
+  out[0] = out[1] = 0;
+  bool empty_ok = sequential_search_many(NULL, 10, targets, 2, out) == 0 && out[0] == -1 && out[1] == -1 &&
+                  sequential_search_many(arr, 0, targets, 2, out) == 0 &&
+                  sequential_search_many(arr, size, targets, 0, out) == 0;
+  printf("%s 빈 배열 / k = 0 처리\n", empty_ok ? "✓" : "✗");
+  failures += !empty_ok;
+
+  free(arr);
+  printf("\n");
+}
+
+/* 범위 스캔 기준 구현: lo <= arr[i] < hi인 위치를 max_out개까지 */
+static int naive_find_range(const int *arr, int size, int lo, int hi, int *out, int max_out)
+{
+  int n = 0;
+  for (int i = 0; i < size && n < max_out; i++)
+  {
+    if (arr[i] >= lo && arr[i] < hi)
+    {
+      out[n++] = i;
+    }
+  }
+  return n;
+}
+
+void test_scan_kernels()
+{
+  printf("╔════════════════════════════════════════╗\n");
+  printf("║  [테스트 11] 개수 / 모든 위치 / 범위 스캔     ║\n");
+  printf("╚════════════════════════════════════════╝\n");
+
+  int arr[300];
+  int out[310];
+  int expected[310];
+  int ranges[][2] = {{0, 1}, {-2, 3}, {3, 3}, {4, -4}, {INT_MIN, 0}, {0, INT_MAX}, {INT_MIN, INT_MAX}};
+  SearchKernel kernels[] = {SEARCH_KERNEL_SCALAR, SEARCH_KERNEL_SSE2, SEARCH_KERNEL_AVX2,
+                            SEARCH_KERNEL_AVX512};
+  SearchKernel selected = sequential_search_kernel();
+  unsigned int seed = 12345;
+
+  for (int k = 0; k < 4; k++)
+  {
+    if (!sequential_search_set_kernel(kernels[k]))
+    {
+      printf("- %s: 이 CPU에서 지원하지 않아 건너뜀\n", search_kernel_name(kernels[k]));
+      continue;
+    }
+
+    bool ok = true;
+    for (int size = 0; size <= 300 && ok; size++)
+    {
+      // -4~4 사이 값 (중복이 많음) + 가끔 INT_MIN/INT_MAX
+      for (int i = 0; i < size; i++)
+      {
+        seed = seed * 1103515245u + 12345u;
+        int r = (int)((seed >> 16) % 20);
+        arr[i] = r == 18 ? INT_MIN : r == 19 ? INT_MAX : r % 9 - 4;
+      }
+
+      for (int target = -5; target <= 5 && ok; target++)
+      {
+        int total = naive_find_range(arr, size, target, target + 1, expected, size);
+        ok = sequential_count(arr, size, target) == total &&
+             sequential_find_all(arr, size, target, out, size + 10) == total &&
+             memcmp(out, expected, total * sizeof(int)) == 0;
+      }
+      // INT_MAX는 target + 1이 넘치는 경우
+      int max_count = 0;
+      for (int i = 0; i < size; i++)
+      {
+        max_count += arr[i] == INT_MAX;
+      }
+      ok = ok && sequential_count(arr, size, INT_MAX) == max_count &&
+           sequential_count_range(arr, size, INT_MIN, INT_MAX) == size - max_count;
+
+      for (int r = 0; r < 7 && ok; r++)
+      {
+        int lo = ranges[r][0];
+        int hi = ranges[r][1];
+        int total = naive_find_range(arr, size, lo, hi, expected, size);
+        ok = sequential_count_range(arr, size, lo, hi) == total &&
+             sequential_find_range(arr, size, lo, hi, out, size) == total &&
+             memcmp(out, expected, total * sizeof(int)) == 0;
+
+        // 버퍼가 작으면 앞에서부터 max_out개만, 버퍼 밖에는 쓰지 않음
+        for (int max_out = 0; max_out <= 17 && ok; max_out++)
+        {
+          out[max_out] = 0x5A5A5A5A;
+          int written = sequential_find_range(arr, size, lo, hi, out, max_out);
+          ok = written == (total < max_out ? total : max_out) &&
+               memcmp(out, expected, written * sizeof(int)) == 0 && out[max_out] == 0x5A5A5A5A;
+        }
+      }
+    }
+    ok = ok && sequential_count(NULL, 10, 0) == 0 && sequential_find_all(NULL, 10, 0, out, 10) == 0;
+
+    printf("%s %s: 길이 0~300, count/find_all/범위가 기준 구현과 일치, 버퍼 크기 준수\n", ok ? "✓" : "✗",
+           search_kernel_name(kernels[k]));
+    failures += !ok;
+  }
+
+  sequential_search_set_kernel(selected);
+  printf("\n");
+}
+
+/* 배열을 int32 파일로 저장 */
+static bool write_ints(const char *path, const int *values, size_t count)
+{
+  FILE *fp = fopen(path, "wb");
+  if (fp == NULL)
+  {
+    return false;
+  }
+  bool ok = fwrite(values, sizeof(int), count, fp) == count;
+  return fclose(fp) == 0 && ok;
+}
+
+void test_file_search()
+{
+  printf("╔════════════════════════════════════════╗\n");
+  printf("║  [테스트 12] 파일 순차 탐색 (mmap / 읽기)     ║\n");
+  printf("╚════════════════════════════════════════╝\n");
+
+  const char *path = "test_sequential_search.bin";
+  int count = 3 * FILE_SEARCH_CHUNK + 123; // 마지막 청크는 일부만 참
+  int *values = (int *)malloc(count * sizeof(int));
+  for (int i = 0; i < count; i++)
+  {
+    values[i] = i;
+  }
+  values[count - 1] = FILE_SEARCH_CHUNK + 5; // 뒤쪽 청크에 한 번 더: 첫 위치를 반환해야 함
+
+  long long positions[] = {0, 1, FILE_SEARCH_CHUNK - 1, FILE_SEARCH_CHUNK, 2 * FILE_SEARCH_CHUNK + 7,
+                           count - 2, FILE_SEARCH_CHUNK + 5};
+  FileSearchMode modes[] = {FILE_SEARCH_MMAP, FILE_SEARCH_READ};
+  const char *mode_names[] = {"mmap", "이중 버퍼 읽기"};
+
+  bool written = write_ints(path, values, count);
+  for (int m = 0; m < 2; m++)
+  {
+    bool ok = written;
+    long long index = 0;
+    for (int p = 0; p < 7 && ok; p++)
+    {
+      ok = sequential_search_file(path, values[positions[p]], modes[m], &index) && index == positions[p];
+    }
+    ok = ok && sequential_search_file(path, -1, modes[m], &index) && index == -1;
+    printf("%s %s: 청크 경계 / 마지막 청크 / 중복 / 없는 값\n", ok ? "✓" : "✗", mode_names[m]);
+    failures += !ok;
+  }
+
+  // 빈 파일, 4의 배수가 아닌 크기, 없는 파일
+  bool ok = write_ints(path, values, 0);
+  for (int m = 0; m < 2 && ok; m++)
+  {
+    long long index = 0;
+    ok = sequential_search_file(path, 0, modes[m], &index) && index == -1;
+  }
+  FILE *fp = fopen(path, "ab");
+  ok = ok && fp != NULL && fputc(1, fp) != EOF;
+  if (fp != NULL)
+  {
+    fclose(fp);
+  }
+  for (int m = 0; m < 2 && ok; m++)
+  {
+    long long index = 0;
+    ok = !sequential_search_file(path, 0, modes[m], &index) &&
+         !sequential_search_file("no_such_file.bin", 0, modes[m], &index);
+  }
+  printf("%s 빈 파일은 -1, 잘린 파일 / 없는 파일은 실패\n", ok ? "✓" : "✗");
+  failures += !ok;
+
+  remove(path);
+  free(values);
+  printf("\n");
+}
+
+void test_bloom_filter()
+{
+  printf("╔════════════════════════════════════════╗\n");
+  printf("║  [테스트 13] 블룸 필터로 없는 값 거르기        ║\n");
+  printf("╚════════════════════════════════════════╝\n");
+
+  int size = 100000;
+  int *arr = (int *)malloc(size * sizeof(int));
+  for (int i = 0; i < size; i++)
+  {
+    arr[i] = i * 2; // 홀수는 모두 없는 값
+  }
+
+  double rates[] = {0.1, 0.01, 0.001};
+  for (int r = 0; r < 3; r++)
+  {
+    BloomFilter *filter = build_bloom_filter(arr, size, rates[r]);
+    bool ok = filter != NULL;
+    for (int i = 0; i < size && ok; i++)
+    {
+      ok = bloom_filter_may_contain(filter, arr[i]);
+    }
+
+    int passed = 0;
+    int trials = 200000;
+    for (int k = 0; k < trials && ok; k++)
+    {
+      passed += bloom_filter_may_contain(filter, 2 * k + 1);
+    }
+    double measured = (double)passed / trials;
+    // 블록 해시가 고르면 목표의 1.5배 안에 들어옴
+    ok = ok && measured <= rates[r] * 1.5;
+    printf("%s 목표 오탐률 %.1f%%: 키당 %.2f비트, 실제 %.3f%%, 넣은 값은 모두 통과\n", ok ? "✓" : "✗",
+           rates[r] * 100, filter ? filter->bits_per_key : 0.0, measured * 100);
+    failures += !ok;
+
+    // AVX2 경로와 스칼라 경로가 같은 비트를 쓰고 읽는지
+    if (r == 1 && filter != NULL && filter->use_avx2)
+    {
+      // 같은 크기로 만든 뒤 비우고 스칼라 경로로 다시 채움
+      BloomFilter *scalar = build_bloom_filter(arr, size, rates[r]);
+      bool same = scalar != NULL && scalar->num_blocks == filter->num_blocks;
+      if (same)
+      {
+        memset(scalar->blocks, 0, (size_t)scalar->num_blocks * BLOOM_BLOCK_WORDS * sizeof(uint32_t));
+        scalar->use_avx2 = false;
+        for (int i = 0; i < size; i++)
+        {
+          bloom_filter_add(scalar, arr[i]);
+        }
+        same = memcmp(scalar->blocks, filter->blocks,
+                      (size_t)filter->num_blocks * BLOOM_BLOCK_WORDS * sizeof(uint32_t)) == 0;
+        for (int k = 0; k < 10000 && same; k++)
+        {
+          same = bloom_filter_may_contain(filter, k) == bloom_filter_may_contain(scalar, k);
+        }
+      }
+      printf("%s AVX2 / 스칼라 경로가 같은 필터를 만듦\n", same ? "✓" : "✗");
+      failures += !same;
+      free_bloom_filter(scalar);
+    }
+    free_bloom_filter(filter);
+  }
+
+  // 필터를 거친 탐색은 sequential_search와 결과가 같아야 함 (중복 포함)
+  arr[size - 1] = 500;
+  BloomFilter *filter = build_bloom_filter(arr, size, 0.01);
+  bool ok = filter != NULL;
+  for (int target = -10; target < 2 * size + 10 && ok; target += 7)
+  {
+    ok = sequential_search_filtered(filter, arr, size, target) == sequential_search(arr, size, target);
+  }
+  bloom_filter_add(filter, -77);
+  ok = ok && bloom_filter_may_contain(filter, -77);
+  printf("%s 필터를 거친 탐색이 sequential_search와 일치, 추가한 키 통과\n", ok ? "✓" : "✗");
+  failures += !ok;
+  free_bloom_filter(filter);
+
+  BloomFilter *empty = build_bloom_filter(NULL, 0, 0.01);
+  ok = empty != NULL && !bloom_filter_may_contain(empty, 0) && build_bloom_filter(NULL, 5, 0.01) == NULL;
+  printf("%s 빈 배열 필터 / NULL 처리\n", ok ? "✓" : "✗");
+  failures += !ok;
+  free_bloom_filter(empty);
+
+  free(arr);
+  printf("\n");
+}
+
+/*
+ * 테스트 14 헬퍼: 타입별 길이 0~300, 모든 위치 확인
+ * filler로 채운 배열에 value를 심는다. filler와 value는 한 바이트/반쪽만 같게 골라서
+ * 원소 폭보다 좁게 비교하는 커널이면 틀리게 만든다.
+ */
+#define TYPED_CHECK_DEFINE(suffix, T)                                                  \
+  static bool check_typed_##suffix(T filler, T value)                                  \
+  {                                                                                    \
+    T arr[300];                                                                        \
+    for (size_t size = 0; size <= 300; size++)                                         \
+    {                                                                                  \
+      for (size_t i = 0; i < size; i++)                                                \
+      {                                                                                \
+        arr[i] = filler;                                                               \
+      }                                                                                \
+      if (sequential_search_##suffix(arr, size, value) != -1)                          \
+      {                                                                                \
+        return false;                                                                  \
+      }                                                                                \
+      for (size_t position = 0; position < size; position++)                           \
+      {                                                                                \
+        arr[position] = value;                                                         \
+        arr[size - 1] = value; /* 뒤에 한 번 더: 첫 위치를 반환해야 함 */               \
+        bool found = sequential_search_##suffix(arr, size, value) == (ptrdiff_t)position; \
+        arr[position] = filler;                                                        \
+        arr[size - 1] = filler;                                                        \
+        if (!found)                                                                    \
+        {                                                                              \
+          return false;                                                                \
+        }                                                                              \
+      }                                                                                \
+    }                                                                                  \
+    return sequential_search_##suffix(NULL, 10, value) == -1;                          \
+  }
+
+TYPED_SEARCH_TYPES(TYPED_CHECK_DEFINE)
+
+/**
+ * 테스트 14: 타입별 순차 탐색 (8/16/32/64비트, float, double)
+ */
+void test_typed_search()
+{
+  printf("╔════════════════════════════════════════╗\n");
+  printf("║  [테스트 14] 타입별 탐색 (int8 ~ double)      ║\n");
+  printf("╚════════════════════════════════════════╝\n");
+
+  SearchKernel kernels[] = {SEARCH_KERNEL_SCALAR, SEARCH_KERNEL_SSE2, SEARCH_KERNEL_AVX2};
+  SearchKernel selected = sequential_search_kernel();
+
+  for (int k = 0; k < 3; k++)
+  {
+    if (!sequential_search_set_kernel(kernels[k]))
+    {
+      printf("- %s: 이 CPU에서 지원하지 않아 건너뜀\n", search_kernel_name(kernels[k]));
+      continue;
+    }
+
+    bool ok = check_typed_i8(0, INT8_MIN) && check_typed_u8(1, UINT8_MAX) &&
+              check_typed_i16(0x0101, 0x0102) && check_typed_u16(0x00FF, 0xFFFF) &&
+              check_typed_i32(0x7FFF0000, 0x7FFFFFFF) && check_typed_u32(0x12345678u, 0x12340000u) &&
+              check_typed_i64(INT64_C(0x100000007), 7) &&
+              check_typed_u64(5, UINT64_C(0x8000000000000005)) && check_typed_f32(1.5f, -2.25f) &&
+              check_typed_f64(1.0, 1.0 + 1e-15);
+    printf("%s %s: 10개 타입 모두 길이 0~300, 모든 위치 + 중복 + 없는 값\n", ok ? "✓" : "✗",
+           search_kernel_name(kernels[k]));
+    failures += !ok;
+
+    // 실수 비교 규칙: -0.0 == 0.0, NaN은 찾지 못함
+    float floats[40] = {0};
+    floats[5] = NAN;
+    floats[33] = -0.0f;
+    double doubles[40];
+    for (int i = 0; i < 40; i++)
+    {
+      doubles[i] = i + 0.5;
+    }
+    doubles[21] = -0.0;
+    doubles[30] = NAN;
+    ok = sequential_search_f32(floats + 6, 34, -0.0f) == 0 && sequential_search_f32(floats, 40, NAN) == -1 &&
+         sequential_search_f32(floats + 6, 34, 0.0f) == 0 && sequential_search_f64(doubles, 40, 0.0) == 21 &&
+         sequential_search_f64(doubles, 40, NAN) == -1 && sequential_search_f64(doubles, 40, 39.5) == 39;
+    printf("%s %s: -0.0 == 0.0, NaN은 찾지 못함\n", ok ? "✓" : "✗", search_kernel_name(kernels[k]));
+    failures += !ok;
+  }
+  sequential_search_set_kernel(selected);
+
+  // 배열 포인터 타입으로 함수 선택
+  uint16_t shorts[100];
+  for (int i = 0; i < 100; i++)
+  {
+    shorts[i] = (uint16_t)(i * 600);
+  }
+  const int64_t longs[] = {INT64_MAX, -1, INT64_MIN};
+  char text[] = "abcdefg\xF0";
+  bool ok = sequential_search_typed(shorts, 100, (uint16_t)(99 * 600)) == 99 &&
+            sequential_search_typed(longs, 3, INT64_MIN) == 2 && sequential_search_typed(text, 7, 'd') == 3 &&
+            sequential_search_typed(text, 8, '\xF0') == 7 && sequential_search_typed(text, 7, 'z') == -1;
+  printf("%s sequential_search_typed: 배열 타입에 맞는 함수 선택 (uint16_t *, const int64_t *, char *)\n",
+         ok ? "✓" : "✗");
+  failures += !ok;
+  printf("\n");
+}
+
+/* COUNT 정책 순서: 창 밖은 횟수 내림차순, 창 안 원소는 counts[창 크기] 이상 */
+static bool count_order_holds(const SelfOrganizingList *list)
+{
+  int window = SELF_ORGANIZING_WINDOW;
+  for (int i = window + 1; i < list->size; i++)
+  {
+    if (list->counts[i - 1] < list->counts[i])
+    {
+      return false;
+    }
+  }
+  for (int i = 0; i < window && list->size > window; i++)
+  {
+    if (list->counts[i] < list->counts[window])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * 테스트 15: 자기 조직화 리스트 (move-to-front / transpose / count)
+ */
+void test_self_organizing()
+{
+  printf("╔════════════════════════════════════════╗\n");
+  printf("║  [테스트 15] 자기 조직화 리스트                ║\n");
+  printf("╚════════════════════════════════════════╝\n");
+
+  // 재배치 동작 확인 (창 밖 위치에서 찾아야 옮겨짐)
+  int window = SELF_ORGANIZING_WINDOW;
+  int arr[200];
+  for (int i = 0; i < 200; i++)
+  {
+    arr[i] = i * 10;
+  }
+  SelfOrganizingList *mtf = build_self_organizing_list(arr, 200, REORDER_MOVE_TO_FRONT);
+  SelfOrganizingList *transpose = build_self_organizing_list(arr, 200, REORDER_TRANSPOSE);
+  SelfOrganizingList *count = build_self_organizing_list(arr, 200, REORDER_COUNT);
+
+  bool ok = self_organizing_search(mtf, 1500) == 150 && mtf->keys[0] == 1500 && mtf->keys[1] == 0 &&
+            mtf->keys[150] == 1490 && mtf->keys[151] == 1510 && self_organizing_search(mtf, 1500) == 150 &&
+            mtf->comparisons == 152;
+  ok = ok && self_organizing_search(mtf, 100) == 10 && mtf->keys[11] == 100; // 창 안이면 그대로
+  printf("%s move-to-front: 150번째를 찾으면 맨 앞, 다시 찾으면 비교 1번, 창(%d) 안은 그대로\n",
+         ok ? "✓" : "✗", window);
+  failures += !ok;
+
+  ok = self_organizing_search(transpose, 1500) == 150 && transpose->keys[149] == 1500 &&
+       transpose->keys[150] == 1490 && self_organizing_search(transpose, 1500) == 150 &&
+       transpose->keys[148] == 1500;
+  printf("%s transpose: 찾을 때마다 한 칸씩 앞으로\n", ok ? "✓" : "✗");
+  failures += !ok;
+
+  self_organizing_search(count, 1990); // 창 안에서 횟수가 가장 적은 원소 중 가장 뒤의 것과 교환
+  ok = count->keys[window - 1] == 1990 && count->counts[window - 1] == 1 &&
+       count->keys[window] == (window - 1) * 10;
+  self_organizing_search(count, 1500);
+  self_organizing_search(count, 1500); // 창 안: 횟수만 올라감
+  ok = ok && count->keys[window - 2] == 1500 && count->counts[window - 2] == 2 &&
+       count->keys[window - 1] == 1990 && count->keys[window] == (window - 2) * 10 &&
+       count->keys[window + 1] == (window - 1) * 10 && count_order_holds(count);
+  printf("%s count: 창 밖에서 찾으면 창 안의 덜 찾힌 원소와 교환, 창 안은 횟수만 올라감\n", ok ? "✓" : "✗");
+  failures += !ok;
+
+  // 창 안 원소만 여러 번 찾은 뒤 창 밖 원소를 찾아도 창 밖 내림차순이 유지되어야 함
+  int wide[1024];
+  for (int i = 0; i < 1024; i++)
+  {
+    wide[i] = i;
+  }
+  SelfOrganizingList *ordered = build_self_organizing_list(wide, 1024, REORDER_COUNT);
+  for (int i = 0; i < 5; i++)
+  {
+    self_organizing_search(ordered, window - 1);
+  }
+  ok = self_organizing_search(ordered, 200) == 200 && self_organizing_search(ordered, 300) == 300 &&
+       ordered->counts[window - 1] == 5 && count_order_holds(ordered);
+  printf("%s count: 창 안 횟수 5 + 창 밖 200, 300 조회 후에도 창 밖은 횟수 내림차순\n", ok ? "✓" : "✗");
+  failures += !ok;
+  free_self_organizing_list(ordered);
+  free_self_organizing_list(mtf);
+  free_self_organizing_list(transpose);
+  free_self_organizing_list(count);
+
+  // 랜덤 쿼리 (중복 값, 없는 값 포함): 원래 배열의 순차 탐색과 결과가 같아야 함
+  int size = 500;
+  int *values = (int *)malloc(size * sizeof(int));
+  unsigned int seed = 29;
+  for (int i = 0; i < size; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    values[i] = (int)((seed >> 16) % 300);
+  }
+  ReorderPolicy policies[] = {REORDER_NONE, REORDER_MOVE_TO_FRONT, REORDER_TRANSPOSE, REORDER_COUNT};
+  for (int p = 0; p < 4; p++)
+  {
+    SelfOrganizingList *list = build_self_organizing_list(values, size, policies[p]);
+    ok = list != NULL;
+    for (int q = 0; q < 20000 && ok; q++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      // 값 0~31에 쿼리 절반이 몰리게 (재배치가 많이 일어나도록)
+      int target = (seed >> 20) & 1 ? (int)((seed >> 8) % 32) : (int)((seed >> 8) % 330);
+      ok = self_organizing_search(list, target) == sequential_search(values, size, target) &&
+           (policies[p] != REORDER_COUNT || count_order_holds(list));
+    }
+    printf("%s %s: 쿼리 2만 개가 원래 배열의 순차 탐색과 일치%s (평균 비교 %.1f)\n", ok ? "✓" : "✗",
+           reorder_policy_name(policies[p]), policies[p] == REORDER_COUNT ? ", 횟수 순서 유지" : "",
+           list ? (double)list->comparisons / 20000 : 0.0);
+    failures += !ok;
+    free_self_organizing_list(list);
+  }
+  free(values);
+
+  SelfOrganizingList *empty = build_self_organizing_list(NULL, 0, REORDER_COUNT);
+  ok = empty != NULL && self_organizing_search(empty, 1) == -1 && self_organizing_search(NULL, 1) == -1 &&
+       build_self_organizing_list(NULL, 3, REORDER_NONE) == NULL;
+  printf("%s 빈 리스트 / NULL 처리\n", ok ? "✓" : "✗");
+  failures += !ok;
+  free_self_organizing_list(empty);
+  printf("\n");
+}
+
 int main()
 {
   printf("╔══════════════════════════════════════════════╗\n");
@@ -167,7 +830,20 @@ int main()
   test_empty_array();
   test_duplicate_values();
   test_large_array();
+  test_simd_kernels();
+  test_parallel_search();
+  test_search_many();
+  test_scan_kernels();
+  test_file_search();
+  test_bloom_filter();
+  test_typed_search();
+  test_self_organizing();
 
+  if (failures > 0)
+  {
+    printf("✗ 실패한 테스트가 %d개 있습니다.\n", failures);
+    return 1;
+  }
   printf("✓ 모든 테스트가 완료되었습니다.\n");
 
   return 0;
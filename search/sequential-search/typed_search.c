@@ -0,0 +1,218 @@
+#include "typed_search.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define TYPED_HAVE_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+/*
+ * 커널 종류: X(접미사, 타입, 비교 방식)
+ * 비교 방식 8/16/32/64는 정수 비트 비교, F32/F64는 실수 == 비교
+ */
+#define TYPED_KERNEL_TYPES(X) \
+  X(i8, int8_t, 8)            \
+  X(u8, uint8_t, 8)           \
+  X(i16, int16_t, 16)         \
+  X(u16, uint16_t, 16)        \
+  X(i32, int32_t, 32)         \
+  X(u32, uint32_t, 32)        \
+  X(i64, int64_t, 64)         \
+  X(u64, uint64_t, 64)        \
+  X(f32, float, F32)          \
+  X(f64, double, F64)
+
+/* ---------- 스칼라 ---------- */
+
+#define TYPED_SCALAR_DEFINE(suffix, T, kind)                                   \
+  static ptrdiff_t scan_scalar_##suffix(const T *arr, size_t size, T target) \
+  {                                                                          \
+    for (size_t i = 0; i < size; i++)                                        \
+    {                                                                        \
+      if (arr[i] == target)                                                  \
+      {                                                                      \
+        return (ptrdiff_t)i;                                                 \
+      }                                                                      \
+    }                                                                        \
+    return -1;                                                               \
+  }
+
+TYPED_KERNEL_TYPES(TYPED_SCALAR_DEFINE)
+
+#ifdef TYPED_HAVE_X86_KERNELS
+
+/*
+ * 비교 방식별 set1 / 같음 비교
+ * 결과는 일치하는 원소의 모든 바이트가 0xFF인 벡터라서
+ * movemask_epi8의 비트 위치 / sizeof(T)가 원소 위치가 된다.
+ * (부호 없는 값을 char/short 등으로 바꾸는 것은 비트만 옮기기 위한 것)
+ */
+#define SSE2_SET1_8(v) _mm_set1_epi8((char)(v))
+#define SSE2_SET1_16(v) _mm_set1_epi16((short)(v))
+#define SSE2_SET1_32(v) _mm_set1_epi32((int)(v))
+#define SSE2_SET1_64(v) _mm_set1_epi64x((long long)(v))
+#define SSE2_SET1_F32(v) _mm_castps_si128(_mm_set1_ps(v))
+#define SSE2_SET1_F64(v) _mm_castpd_si128(_mm_set1_pd(v))
+
+#define SSE2_EQ_8(x, n) _mm_cmpeq_epi8(x, n)
+#define SSE2_EQ_16(x, n) _mm_cmpeq_epi16(x, n)
+#define SSE2_EQ_32(x, n) _mm_cmpeq_epi32(x, n)
+#define SSE2_EQ_64(x, n) sse2_cmpeq_epi64(x, n)
+#define SSE2_EQ_F32(x, n) _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(x), _mm_castsi128_ps(n)))
+#define SSE2_EQ_F64(x, n) _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(x), _mm_castsi128_pd(n)))
+
+#define AVX2_SET1_8(v) _mm256_set1_epi8((char)(v))
+#define AVX2_SET1_16(v) _mm256_set1_epi16((short)(v))
+#define AVX2_SET1_32(v) _mm256_set1_epi32((int)(v))
+#define AVX2_SET1_64(v) _mm256_set1_epi64x((long long)(v))
+#define AVX2_SET1_F32(v) _mm256_castps_si256(_mm256_set1_ps(v))
+#define AVX2_SET1_F64(v) _mm256_castpd_si256(_mm256_set1_pd(v))
+
+#define AVX2_EQ_8(x, n) _mm256_cmpeq_epi8(x, n)
+#define AVX2_EQ_16(x, n) _mm256_cmpeq_epi16(x, n)
+#define AVX2_EQ_32(x, n) _mm256_cmpeq_epi32(x, n)
+#define AVX2_EQ_64(x, n) _mm256_cmpeq_epi64(x, n)
+#define AVX2_EQ_F32(x, n) \
+  _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(x), _mm256_castsi256_ps(n), _CMP_EQ_OQ))
+#define AVX2_EQ_F64(x, n) \
+  _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(x), _mm256_castsi256_pd(n), _CMP_EQ_OQ))
+
+/* SSE2에는 64비트 같음 비교가 없으므로 32비트 비교 결과를 위/아래 반쪽과 AND */
+__attribute__((target("sse2"))) static inline __m128i sse2_cmpeq_epi64(__m128i x, __m128i n)
+{
+  __m128i eq = _mm_cmpeq_epi32(x, n);
+  return _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+/*
+ * SIMD 커널 (sequential_search.c의 커널과 같은 구조)
+ * 1. 벡터 4개를 비교하고 OR해서 한 번만 분기
+ * 2. 일치하면 movemask_epi8로 바이트 마스크를 만들어 ctz / sizeof(T)
+ * 3. 남은 원소는 벡터 1개 단위, 마지막은 스칼라
+ * 벡터 하나의 원소 수 lanes = 벡터 바이트 / sizeof(T) (컴파일 시간 상수)
+ */
+#define TYPED_SIMD_DEFINE(suffix, T, kind)                                                         \
+  __attribute__((target("sse2"))) static ptrdiff_t scan_sse2_##suffix(const T *arr, size_t size, \
+                                                                      T target)                  \
+  {                                                                                              \
+    const size_t lanes = 16 / sizeof(T);                                                         \
+    const __m128i needle = SSE2_SET1_##kind(target);                                            \
+    size_t i = 0;                                                                                \
+                                                                                                 \
+    for (; size - i >= 4 * lanes; i += 4 * lanes)                                                \
+    {                                                                                            \
+      __m128i a = SSE2_EQ_##kind(_mm_loadu_si128((const __m128i *)(arr + i)), needle);          \
+      __m128i b = SSE2_EQ_##kind(_mm_loadu_si128((const __m128i *)(arr + i + lanes)), needle);  \
+      __m128i c = SSE2_EQ_##kind(_mm_loadu_si128((const __m128i *)(arr + i + 2 * lanes)), needle); \
+      __m128i d = SSE2_EQ_##kind(_mm_loadu_si128((const __m128i *)(arr + i + 3 * lanes)), needle); \
+      __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));                       \
+      if (_mm_movemask_epi8(any) != 0)                                                           \
+      {                                                                                          \
+        /* 벡터 4개 x 16바이트 마스크를 64비트 하나로 합침 */                                    \
+        uint64_t mask = (uint64_t)(uint32_t)_mm_movemask_epi8(a) |                               \
+                        (uint64_t)(uint32_t)_mm_movemask_epi8(b) << 16 |                         \
+                        (uint64_t)(uint32_t)_mm_movemask_epi8(c) << 32 |                         \
+                        (uint64_t)(uint32_t)_mm_movemask_epi8(d) << 48;                          \
+        return (ptrdiff_t)(i + (size_t)__builtin_ctzll(mask) / sizeof(T));                       \
+      }                                                                                          \
+    }                                                                                            \
+                                                                                                 \
+    for (; size - i >= lanes; i += lanes)                                                        \
+    {                                                                                            \
+      __m128i eq = SSE2_EQ_##kind(_mm_loadu_si128((const __m128i *)(arr + i)), needle);         \
+      unsigned int mask = (unsigned int)_mm_movemask_epi8(eq);                                   \
+      if (mask != 0)                                                                             \
+      {                                                                                          \
+        return (ptrdiff_t)(i + __builtin_ctz(mask) / sizeof(T));                                 \
+      }                                                                                          \
+    }                                                                                            \
+                                                                                                 \
+    ptrdiff_t rest = scan_scalar_##suffix(arr + i, size - i, target);                            \
+    return rest < 0 ? -1 : (ptrdiff_t)i + rest;                                                  \
+  }                                                                                              \
+                                                                                                 \
+  __attribute__((target("avx2"))) static ptrdiff_t scan_avx2_##suffix(const T *arr, size_t size, \
+                                                                      T target)                  \
+  {                                                                                              \
+    const size_t lanes = 32 / sizeof(T);                                                         \
+    const __m256i needle = AVX2_SET1_##kind(target);                                            \
+    size_t i = 0;                                                                                \
+                                                                                                 \
+    for (; size - i >= 4 * lanes; i += 4 * lanes)                                                \
+    {                                                                                            \
+      __m256i a = AVX2_EQ_##kind(_mm256_loadu_si256((const __m256i *)(arr + i)), needle);       \
+      __m256i b = AVX2_EQ_##kind(_mm256_loadu_si256((const __m256i *)(arr + i + lanes)), needle); \
+      __m256i c =                                                                                \
+          AVX2_EQ_##kind(_mm256_loadu_si256((const __m256i *)(arr + i + 2 * lanes)), needle);    \
+      __m256i d =                                                                                \
+          AVX2_EQ_##kind(_mm256_loadu_si256((const __m256i *)(arr + i + 3 * lanes)), needle);    \
+      __m256i any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));              \
+      if (!_mm256_testz_si256(any, any))                                                         \
+      {                                                                                          \
+        /* 바이트 마스크가 128비트라 앞/뒤 벡터 2개씩 나눠서 확인 */                         \
+        uint64_t front = (uint64_t)(uint32_t)_mm256_movemask_epi8(a) |                           \
+                         (uint64_t)(uint32_t)_mm256_movemask_epi8(b) << 32;                      \
+        if (front != 0)                                                                          \
+        {                                                                                        \
+          return (ptrdiff_t)(i + (size_t)__builtin_ctzll(front) / sizeof(T));                    \
+        }                                                                                        \
+        uint64_t back = (uint64_t)(uint32_t)_mm256_movemask_epi8(c) |                            \
+                        (uint64_t)(uint32_t)_mm256_movemask_epi8(d) << 32;                       \
+        return (ptrdiff_t)(i + 2 * lanes + (size_t)__builtin_ctzll(back) / sizeof(T));           \
+      }                                                                                          \
+    }                                                                                            \
+                                                                                                 \
+    for (; size - i >= lanes; i += lanes)                                                        \
+    {                                                                                            \
+      __m256i eq = AVX2_EQ_##kind(_mm256_loadu_si256((const __m256i *)(arr + i)), needle);      \
+      unsigned int mask = (unsigned int)_mm256_movemask_epi8(eq);                                \
+      if (mask != 0)                                                                             \
+      {                                                                                          \
+        return (ptrdiff_t)(i + __builtin_ctz(mask) / sizeof(T));                                 \
+      }                                                                                          \
+    }                                                                                            \
+                                                                                                 \
+    ptrdiff_t rest = scan_scalar_##suffix(arr + i, size - i, target);                            \
+    return rest < 0 ? -1 : (ptrdiff_t)i + rest;                                                  \
+  }
+
+TYPED_KERNEL_TYPES(TYPED_SIMD_DEFINE)
+
+#endif // TYPED_HAVE_X86_KERNELS
+
+/*
+ * 공개 함수: sequential_search_kernel()이 고른 커널로 분기
+ * AVX-512 커널이 선택된 CPU는 AVX2도 지원하므로 AVX2 커널을 쓴다.
+ */
+#ifdef TYPED_HAVE_X86_KERNELS
+#define TYPED_DISPATCH(suffix)                       \
+  switch (sequential_search_kernel())                \
+  {                                                  \
+  case SEARCH_KERNEL_AVX512:                         \
+  case SEARCH_KERNEL_AVX2:                           \
+    return scan_avx2_##suffix(arr, size, target);    \
+  case SEARCH_KERNEL_SSE2:                           \
+    return scan_sse2_##suffix(arr, size, target);    \
+  default:                                           \
+    return scan_scalar_##suffix(arr, size, target);  \
+  }
+#else
+#define TYPED_DISPATCH(suffix) return scan_scalar_##suffix(arr, size, target);
+#endif
+
+#define TYPED_PUBLIC_DEFINE(suffix, T, kind)                                 \
+  ptrdiff_t sequential_search_##suffix(const T *arr, size_t size, T target) \
+  {                                                                         \
+    if (arr == NULL || size == 0)                                           \
+    {                                                                       \
+      return -1;                                                            \
+    }                                                                       \
+    TYPED_DISPATCH(suffix)                                                  \
+  }
+
+TYPED_KERNEL_TYPES(TYPED_PUBLIC_DEFINE)
+
+/* char -> uint8_t 변환은 모듈로 2^8이라 char의 부호와 관계없이 같은 비트 */
+ptrdiff_t sequential_search_char(const char *arr, size_t size, char target)
+{
+  return sequential_search_u8((const uint8_t *)arr, size, (uint8_t)target);
+}
@@ -0,0 +1,60 @@
+#ifndef TYPED_SEARCH_H
+#define TYPED_SEARCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sequential_search.h"
+
+/*
+ * 타입별 순차 탐색 (8/16/32/64비트 정수, float, double)
+ *
+ * sequential_search는 int 배열과 int 길이만 받으므로 2^31개를 넘는 배열이나
+ * 다른 타입의 키는 탐색할 수 없었다. 여기서는 타입마다 size_t 길이를 받는 함수를
+ * 매크로로 만들어 낸다.
+ *
+ *   ptrdiff_t sequential_search_i8(const int8_t *arr, size_t size, int8_t target);
+ *   ...
+ *   ptrdiff_t sequential_search_f64(const double *arr, size_t size, double target);
+ *
+ * 반환값: 처음 일치하는 인덱스, 없으면 -1
+ *
+ * 커널은 원소 폭마다 SSE2/AVX2 버전이 있다. 벡터 하나(16/32바이트)에 들어가는
+ * 원소 수가 폭에 반비례하므로 int8은 int32보다 비교 한 번에 4배 많은 원소를 본다.
+ * 부호 있는/없는 정수는 같음 비교가 비트 비교라 같은 커널을 쓴다.
+ * 실수는 == 규칙을 따른다 (-0.0 == 0.0, NaN은 어떤 값과도 같지 않음).
+ * 커널은 sequential_search_kernel()을 따른다 (AVX-512면 AVX2 커널 사용).
+ */
+
+/* 타입 목록: X(접미사, 타입) */
+#define TYPED_SEARCH_TYPES(X) \
+  X(i8, int8_t)               \
+  X(u8, uint8_t)              \
+  X(i16, int16_t)             \
+  X(u16, uint16_t)            \
+  X(i32, int32_t)             \
+  X(u32, uint32_t)            \
+  X(i64, int64_t)             \
+  X(u64, uint64_t)            \
+  X(f32, float)               \
+  X(f64, double)
+
+#define TYPED_SEARCH_DECLARE(suffix, T) ptrdiff_t sequential_search_##suffix(const T *arr, size_t size, T target);
+
+TYPED_SEARCH_TYPES(TYPED_SEARCH_DECLARE)
+
+/* char는 int8_t/uint8_t와 다른 타입이라 따로 둔다 (uint8_t 커널로 바이트 비교) */
+ptrdiff_t sequential_search_char(const char *arr, size_t size, char target);
+
+/*
+ * 배열 포인터 타입으로 함수 선택: sequential_search_typed(arr, size, target)
+ * 목록에 없는 타입은 컴파일 오류가 난다 (예: int64_t가 long인 환경의 long long *).
+ * (다른 폭의 커널로 넘기면 결과가 틀리고 배열 끝을 넘어 읽으므로 기본 분기를 두지 않음)
+ */
+#define TYPED_SEARCH_GENERIC_CASE(suffix, T) T * : sequential_search_##suffix, const T * : sequential_search_##suffix,
+
+#define sequential_search_typed(arr, size, target)                  \
+  _Generic((arr), TYPED_SEARCH_TYPES(TYPED_SEARCH_GENERIC_CASE)     \
+           char * : sequential_search_char,                         \
+           const char * : sequential_search_char)(arr, size, target)
+
+#endif // TYPED_SEARCH_H